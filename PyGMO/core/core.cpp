@@ -278,6 +278,7 @@ BOOST_PYTHON_MODULE(_core)
 
 	typedef population::size_type (population::*get_best_1_idx)() const;
 	typedef std::vector<population::size_type> (population::*get_best_N_idx)(const population::size_type& N) const;
+	typedef void (population::*push_back_x)(const decision_vector &);
 
 
 	class_<population>("population", "Population class.", init<const problem::base &,optional<int, boost::uint32_t> >())
@@ -301,7 +302,7 @@ BOOST_PYTHON_MODULE(_core)
 		.def("get_worst_idx",&population::get_worst_idx,"Get index of worst individual.")
 		.def("set_x", &population_set_x,"Set decision vector of individual at position n.")
 		.def("set_v", &population_set_v,"Set velocity of individual at position n.")
-		.def("push_back", &population::push_back,"Append individual with given decision vector at the end of the population.")
+		.def("push_back", push_back_x(&population::push_back),"Append individual with given decision vector at the end of the population.")
 		.def("erase", &population::erase, "Erase individual at position")
 		.def("mean_velocity", &population::mean_velocity, "Calculates the mean velocity across particles")
 		.def("race", &race_return_tuple, "Race the individuals")
@@ -337,12 +338,31 @@ BOOST_PYTHON_MODULE(_core)
 		.def("cpp_dumps", &py_cpp_dumps<population::champion_type>)
 		.def_pickle(generic_pickle_suite<population::champion_type>());
 
+	// Island telemetry.
+	class_<base_island::telemetry_type>("island_telemetry","Evolution telemetry of an island (times in milliseconds).",init<>())
+		.def_readonly("n_evolutions",&base_island::telemetry_type::n_evolutions)
+		.def_readonly("evo_time",&base_island::telemetry_type::evo_time)
+		.def_readonly("min_evo_time",&base_island::telemetry_type::min_evo_time)
+		.def_readonly("max_evo_time",&base_island::telemetry_type::max_evo_time)
+		.def_readonly("pre_evolution_time",&base_island::telemetry_type::pre_evolution_time)
+		.def_readonly("post_evolution_time",&base_island::telemetry_type::post_evolution_time)
+		.def_readonly("sync_time",&base_island::telemetry_type::sync_time)
+		.def_readonly("objfun_time",&base_island::telemetry_type::objfun_time)
+		.def_readonly("fevals",&base_island::telemetry_type::fevals)
+		.def_readonly("cache_hits",&base_island::telemetry_type::cache_hits)
+		.def_readonly("cache_misses",&base_island::telemetry_type::cache_misses)
+		.add_property("mean_evo_time",&base_island::telemetry_type::get_mean_evo_time)
+		.add_property("fevals_per_second",&base_island::telemetry_type::get_fevals_per_second)
+		.add_property("cache_hit_rate",&base_island::telemetry_type::get_cache_hit_rate);
+
 	// Base island class for Python implementation.
 	class_<python_base_island, boost::noncopyable>("_base_island",init<const algorithm::base &, const problem::base &, optional<int,const migration::base_s_policy &,const migration::base_r_policy &> >())
 		.def(init<const algorithm::base &, const population &, optional<const migration::base_s_policy &,const migration::base_r_policy &> >())
 		.def("__repr__",&base_island::human_readable)
 		.def("__len__", &base_island::get_size)
 		.def("get_evolution_time", &base_island::get_evolution_time,"Gives the evolution time in milliseconds.")
+		.def("get_telemetry", &base_island::get_telemetry,"Gives the evolution telemetry of the island.")
+		.def("reset_telemetry", &base_island::reset_telemetry,"Reset the evolution telemetry of the island.")
 		.def("evolve", &base_island::evolve,"Evolve island n times.")
 		.def("evolve_t", &base_island::evolve_t,"Evolve island for at least n milliseconds.")
 		.def("join", &base_island::join,"Wait for evolution to complete.")
@@ -395,8 +415,12 @@ BOOST_PYTHON_MODULE(_core)
 		.def("join", &archipelago::join,"Wait for evolution to complete.")
 		.def("interrupt", &archipelago::interrupt,"Interrupt evolution.")
 		.def("busy", &archipelago::busy,"Check if archipelago is evolving.")
+		.add_property("pool_size",&archipelago::get_pool_size,&archipelago::set_pool_size,"Size of the pool of threads used for evolution (0 for one thread per island).")
 		.def("push_back", &archipelago::push_back,"Append island.")
 		.def("set_algorithm", &archipelago_set_algorithm,"Set algorithm on island.")
+		.def("dump_telemetry", &archipelago::dump_telemetry,"Dump the evolution telemetry of the islands in CSV or JSON format.",
+			(boost::python::arg("format") = archipelago::csv))
+		.def("reset_telemetry", &archipelago::reset_telemetry,"Reset the evolution telemetry of the islands.")
 		.def("dump_migr_history", &archipelago::dump_migr_history)
 		.def("clear_migr_history", &archipelago::clear_migr_history)
 		.def("cpp_loads", &py_cpp_loads<archipelago>,
@@ -421,4 +445,8 @@ BOOST_PYTHON_MODULE(_core)
 	enum_<archipelago::migration_direction>("migration_direction")
 		.value("source",archipelago::source)
 		.value("destination",archipelago::destination);
+
+	enum_<archipelago::telemetry_format>("telemetry_format")
+		.value("csv",archipelago::csv)
+		.value("json",archipelago::json);
 }
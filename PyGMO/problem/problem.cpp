@@ -219,6 +219,11 @@ BOOST_PYTHON_MODULE(_problem) {
 		.def(self != self)
 		.def("is_compatible",&problem::base::is_compatible,"Check compatibility with other problem.")
 		.def("reset_caches",&problem::base::reset_caches,"Resets the internal caching system of PyGMO that stores previos calls to the objective function/ constraint function. This method should be called whenever a problem object is changed and the change affects the objective function.")
+		.add_property("cache_capacity",&problem::base::get_cache_capacity,&problem::base::set_cache_capacity,"Maximum number of decision vectors stored in the internal cache.")
+		.add_property("cache_hits",&problem::base::get_cache_hits,"Number of fitness/constraint vectors retrieved from the internal cache.")
+		.add_property("cache_misses",&problem::base::get_cache_misses,"Number of unsuccessful look-ups in the internal cache.")
+		.add_property("objfun_timing",&problem::base::get_objfun_timing,&problem::base::set_objfun_timing,"Timing of the objective function.")
+		.add_property("objfun_time",&problem::base::get_objfun_time,"Wall-clock time spent in the objective function while timing was enabled (in milliseconds).")
 		// Comparisons.
 		.def("compare_x",&problem::base::compare_x,"Compare decision vectors.")
 		.def("verify_x",&problem::base::verify_x,"Check if decision vector is compatible with problem.")
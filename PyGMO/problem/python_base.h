@@ -206,6 +206,12 @@ class __PAGMO_VISIBLE python_base: public base, public boost::python::wrapper<ba
                 return problem::base::compare_fc_impl(f0, c0, f1, c1);
             }
         }
+        bool has_default_comparison_impl() const
+        {
+            // the comparisons reimplemented in Python are not known to follow the default rules
+            return !this->get_override("_compare_fitness_impl") && !this->get_override("_compare_constraints_impl") &&
+                !this->get_override("_compare_fc_impl");
+        }
 
 	private:
 		friend class boost::serialization::access;
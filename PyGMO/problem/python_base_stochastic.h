@@ -201,6 +201,12 @@ class __PAGMO_VISIBLE python_base_stochastic: public base_stochastic, public boo
                 return problem::base::compare_fc_impl(f0, c0, f1, c1);
             }
         }
+        bool has_default_comparison_impl() const
+        {
+            // the comparisons reimplemented in Python are not known to follow the default rules
+            return !this->get_override("_compare_fitness_impl") && !this->get_override("_compare_constraints_impl") &&
+                !this->get_override("_compare_fc_impl");
+        }
 	private:
 		friend class boost::serialization::access;
 		template <class Archive>
@@ -425,12 +425,14 @@ hv_algorithm.fpl._original_init = hv_algorithm.fpl.__init__
 hv_algorithm.fpl.__init__ = _fpl_ctor
 
 
-def _hoy_ctor(self):
+def _hoy_ctor(self, n_threads=1):
     """
     Hypervolume algorithm: HOY.
     Computational complexity: O(n * log(n) + n ^ (d / 2))
     Applicable to hypervolume computation problems of dimension in [2, ..]
 
+    n_threads: number of threads used for the computation (0 for the number of hardware threads)
+
 
     REF: Nicola Beume and Guenter Rudolph, "Faster S-Metric Calculation by Considering Dominated Hypervolume as Klee's Measure Problem.",
     In: B. Kovalerchuk (ed.): Proceedings of the Second IASTED Conference on Computational Intelligence (CI 2006), pp. 231-236.  ACTA Press: Anaheim, 2006.
@@ -442,16 +444,19 @@ def _hoy_ctor(self):
             hv.exclusive(p_idx=13, r=refpoint, algorithm=hv_algorithm.hoy())
             hv.least_contributor(r=refpoint, algorithm=hv_algorithm.hoy())
     """
-    return self._original_init()
+    return self._original_init(n_threads)
 hv_algorithm.hoy._original_init = hv_algorithm.hoy.__init__
 hv_algorithm.hoy.__init__ = _hoy_ctor
 
 
-def _wfg_ctor(self, stop_dimension=2):
+def _wfg_ctor(self, stop_dimension=2, n_threads=1):
     """
     Hypervolume algorithm: WFG.
     Applicable to hypervolume computation problems of dimension in [2, ..]
 
+    stop_dimension: dimension at which the slicing stops and a dedicated algorithm is used
+    n_threads: number of threads used for the computation (0 for the number of hardware threads)
+
     REF: "A Fast Way of Calculating Exact Hypervolumes", Lyndon While, Lucas Bradstreet, Luigi Barone.
     IEEE TRANSACXTIONS ON EVOLUTIONARY COMPUTATION, VOL. 16, NO. 1, FEBRURARY 2012
 
@@ -464,6 +469,7 @@ def _wfg_ctor(self, stop_dimension=2):
     """
     args = []
     args.append(stop_dimension)
+    args.append(n_threads)
     return self._original_init(*args)
 hv_algorithm.wfg._original_init = hv_algorithm.wfg.__init__
 hv_algorithm.wfg.__init__ = _wfg_ctor
@@ -478,7 +484,8 @@ def _bf_approx_ctor(
         gamma=0.25,
         delta_multiplier=0.775,
         initial_delta_coeff=0.1,
-        alpha=0.2):
+        alpha=0.2,
+        n_threads=1):
     """
     Hypervolume algorithm: Bringmann-Friedrich approximation.
 
@@ -496,6 +503,7 @@ def _bf_approx_ctor(
             * delta_multiplier - factor with which delta diminishes each round
             * initial_delta_coeff - initial coefficient multiplied by the delta at round 0
             * alpha - coefficicient stating how accurately current lowest contributor should be sampled
+            * n_threads - number of threads used for the sampling (0 for the number of hardware threads)
             hv = hypervolume(...) # see 'hypervolume?' for usage
             refpoint = [1.0]*7
             hv.least_contributor(r=refpoint, algorithm=hv_algorithm.bf_approx())
@@ -510,12 +518,13 @@ def _bf_approx_ctor(
     args.append(alpha)
     args.append(initial_delta_coeff)
     args.append(gamma)
+    args.append(n_threads)
     return self._original_init(*args)
 hv_algorithm.bf_approx._original_init = hv_algorithm.bf_approx.__init__
 hv_algorithm.bf_approx.__init__ = _bf_approx_ctor
 
 
-def _bf_fpras_ctor(self, eps=1e-2, delta=1e-2):
+def _bf_fpras_ctor(self, eps=1e-2, delta=1e-2, n_threads=1):
     """
     Hypervolume algorithm: Bringmann-Friedrich approximation.
 
@@ -527,6 +536,7 @@ def _bf_fpras_ctor(self, eps=1e-2, delta=1e-2):
     USAGE:
             * eps - accuracy of approximation
             * delta - confidence of approximation
+            * n_threads - number of threads used for the sampling (0 for the number of hardware threads)
 
             hv = hypervolume(...) # see 'hypervolume?' for usage
             refpoint = [1.0]*7
@@ -536,6 +546,7 @@ def _bf_fpras_ctor(self, eps=1e-2, delta=1e-2):
     args = []
     args.append(eps)
     args.append(delta)
+    args.append(n_threads)
     return self._original_init(*args)
 hv_algorithm.bf_fpras._original_init = hv_algorithm.bf_fpras.__init__
 hv_algorithm.bf_fpras.__init__ = _bf_fpras_ctor
@@ -115,11 +115,16 @@ void expose_hv_algorithm()
 	algorithm_wrapper<util::hv_algorithm::hv3d>("hv3d","hv3d algorithm.");
 	algorithm_wrapper<util::hv_algorithm::hv4d>("hv4d","hv4d algorithm.");
 	algorithm_wrapper<util::hv_algorithm::fpl>("fpl","FPL algorithm.");
-	algorithm_wrapper<util::hv_algorithm::hoy>("hoy","HOY algorithm.");
-	class_<util::hv_algorithm::wfg, bases<util::hv_algorithm::base> >("wfg","WFG algorithm.", init<const unsigned int>());
+	algorithm_wrapper<util::hv_algorithm::hoy>("hoy","HOY algorithm.")
+		.def(init<const unsigned int>())
+		.add_property("n_threads", &util::hv_algorithm::hoy::get_n_threads);
+	class_<util::hv_algorithm::wfg, bases<util::hv_algorithm::base> >("wfg","WFG algorithm.", init<const unsigned int, optional<const unsigned int> >())
+		.add_property("n_threads", &util::hv_algorithm::wfg::get_n_threads);
 	class_<util::hv_algorithm::bf_approx, bases<util::hv_algorithm::base> >("bf_approx","Bringmann-Friedrich approximated algorithm.", 
-			init<const bool, const unsigned int, const double, const double, const double, const double, const double, const double>());
-	class_<util::hv_algorithm::bf_fpras, bases<util::hv_algorithm::base> >("bf_fpras","Hypervolume approximation based on FPRAS", init<const double, const double>());
+			init<const bool, const unsigned int, const double, const double, const double, const double, const double, const double, optional<const unsigned int> >())
+		.add_property("n_threads", &util::hv_algorithm::bf_approx::get_n_threads);
+	class_<util::hv_algorithm::bf_fpras, bases<util::hv_algorithm::base> >("bf_fpras","Hypervolume approximation based on FPRAS", init<const double, const double, optional<const unsigned int> >())
+		.add_property("n_threads", &util::hv_algorithm::bf_fpras::get_n_threads);
 }
 
 void expose_hypervolume()
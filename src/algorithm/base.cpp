@@ -22,10 +22,13 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
+#include <boost/math/constants/constants.hpp>
+#include <cmath>
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 #include "../population.h"
 #include "../rng.h"
@@ -86,6 +89,46 @@ void base::reset_rngs(const unsigned int p) const {
 	m_drng = rng_double(p);
 }
 
+/// Fill a vector with uniform variates.
+/**
+ * Resizes the vector to n and fills it with n consecutive draws in [0,1[ of the double-precision generator, i.e., the values
+ * that n successive calls to m_drng() would return. This is a plain loop over m_drng(): it does not draw faster than the
+ * generator, it only lets the callers draw their variates ahead of the loops consuming them, into a vector reused across generations.
+ *
+ * @param[out] out vector receiving the variates.
+ * @param[in] n number of variates.
+ */
+void base::fill_uniform(std::vector<double> &out, const std::vector<double>::size_type n) const
+{
+	out.resize(n);
+	for (std::vector<double>::size_type i = 0; i < n; ++i) {
+		out[i] = m_drng();
+	}
+}
+
+/// Fill a vector with normal variates.
+/**
+ * Resizes the vector to n and fills it with standard normal variates, obtained in pairs with the Box-Muller transform of a block of
+ * uniform variates of the double-precision generator. Each pair of normal variates consumes two uniform variates, and an odd
+ * n consumes one more uniform variate than it returns.
+ *
+ * @param[out] out vector receiving the variates.
+ * @param[in] n number of variates.
+ */
+void base::fill_normal(std::vector<double> &out, const std::vector<double>::size_type n) const
+{
+	const double two_pi = 2. * boost::math::constants::pi<double>();
+	fill_uniform(out, n + n % 2);
+	for (std::vector<double>::size_type i = 0; i < out.size(); i += 2) {
+		// 1 - u lies in ]0,1], so that the logarithm is finite.
+		const double r = std::sqrt(-2. * std::log(1. - out[i]));
+		const double theta = two_pi * out[i + 1];
+		out[i] = r * std::cos(theta);
+		out[i + 1] = r * std::sin(theta);
+	}
+	out.resize(n);
+}
+
 /// Return human readable representation of the algorithm.
 /**
  * Will return a formatted string containing the algorithm name from get_name().
@@ -28,6 +28,7 @@
 #include <iostream>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include <boost/shared_ptr.hpp>
 
 #include "../config.h"
@@ -112,6 +113,8 @@ return base_ptr(new derived_algorithm(*this));
 		void reset_rngs(const unsigned int) const;
 
 	protected:
+		void fill_uniform(std::vector<double> &, const std::vector<double>::size_type) const;
+		void fill_normal(std::vector<double> &, const std::vector<double>::size_type) const;
 		/// Indicates to the derived class whether to print stuff on screen
 		bool m_screen_output;
 		/// Random number generator for double-precision floating point values.
@@ -81,7 +81,7 @@ cmaes::cmaes(int gen, double cc, double cs, double c1, double cmu, double sigma0
 	//Initialize the algorithm memory
 	m_mean = Eigen::VectorXd::Zero(1);
 	m_variation = Eigen::VectorXd::Zero(1);
-	m_newpop = std::vector<Eigen::VectorXd>();
+	m_newpop = Eigen::MatrixXd::Zero(0,0);
 	m_B = Eigen::MatrixXd::Identity(1,1);
 	m_D = Eigen::MatrixXd::Identity(1,1);
 	m_C = Eigen::MatrixXd::Identity(1,1);
@@ -189,38 +189,38 @@ void cmaes::evolve(population &pop) const
 	double damps = 1 + 2*std::max(0.0, std::sqrt((mueff-1)/(N+1))-1) + cs;	// damping for sigma
 	double chiN = std::sqrt(N) * (1-1.0/(4*N)+1.0/(21*N*N));		// expectation of ||N(0,I)|| == norm(randn(N,1))
 
-	// Initializing and allocating (here one could use mutable data member to avoid redefinition of non const data)
-
-	// Algorithm's Memory. This allows the algorithm to start from its last "state"
-	VectorXd mean(m_mean);
-	VectorXd variation(m_variation);
-	std::vector<VectorXd> newpop(m_newpop);
-	MatrixXd B(m_B);
-	MatrixXd D(m_D);
-	MatrixXd C(m_C);
-	MatrixXd invsqrtC(m_invsqrtC);
-	VectorXd pc(m_pc);
-	VectorXd ps(m_ps);
+	// Algorithm's Memory. This allows the algorithm to start from its last "state". When the memory is enabled
+	// the data members are swapped in and out of the local variables, which is done in constant time.
+	VectorXd mean, variation, pc, ps;
+	MatrixXd newpop, B, D, C, invsqrtC;
 	int counteval(m_counteval);
 	int eigeneval(m_eigeneval);
 	double sigma(m_sigma);
 	double var_norm = 0;
+	if (m_memory) {
+		swap_memory(mean,variation,newpop,B,D,C,invsqrtC,pc,ps);
+	}
 
 	// Some buffers
 	VectorXd meanold = VectorXd::Zero(N);
-	MatrixXd Dinv = MatrixXd::Identity(N,N);
-	MatrixXd Cold = MatrixXd::Identity(N,N);
-	VectorXd tmp = VectorXd::Zero(N);
-	std::vector<VectorXd> elite(mu,tmp);
-	decision_vector dumb(N,0);
+	VectorXd Dinv = VectorXd::Ones(N);
+	MatrixXd BD(N,N);			// B*D, the transformation applied to the normally distributed vectors
+	MatrixXd Z(N,lam);			// normally distributed vectors, one per column
+	MatrixXd elite(N,mu);			// the mu best individuals of the generation, one per column
+	MatrixXd weighted_elite(N,mu);
+	std::vector<decision_vector> dumb(lam,decision_vector(N,0));
+	std::vector<population::size_type> all_idx(lam);
+	for (population::size_type i = 0; i<lam; ++i ) {
+		all_idx[i] = i;
+	}
 
 	// If the algorithm is called for the first time on this problem dimension / pop size or if m_memory is false we erease the memory of past calls
-	if ( (m_newpop.size() != lam) || ((unsigned int)(m_newpop[0].rows() ) != N) || (m_memory==false) ) {
+	if ( ((population::size_type)newpop.cols() != lam) || ((problem::base::size_type)newpop.rows() != N) || (m_memory==false) ) {
 		mean.resize(N);
 		for (problem::base::size_type i=0;i<N;++i){
 			mean(i) = pop.champion().x[i];
 		}
-		newpop = std::vector<VectorXd>(lam,tmp);
+		newpop = MatrixXd::Zero(N,lam);
 		variation.resize(N);
 
 		//We define the satrting B,D,C
@@ -241,6 +241,8 @@ void cmaes::evolve(population &pop) const
 		counteval = 0;
 		eigeneval = 0;
 	}
+	// D is diagonal: B*D only scales the columns of B
+	BD.noalias() = B * D.diagonal().asDiagonal();
 	
 	// ----------------------------------------------//
 	// HERE WE START THE REAL ALGORITHM              //
@@ -263,186 +265,196 @@ void cmaes::evolve(population &pop) const
 	}
 	
 	SelfAdjointEigenSolver<MatrixXd> es(N);
-	for (std::size_t g = 0; g < m_gen; ++g) {
-		// 1 - We generate and evaluate lam new individuals
+	try {
+		for (std::size_t g = 0; g < m_gen; ++g) {
+			// 1 - We generate and evaluate lam new individuals
 
-		for (population::size_type i = 0; i<lam; ++i ) {
-			// 1a - we create a randomly normal distributed vector
-			for (problem::base::size_type j=0; j<N; ++j){
-				tmp(j) = normally_distributed_number();
-			}
-			// 1b - and store its transformed value in the newpop
-			newpop[i] = mean + (sigma * B * D * tmp);
-		}
-		//This is evaluated here on the last generated tmp and will be used only as 
-		//a stopping criteria
-		var_norm = (sigma * B * D * tmp).norm();
-		
-		//1b - Check the exit conditions (every 5 generations) // we need to do it here as 
-		//termination is defined on tmp
-		if (g%5 == 0) {
-			if  ( (sigma*B*D*tmp).norm() < m_xtol ) {
-				if (m_screen_output) { 
-					std::cout << "Exit condition -- xtol < " <<  m_xtol << std::endl;
+			// 1a - we create lam randomly normal distributed vectors
+			for (population::size_type i = 0; i<lam; ++i ) {
+				for (problem::base::size_type j=0; j<N; ++j){
+					Z(j,i) = normally_distributed_number();
 				}
-				return;
 			}
+			// 1b - and store their transformed values in the newpop, with a single matrix product
+			newpop.noalias() = sigma * BD * Z;
+			//This is evaluated here on the last generated vector and will be used only as 
+			//a stopping criteria
+			var_norm = newpop.col(lam - 1).norm();
+			newpop.colwise() += mean;
+			
+			//1b - Check the exit conditions (every 5 generations) // we need to do it here as 
+			//termination is defined on the last generated vector
+			if (g%5 == 0) {
+				if  ( var_norm < m_xtol ) {
+					if (m_screen_output) { 
+						std::cout << "Exit condition -- xtol < " <<  m_xtol << std::endl;
+					}
+					break;
+				}
 
-			double mah = std::fabs(pop.get_individual(pop.get_worst_idx()).best_f[0] - pop.get_individual(pop.get_best_idx()).best_f[0]);
+				double mah = std::fabs(pop.get_individual(pop.get_worst_idx()).best_f[0] - pop.get_individual(pop.get_best_idx()).best_f[0]);
 
-			if (mah < m_ftol) {
-				if (m_screen_output) {
-					std::cout << "Exit condition -- ftol < " <<  m_ftol << std::endl;
+				if (mah < m_ftol) {
+					if (m_screen_output) {
+						std::cout << "Exit condition -- ftol < " <<  m_ftol << std::endl;
+					}
+					break;
 				}
-				return;
 			}
-		}
 
-		// 1c - we fix the bounds 
-		for (population::size_type i = 0; i<lam; ++i ) {
-			for (decision_vector::size_type j = 0; j<N; ++j ) {
-				if ( (newpop[i](j) < lb[j]) || (newpop[i](j) > ub[j]) ) {
-					newpop[i](j) = lb[j] + randomly_distributed_number() * (ub[j] - lb[j]);
+			// 1c - we fix the bounds 
+			for (population::size_type i = 0; i<lam; ++i ) {
+				for (decision_vector::size_type j = 0; j<N; ++j ) {
+					if ( (newpop(j,i) < lb[j]) || (newpop(j,i) > ub[j]) ) {
+						newpop(j,i) = lb[j] + randomly_distributed_number() * (ub[j] - lb[j]);
+					}
 				}
 			}
-		}
 
-		// 2 - We Evaluate the new population (if the problem is stochastic change seed first)
-		try
-		{	//TODO: check if it is really necessary to clear the pop, also
-			//would it make sense to use best_x also?
-			dynamic_cast<const pagmo::problem::base_stochastic &>(prob).set_seed(m_urng());
-			pop.clear(); // Removes memory based on different seeds (champion and best_x, best_f, best_c)
+			// 2 - We Evaluate the new population (if the problem is stochastic change seed first),
+			// in a single batch that runs in parallel if the problem has a thread pool
 			for (population::size_type i = 0; i<lam; ++i ) {
-			  	for (decision_vector::size_type j = 0; j<N; ++j ) {
-					dumb[j] = newpop[i](j);
+				for (decision_vector::size_type j = 0; j<N; ++j ) {
+					dumb[i][j] = newpop(j,i);
 				}
-				pop.push_back(dumb);
 			}
-			counteval += lam;
-		}
-		catch (const std::bad_cast& e)
-		{
-			// Reinsertion (original method)
-			for (population::size_type i = 0; i<lam; ++i ) {
+			try
+			{	//TODO: check if it is really necessary to clear the pop, also
+				//would it make sense to use best_x also?
+				dynamic_cast<const pagmo::problem::base_stochastic &>(prob).set_seed(m_urng());
+				pop.clear(); // Removes memory based on different seeds (champion and best_x, best_f, best_c)
+				pop.push_back_batch(dumb);
+				counteval += lam;
+			}
+			catch (const std::bad_cast& e)
+			{
+				// Reinsertion (original method)
+				pop.set_x_batch(all_idx,dumb);
+				counteval += lam;
+			}
+			
+			// 2 - We extract the elite from this generation. We use cur_f, equivalent to the
+			// original method
+			std::vector<population::size_type> best_idx;
+			best_idx.reserve(pop.size());
+			for (population::size_type i=0; i<pop.size(); ++i){
+				best_idx.push_back(i);
+			}
+			cmp_using_cur cmp(pop);
+			std::sort(best_idx.begin(),best_idx.end(),cmp);
+			best_idx.resize(mu);
+			for (population::size_type i = 0; i<mu; ++i ) {
 				for (decision_vector::size_type j = 0; j<N; ++j ) {
-					dumb[j] = newpop[i](j);
+					elite(j,i) = pop.get_individual(best_idx[i]).cur_x[j];
 				}
-				pop.set_x(i,dumb);
-			}
-			counteval += lam;
-		}
-		
-		// 2 - We extract the elite from this generation. We use cur_f, equivalent to the
-		// original method
-		std::vector<population::size_type> best_idx;
-		best_idx.reserve(pop.size());
-		for (population::size_type i=0; i<pop.size(); ++i){
-			best_idx.push_back(i);
-		}
-		cmp_using_cur cmp(pop);
-		std::sort(best_idx.begin(),best_idx.end(),cmp);
-		best_idx.resize(mu);
-		for (population::size_type i = 0; i<mu; ++i ) {
-			for (decision_vector::size_type j = 0; j<N; ++j ) {
-				elite[i](j) = pop.get_individual(best_idx[i]).cur_x[j];
 			}
-		}
 
 
-		// 3 - Compute the new elite mean storing the old one
-		meanold=mean;
-		mean = elite[0]*weights(0);
-		for (population::size_type i = 1; i<mu; ++i ) {
-			mean += elite[i]*weights(i);
-		}
-
-		// 4 - Update evolution paths
-		ps = (1 - cs) * ps + std::sqrt(cs*(2-cs)*mueff) * invsqrtC * (mean-meanold) / sigma;
-		double hsig = 0;
-		hsig = (ps.squaredNorm() / N / (1-std::pow((1-cs),(2.0*counteval/lam))) ) < (2.0 + 4/(N+1));
-		pc = (1-cc) * pc + hsig * std::sqrt(cc*(2-cc)*mueff) * (mean-meanold) / sigma;
-
-		// 5 - Adapt Covariance Matrix
-		Cold = C;
-		C = (elite[0]-meanold)*(elite[0]-meanold).transpose()*weights(0);
-		for (population::size_type i = 1; i<mu; ++i ) {
-			C += (elite[i]-meanold)*(elite[i]-meanold).transpose()*weights(i);
-		}
-		C /= sigma*sigma;
-		C = (1-c1-cmu) * Cold +
-			cmu * C +
-			c1 * ((pc * pc.transpose()) + (1-hsig) * cc * (2-cc) * Cold);
-
-		//6 - Adapt sigma
-		sigma *= std::exp( std::min( 0.6, (cs/damps) * (ps.norm()/chiN - 1) ) );
-		if ( (boost::math::isnan)(sigma) || (boost::math::isnan)(sigma) || (boost::math::isinf)(var_norm) || (boost::math::isnan)(var_norm) ) {
-			std::cout << "eigen: " << es.info() << std::endl;
-			std::cout << "B: " << B << std::endl;
-			std::cout << "D: " << D << std::endl;
-			std::cout << "Dinv: " << D << std::endl;
-			std::cout << "invsqrtC: " << invsqrtC << std::endl;
-			pagmo_throw(value_error,"NaN!!!!! in CMAES");
-		}
+			// 3 - Compute the new elite mean storing the old one
+			meanold=mean;
+			mean.noalias() = elite * weights;
+
+			// 4 - Update evolution paths
+			ps = (1 - cs) * ps + std::sqrt(cs*(2-cs)*mueff) * invsqrtC * (mean-meanold) / sigma;
+			double hsig = 0;
+			hsig = (ps.squaredNorm() / N / (1-std::pow((1-cs),(2.0*counteval/lam))) ) < (2.0 + 4/(N+1));
+			pc = (1-cc) * pc + hsig * std::sqrt(cc*(2-cc)*mueff) * (mean-meanold) / sigma;
+
+			// 5 - Adapt Covariance Matrix. The rank-mu update is computed as a single matrix product
+			// of the steps of the elite
+			elite.colwise() -= meanold;
+			elite /= sigma;
+			weighted_elite.noalias() = elite * weights.asDiagonal();
+			C *= (1-c1-cmu) + c1 * (1-hsig) * cc * (2-cc);
+			C.noalias() += c1 * (pc * pc.transpose());
+			C.noalias() += cmu * (weighted_elite * elite.transpose());
+
+			//6 - Adapt sigma
+			sigma *= std::exp( std::min( 0.6, (cs/damps) * (ps.norm()/chiN - 1) ) );
+			if ( (boost::math::isnan)(sigma) || (boost::math::isnan)(sigma) || (boost::math::isinf)(var_norm) || (boost::math::isnan)(var_norm) ) {
+				std::cout << "eigen: " << es.info() << std::endl;
+				std::cout << "B: " << B << std::endl;
+				std::cout << "D: " << D << std::endl;
+				std::cout << "Dinv: " << D << std::endl;
+				std::cout << "invsqrtC: " << invsqrtC << std::endl;
+				pagmo_throw(value_error,"NaN!!!!! in CMAES");
+			}
 
-		//7 - Perform eigen-decomposition of C
-		if ( (counteval - eigeneval) > (lam/(c1+cmu)/N/10) ) {		//achieve O(N^2)
-			eigeneval = counteval;
-			C = (C+C.transpose())/2;				//enforce symmetry
-			es.compute(C);						//eigen decomposition
-			if (es.info()==Success) {
-				B = es.eigenvectors();
-				D = es.eigenvalues().asDiagonal();
-				for (decision_vector::size_type j = 0; j<N; ++j ) {
-					D(j,j) = std::sqrt( std::max(1e-20,D(j,j)) );				//D contains standard deviations now
-				}
-				for (decision_vector::size_type j = 0; j<N; ++j ) {
-					Dinv(j,j) = 1.0 / D(j,j);
+			//7 - Perform eigen-decomposition of C. This is the only O(N^3) operation of the algorithm, and it is
+			// done only once every lam/(c1+cmu)/N/10 evaluations.
+			if ( (counteval - eigeneval) > (lam/(c1+cmu)/N/10) ) {		//achieve O(N^2)
+				eigeneval = counteval;
+				C = (C+C.transpose())/2;				//enforce symmetry
+				es.compute(C);						//eigen decomposition
+				if (es.info()==Success) {
+					B = es.eigenvectors();
+					D = es.eigenvalues().asDiagonal();
+					for (decision_vector::size_type j = 0; j<N; ++j ) {
+						D(j,j) = std::sqrt( std::max(1e-20,D(j,j)) );				//D contains standard deviations now
+					}
+					for (decision_vector::size_type j = 0; j<N; ++j ) {
+						Dinv(j) = 1.0 / D(j,j);
+					}
+					invsqrtC.noalias() = B * Dinv.asDiagonal() * B.transpose();
+					BD.noalias() = B * D.diagonal().asDiagonal();
+				} //if eigendecomposition fails just skip it and keep pevious succesful one.
+			}
+			
+			
+
+			//8 - We print on screen if required
+			if (m_screen_output) {
+				if (!(g%20)) {
+					std::cout << std::endl << std::left << std::setw(20) << 
+					"Gen." << std::setw(20) << 
+					"Champion " << std::setw(20) << 
+					"Highest " << std::setw(20) << 
+					"Lowest" << std::setw(20) << 
+					"Variation" << std::setw(20) << 
+					"Step" << std::endl; 
 				}
-				invsqrtC = B*Dinv*B.transpose();
-			} //if eigendecomposition fails just skip it and keep pevious succesful one.
-		}
-		
-		
-
-		//8 - We print on screen if required
-		if (m_screen_output) {
-			if (!(g%20)) {
-				std::cout << std::endl << std::left << std::setw(20) << 
-				"Gen." << std::setw(20) << 
-				"Champion " << std::setw(20) << 
-				"Highest " << std::setw(20) << 
-				"Lowest" << std::setw(20) << 
-				"Variation" << std::setw(20) << 
-				"Step" << std::endl; 
+					
+				std::cout << std::left << std::setprecision(14) << std::setw(20) << 
+					g << std::setw(20) << 
+					pop.champion().f[0] << std::setw(20) << 
+					pop.get_individual(pop.get_best_idx()).best_f[0] << std::setw(20) << 
+					pop.get_individual(pop.get_worst_idx()).best_f[0] << std::setw(20) << 
+					var_norm << std::setw(20) <<
+					sigma << std::endl;
 			}
-				
-			std::cout << std::left << std::setprecision(14) << std::setw(20) << 
-				g << std::setw(20) << 
-				pop.champion().f[0] << std::setw(20) << 
-				pop.get_individual(pop.get_best_idx()).best_f[0] << std::setw(20) << 
-				pop.get_individual(pop.get_worst_idx()).best_f[0] << std::setw(20) << 
-				var_norm << std::setw(20) <<
-				sigma << std::endl;
-		}
 
-	// Update algorithm memory
+			// Update algorithm memory
+			if (m_memory) {
+				m_counteval = counteval;
+				m_eigeneval = eigeneval;
+				m_sigma = sigma;
+			}
+		} // end loop on g
+	} catch (...) {
+		// The memory is given back to the data members before leaving
+		if (m_memory) {
+			swap_memory(mean,variation,newpop,B,D,C,invsqrtC,pc,ps);
+		}
+		throw;
+	}
 	if (m_memory) {
-		m_mean = mean;
-		m_variation = variation;
-		m_newpop = newpop;
-		m_B = B;
-		m_D = D;
-		m_C = C;
-		m_invsqrtC = invsqrtC;
-		m_pc = pc;
-		m_ps = ps;
-		m_counteval = counteval;
-		m_eigeneval = eigeneval;
-		m_sigma = sigma;
+		swap_memory(mean,variation,newpop,B,D,C,invsqrtC,pc,ps);
 	}
-		
-	} // end loop on g
+}
+
+// Swaps the memory data members with the given variables.
+void cmaes::swap_memory(Eigen::VectorXd &mean, Eigen::VectorXd &variation, Eigen::MatrixXd &newpop, Eigen::MatrixXd &B, Eigen::MatrixXd &D,
+	Eigen::MatrixXd &C, Eigen::MatrixXd &invsqrtC, Eigen::VectorXd &pc, Eigen::VectorXd &ps) const
+{
+	m_mean.swap(mean);
+	m_variation.swap(variation);
+	m_newpop.swap(newpop);
+	m_B.swap(B);
+	m_D.swap(D);
+	m_C.swap(C);
+	m_invsqrtC.swap(invsqrtC);
+	m_pc.swap(pc);
+	m_ps.swap(ps);
 }
 
 /// Setter for m_gen 
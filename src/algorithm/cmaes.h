@@ -42,7 +42,10 @@ namespace pagmo { namespace algorithm {
 
 /// Covariance Matrix Adaptation Evolutionary Startegy (CMAES)
 /**
-
+ * The lam offspring of a generation are sampled with a single matrix product, and they are evaluated in a single batch
+ * (see problem::base::objfun_batch()), which runs in parallel if the problem has a thread pool. The rank-mu update of the
+ * covariance matrix is also computed as a single matrix product. The eigendecomposition of the covariance matrix, which costs
+ * O(N^3), is performed only once every lam/(c1+cmu)/N/10 evaluations, so that the cost per evaluation stays O(N^2).
  */
 
 class __PAGMO_VISIBLE cmaes: public base
@@ -81,9 +84,12 @@ public:
 protected:
 	std::string human_readable_extra() const;
 private:
+	void swap_memory(Eigen::VectorXd &, Eigen::VectorXd &, Eigen::MatrixXd &, Eigen::MatrixXd &, Eigen::MatrixXd &,
+		Eigen::MatrixXd &, Eigen::MatrixXd &, Eigen::VectorXd &, Eigen::VectorXd &) const;
+
 	friend class boost::serialization::access;
 		template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void serialize(Archive &ar, const unsigned int version)
 	{
 		ar & boost::serialization::base_object<base>(*this);
 		ar & const_cast<std::size_t &>(m_gen);
@@ -97,7 +103,17 @@ private:
 		ar & m_memory;
 		ar & m_mean;
 		ar & m_variation;
-		ar & m_newpop;
+		if (version >= 1) {
+			ar & m_newpop;
+		} else {
+			// Older archives store the offspring as a vector of columns
+			std::vector<Eigen::VectorXd> newpop;
+			ar & newpop;
+			m_newpop.resize(newpop.empty() ? 0 : newpop[0].rows(),newpop.size());
+			for (std::vector<Eigen::VectorXd>::size_type i = 0; i < newpop.size(); ++i) {
+				m_newpop.col(i) = newpop[i];
+			}
+		}
 		ar & m_B;
 		ar & m_D;
 		ar & m_C;
@@ -121,7 +137,8 @@ private:
 	// "Memory" data members (these are here as to enable control over each single generation)
 	mutable Eigen::VectorXd m_mean;
 	mutable Eigen::VectorXd m_variation;
-	mutable std::vector<Eigen::VectorXd> m_newpop;
+	// The offspring of the last generation, one per column
+	mutable Eigen::MatrixXd m_newpop;
 	mutable Eigen::MatrixXd m_B;
 	mutable Eigen::MatrixXd m_D;
 	mutable Eigen::MatrixXd m_C;
@@ -135,5 +152,6 @@ private:
 }} //namespaces
 
 BOOST_CLASS_EXPORT_KEY(pagmo::algorithm::cmaes)
+BOOST_CLASS_VERSION(pagmo::algorithm::cmaes,1)
 
 #endif // PAGMO_ALGORITHM_CMAES_H
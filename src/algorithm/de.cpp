@@ -107,10 +107,11 @@ void de::evolve(population &pop) const
 	// Some vectors used during evolution are allocated here.
 	decision_vector dummy(D), tmp(D); //dummy is used for initialisation purposes, tmp to contain the mutated candidate
 	std::vector<decision_vector> popold(NP,dummy), popnew(NP,dummy);
+	std::vector<decision_vector> trial(NP,dummy);	//trial vectors of the current generation
 	decision_vector gbX(D),gbIter(D);
-	fitness_vector newfitness(prob_f_dimension);	//new fitness of the mutaded candidate
 	fitness_vector gbfit(prob_f_dimension);	//global best fitness
 	std::vector<fitness_vector> fit(NP,gbfit);
+	std::vector<fitness_vector> trial_fit(NP,gbfit);	//fitnesses of the trial vectors
 
 	//We extract from pop the chromosomes and fitness associated
 	for (std::vector<double>::size_type i = 0; i < NP; ++i) {
@@ -127,6 +128,7 @@ void de::evolve(population &pop) const
 
 	// Main DE iterations
 	size_t r1,r2,r3,r4,r5;	//indexes to the selected population members
+	std::vector<double> cr_draws(Dc);	//uniform draws of the binomial crossover of an individual
 	for (int gen = 0; gen < m_gen; ++gen) {
 		//Start of the loop through the deme
 		for (size_t i = 0; i < NP; ++i) {
@@ -225,8 +227,9 @@ void de::evolve(population &pop) const
 			else if (m_strategy == 6) {
 				tmp = popold[i];
 				size_t n = boost::uniform_int<int>(0,Dc-1)(m_urng);
+				fill_uniform(cr_draws,Dc);
 				for (size_t L = 0; L < Dc; ++L) { /* perform Dc binomial trials */
-					if ((m_drng() < m_cr) || L + 1 == Dc) { /* change at least one parameter */
+					if ((cr_draws[L] < m_cr) || L + 1 == Dc) { /* change at least one parameter */
 						tmp[n] = gbIter[n] + m_f*(popold[r2][n]-popold[r3][n]);
 					}
 					n = (n+1)%Dc;
@@ -236,8 +239,9 @@ void de::evolve(population &pop) const
 			else if (m_strategy == 7) {
 				tmp = popold[i];
 				size_t n = boost::uniform_int<int>(0,Dc-1)(m_urng);
+				fill_uniform(cr_draws,Dc);
 				for (size_t L = 0; L < Dc; ++L) { /* perform Dc binomial trials */
-					if ((m_drng() < m_cr) || L + 1 == Dc) { /* change at least one parameter */
+					if ((cr_draws[L] < m_cr) || L + 1 == Dc) { /* change at least one parameter */
 						tmp[n] = popold[r1][n] + m_f*(popold[r2][n]-popold[r3][n]);
 					}
 					n = (n+1)%Dc;
@@ -247,8 +251,9 @@ void de::evolve(population &pop) const
 			else if (m_strategy == 8) {
 				tmp = popold[i];
 				size_t n = boost::uniform_int<int>(0,Dc-1)(m_urng);
+				fill_uniform(cr_draws,Dc);
 				for (size_t L = 0; L < Dc; ++L) { /* perform Dc binomial trials */
-					if ((m_drng() < m_cr) || L + 1 == Dc) { /* change at least one parameter */
+					if ((cr_draws[L] < m_cr) || L + 1 == Dc) { /* change at least one parameter */
 						tmp[n] = tmp[n] + m_f*(gbIter[n] - tmp[n]) + m_f*(popold[r1][n]-popold[r2][n]);
 					}
 					n = (n+1)%Dc;
@@ -258,8 +263,9 @@ void de::evolve(population &pop) const
 			else if (m_strategy == 9) {
 				tmp = popold[i];
 				size_t n = boost::uniform_int<int>(0,Dc-1)(m_urng);
+				fill_uniform(cr_draws,Dc);
 				for (size_t L = 0; L < Dc; ++L) { /* perform Dc binomial trials */
-					if ((m_drng() < m_cr) || L + 1 == Dc) { /* change at least one parameter */
+					if ((cr_draws[L] < m_cr) || L + 1 == Dc) { /* change at least one parameter */
 						tmp[n] = gbIter[n] +
 							 (popold[r1][n]+popold[r2][n]-popold[r3][n]-popold[r4][n])*m_f;
 					}
@@ -270,8 +276,9 @@ void de::evolve(population &pop) const
 			else if (m_strategy == 10) {
 				tmp = popold[i];
 				size_t n = boost::uniform_int<int>(0,Dc-1)(m_urng);
+				fill_uniform(cr_draws,Dc);
 				for (size_t L = 0; L < Dc; ++L) { /* perform Dc binomial trials */
-					if ((m_drng() < m_cr) || L + 1 == Dc) { /* change at least one parameter */
+					if ((cr_draws[L] < m_cr) || L + 1 == Dc) { /* change at least one parameter */
 						tmp[n] = popold[r5][n] +
 							 (popold[r1][n]+popold[r2][n]-popold[r3][n]-popold[r4][n])*m_f;
 					}
@@ -289,27 +296,30 @@ void de::evolve(population &pop) const
 				++i2;
 			}
 
-			//b) how good?
-			prob.objfun(newfitness, tmp);    /* Evaluate new vector in tmp[] */
-			if ( pop.problem().compare_fitness(newfitness,fit[i]) ) {  /* improved objective function value ? */
-				fit[i]=newfitness;
-				popnew[i] = tmp;
+			trial[i] = tmp;
+		}//End of the loop through the deme
+
+		//b) how good? The trial vectors only depend on popold and gbIter, so the whole generation is evaluated at once.
+		prob.objfun_batch(trial_fit, trial);
+		for (size_t i = 0; i < NP; ++i) {
+			if ( pop.problem().compare_fitness(trial_fit[i],fit[i]) ) {  /* improved objective function value ? */
+				fit[i]=trial_fit[i];
+				popnew[i] = trial[i];
 				// As a fitness improvment occured we move the point
 				// and thus can evaluate a new velocity
-				std::transform(tmp.begin(), tmp.end(), pop.get_individual(i).cur_x.begin(), tmp.begin(),std::minus<double>());
-				//updates x and v (cache avoids to recompute the objective function)
-				pop.set_x(i,popnew[i]);
+				std::transform(trial[i].begin(), trial[i].end(), pop.get_individual(i).cur_x.begin(), tmp.begin(),std::minus<double>());
+				//updates x and v (the fitness is already known, no re-evaluation takes place)
+				pop.set_x(i,popnew[i],fit[i],constraint_vector());
 				pop.set_v(i,tmp);
-				if ( pop.problem().compare_fitness(newfitness,gbfit) ) {
+				if ( pop.problem().compare_fitness(fit[i],gbfit) ) {
 					/* if so...*/
-					gbfit=newfitness;          /* reset gbfit to new low...*/
+					gbfit=fit[i];          /* reset gbfit to new low...*/
 					gbX=popnew[i];
 				}
 			} else {
 				popnew[i] = popold[i];
 			}
-
-		}//End of the loop through the deme
+		}
 
 		/* Save best population member of current iteration */
 		gbIter = gbX;
@@ -24,6 +24,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 #include <boost/random/uniform_int.hpp>
 #include <boost/random/uniform_real.hpp>
 #include <boost/random/variate_generator.hpp>
@@ -239,7 +240,7 @@ for(int iter = 0; iter < m_gen; iter++){
 				pos2_c2 = (pos2_c1 == Nv-1? 0:pos2_c1+1);
 				pos1_c2 = std::find(tmp_tour.begin(),tmp_tour.end(),my_pop[i2][pos2_c2])-tmp_tour.begin();
 			}
-			stop = (abs(pos1_c1-pos1_c2)==1 || abs(pos1_c1-pos1_c2)==Nv-1);
+			stop = (std::abs(static_cast<int>(pos1_c1) - static_cast<int>(pos1_c2)) == 1 || std::abs(static_cast<int>(pos1_c1) - static_cast<int>(pos1_c2)) == static_cast<int>(Nv) - 1);
 			if(!stop){
 				changed = true;
 				if(pos1_c1<pos1_c2){
@@ -110,10 +110,12 @@ void jde::evolve(population &pop) const
 	// Some vectors used during evolution are allocated here.
 	decision_vector dummy(D), tmp(D); //dummy is used for initialisation purposes, tmp to contain the mutated candidate
 	std::vector<decision_vector> popold(NP,dummy), popnew(NP,dummy);
+	std::vector<decision_vector> trial(NP,dummy);	//trial vectors of the current generation
 	decision_vector gbX(D),gbIter(D);
-	fitness_vector newfitness(1);	//new fitness of the mutaded candidate
 	fitness_vector gbfit(1);	//global best fitness
 	std::vector<fitness_vector> fit(NP,gbfit);
+	std::vector<fitness_vector> trial_fit(NP,gbfit);	//fitnesses of the trial vectors
+	std::vector<double> trial_F(NP), trial_CR(NP);	//adapted parameters used to build the trial vectors
 
 	//We extract from pop the chromosomes and fitness associated
 	for (std::vector<double>::size_type i = 0; i < NP; ++i) {
@@ -518,33 +520,38 @@ void jde::evolve(population &pop) const
 				++i2;
 			}
 
-			//b) how good?
-			prob.objfun(newfitness, tmp);    /* Evaluate new vector in tmp[] */
-			if ( pop.problem().compare_fitness(newfitness,fit[i]) ) {  /* improved objective function value ? */
-				fit[i]=newfitness;
-				popnew[i] = tmp;
+			trial[i] = tmp;
+			trial_F[i] = F;
+			trial_CR[i] = CR;
+		}//End of the loop through the deme
+
+		//b) how good? The whole generation of trial vectors is evaluated at once.
+		prob.objfun_batch(trial_fit, trial);
+		for (size_t i = 0; i < NP; ++i) {
+			if ( pop.problem().compare_fitness(trial_fit[i],fit[i]) ) {  /* improved objective function value ? */
+				fit[i]=trial_fit[i];
+				popnew[i] = trial[i];
 				
 				// Update the adapted parameters
-				m_cr[i] = CR;
-				m_f[i] = F;
+				m_cr[i] = trial_CR[i];
+				m_f[i] = trial_F[i];
 				
 				// As a fitness improvment occured we move the point
 				// and thus can evaluate a new velocity
-				std::transform(tmp.begin(), tmp.end(), pop.get_individual(i).cur_x.begin(), tmp.begin(),std::minus<double>());
+				std::transform(trial[i].begin(), trial[i].end(), pop.get_individual(i).cur_x.begin(), tmp.begin(),std::minus<double>());
 				
-				//updates x and v (cache avoids to recompute the objective function)
-				pop.set_x(i,popnew[i]);
+				//updates x and v (the fitness is already known, no re-evaluation takes place)
+				pop.set_x(i,popnew[i],fit[i],constraint_vector());
 				pop.set_v(i,tmp);
-				if ( pop.problem().compare_fitness(newfitness,gbfit) ) {
+				if ( pop.problem().compare_fitness(fit[i],gbfit) ) {
 					/* if so...*/
-					gbfit=newfitness;          /* reset gbfit to new low...*/
+					gbfit=fit[i];          /* reset gbfit to new low...*/
 					gbX=popnew[i];
 				}
 			} else {
 				popnew[i] = popold[i];
 			}
-
-		}//End of the loop through the deme
+		}
 
 		/* Save best population member of current iteration */
 		gbIter = gbX;
@@ -32,6 +32,7 @@
 #include <string>
 #include <vector>
 #include <algorithm>
+#include <limits>
 
 #include "../exceptions.h"
 #include "../population.h"
@@ -78,24 +79,22 @@ base_ptr nsga2::clone() const
 	return base_ptr(new nsga2(*this));
 }
 
-pagmo::population::size_type nsga2::tournament_selection(pagmo::population::size_type idx1, pagmo::population::size_type idx2, const pagmo::population& pop) const
+pagmo::population::size_type nsga2::tournament_selection(pagmo::population::size_type idx1, pagmo::population::size_type idx2, const arena& a) const
 {
-	if (pop.get_pareto_rank(idx1) < pop.get_pareto_rank(idx2)) return idx1;
-	if (pop.get_pareto_rank(idx1) > pop.get_pareto_rank(idx2)) return idx2;
-	if (pop.get_crowding_d(idx1) > pop.get_crowding_d(idx2)) return idx1;
-	if (pop.get_crowding_d(idx1) < pop.get_crowding_d(idx2)) return idx2;
+	if (a.pareto_rank[idx1] < a.pareto_rank[idx2]) return idx1;
+	if (a.pareto_rank[idx1] > a.pareto_rank[idx2]) return idx2;
+	if (a.crowding_d[idx1] > a.crowding_d[idx2]) return idx1;
+	if (a.crowding_d[idx1] < a.crowding_d[idx2]) return idx2;
 	return ((m_drng() > 0.5) ? idx1 : idx2);
 }
 
-void nsga2::crossover(decision_vector& child1, decision_vector& child2, pagmo::population::size_type parent1_idx, pagmo::population::size_type parent2_idx,const pagmo::population& pop) const
+void nsga2::crossover(decision_vector& child1, decision_vector& child2, const decision_vector& parent1, const decision_vector& parent2, const problem::base& prob) const
 {
 
-		problem::base::size_type D = pop.problem().get_dimension();
-		problem::base::size_type Di = pop.problem().get_i_dimension();
+		problem::base::size_type D = prob.get_dimension();
+		problem::base::size_type Di = prob.get_i_dimension();
 		problem::base::size_type Dc = D - Di;
-	const decision_vector &lb = pop.problem().get_lb(), &ub = pop.problem().get_ub();
-	const decision_vector& parent1 = pop.get_individual(parent1_idx).cur_x;
-	const decision_vector& parent2 = pop.get_individual(parent2_idx).cur_x;
+	const decision_vector &lb = prob.get_lb(), &ub = prob.get_ub();
 	double y1,y2,yl,yu, rand, beta, alpha, betaq, c1, c2;
 	child1 = parent1;
 	child2 = parent2;
@@ -181,13 +180,13 @@ void nsga2::crossover(decision_vector& child1, decision_vector& child2, pagmo::p
 	}
 }
 
-void nsga2::mutate(decision_vector& child, const pagmo::population& pop) const
+void nsga2::mutate(decision_vector& child, const problem::base& prob) const
 {
 
-	problem::base::size_type D = pop.problem().get_dimension();
-		problem::base::size_type Di = pop.problem().get_i_dimension();
+	problem::base::size_type D = prob.get_dimension();
+		problem::base::size_type Di = prob.get_i_dimension();
 		problem::base::size_type Dc = D - Di;
-	const decision_vector &lb = pop.problem().get_lb(), &ub = pop.problem().get_ub();
+	const decision_vector &lb = prob.get_lb(), &ub = prob.get_ub();
 	double rnd, delta1, delta2, mut_pow, deltaq;
 	double y, yl, yu, val, xy;
 		int gen_num;
@@ -235,6 +234,99 @@ void nsga2::mutate(decision_vector& child, const pagmo::population& pop) const
 		 }
 	  }
 }
+// Sorts the first n slots of the arena in nondominated fronts, computing the Pareto rank and the crowding distance of the
+// individuals. The sorting stops as soon as at least n_needed individuals have been assigned to a front.
+void nsga2::sort_arena(arena& a, const problem::base& prob, const population::size_type n, const population::size_type n_needed) const
+{
+	// Domination lists and counts: each pair is visited once, as domination is asymmetric.
+	for (population::size_type i = 0; i < n; ++i) {
+		a.dom_list[i].clear();
+		a.dom_count[i] = 0;
+	}
+	for (population::size_type i = 0; i < n; ++i) {
+		for (population::size_type j = i + 1; j < n; ++j) {
+			if (prob.compare_fc(a.f[i],a.c[i],a.f[j],a.c[j])) {
+				a.dom_list[i].push_back(j);
+				a.dom_count[j]++;
+			} else if (prob.compare_fc(a.f[j],a.c[j],a.f[i],a.c[i])) {
+				a.dom_list[j].push_back(i);
+				a.dom_count[i]++;
+			}
+		}
+	}
+	// 1 - Find the first Pareto front
+	a.n_fronts = 0;
+	a.fronts[0].clear();
+	for (population::size_type i = 0; i < n; ++i) {
+		if (a.dom_count[i] == 0) {
+			a.fronts[0].push_back(i);
+			a.pareto_rank[i] = 0;
+		}
+	}
+	population::size_type n_sorted = 0;
+	// We loop to find subsequent fronts, using dom_count as a countdown
+	while (!a.fronts[a.n_fronts].empty()) {
+		const std::vector<population::size_type> &F = a.fronts[a.n_fronts];
+		update_crowding_d(a,F);
+		n_sorted += F.size();
+		++a.n_fronts;
+		if (n_sorted >= n_needed) {
+			break;
+		}
+		std::vector<population::size_type> &S = a.fronts[a.n_fronts];
+		S.clear();
+		for (population::size_type i = 0; i < F.size(); ++i) {
+			for (population::size_type j = 0; j < a.dom_list[F[i]].size(); ++j) {
+				const population::size_type idx = a.dom_list[F[i]][j];
+				if (--a.dom_count[idx] == 0) {
+					S.push_back(idx);
+					a.pareto_rank[idx] = a.n_fronts;
+				}
+			}
+		}
+	}
+}
+
+// Computes the crowding distance of the individuals of the front I.
+void nsga2::update_crowding_d(arena& a, const std::vector<population::size_type>& I) const
+{
+	const population::size_type lastidx = I.size() - 1;
+	for (population::size_type j = 0; j < I.size(); ++j) {
+		a.crowding_d[I[j]] = 0;
+	}
+	// The front is sorted along each fitness component in a scratch copy, kept in the last, unused, front.
+	std::vector<population::size_type> &P = a.fronts.back();
+	P = I;
+	one_dim_fit_comp funct(a.f,0);
+	for (fitness_vector::size_type i = 0; i < a.f[I[0]].size(); ++i) {
+		funct.m_dim = i;
+		std::sort(P.begin(),P.end(),funct);
+		// assign Inf to the boundaries
+		a.crowding_d[P[0]] = std::numeric_limits<double>::max();
+		a.crowding_d[P[lastidx]] = std::numeric_limits<double>::max();
+		//and compute the crowding distance
+		const double df = a.f[P[lastidx]][i] - a.f[P[0]][i];
+		if (df == 0.0) {
+			// handles the case in which the pareto front collapses to one single point
+			// avoiding creation of nans that can't be serialized
+			continue;
+		}
+		for (population::size_type j = 1; j < lastidx; ++j) {
+			a.crowding_d[P[j]] += (a.f[P[j+1]][i] - a.f[P[j-1]][i])/df;
+		}
+	}
+}
+
+// Swaps the individuals in the slots i and j of the arena.
+void nsga2::swap_slots(arena& a, const population::size_type i, const population::size_type j) const
+{
+	a.x[i].swap(a.x[j]);
+	a.f[i].swap(a.f[j]);
+	a.c[i].swap(a.c[j]);
+	std::swap(a.pareto_rank[i],a.pareto_rank[j]);
+	std::swap(a.crowding_d[i],a.crowding_d[j]);
+}
+
 /// Evolve implementation.
 /**
  * Run the NSGA-II algorithm for the number of generations specified in the constructors.
@@ -269,9 +361,30 @@ void nsga2::evolve(population &pop) const
 		return;
 	}
 
-	std::vector<population::size_type> best_idx(NP), shuffle1(NP),shuffle2(NP);
+	std::vector<population::size_type> shuffle1(NP),shuffle2(NP);
 	population::size_type parent1_idx, parent2_idx;
-	decision_vector child1(D), child2(D);
+
+	// The parents occupy the first NP slots of the arena, the offspring the last NP slots.
+	arena a;
+	a.x.resize(2*NP);
+	a.f.resize(2*NP);
+	a.c.resize(2*NP);
+	a.pareto_rank.resize(2*NP);
+	a.crowding_d.resize(2*NP);
+	a.dom_list.resize(2*NP);
+	a.dom_count.resize(2*NP);
+	// At most 2NP fronts, plus one scratch vector for the crowding distance.
+	a.fronts.resize(2*NP + 1);
+	for (population::size_type i=0; i < NP; ++i) {
+		a.x[i] = pop.get_individual(i).cur_x;
+		a.f[i] = pop.get_individual(i).cur_f;
+		a.c[i] = pop.get_individual(i).cur_c;
+	}
+	std::vector<decision_vector> offspring(NP,decision_vector(D));
+	std::vector<fitness_vector> offspring_f;
+	std::vector<constraint_vector> offspring_c;
+	// The slots of the survivors
+	std::vector<char> survives(2*NP);
 
 	for (pagmo::population::size_type i=0; i< NP; i++) shuffle1[i] = i;
 	for (pagmo::population::size_type i=0; i< NP; i++) shuffle2[i] = i;
@@ -279,13 +392,11 @@ void nsga2::evolve(population &pop) const
 	boost::uniform_int<int> pop_idx(0,NP-1);
 	boost::variate_generator<boost::mt19937 &, boost::uniform_int<int> > p_idx(m_urng,pop_idx);
 
+	// We compute the crowding distance and the pareto rank of the parents
+	sort_arena(a,prob,NP,NP);
+
 	// Main NSGA-II loop
 	for (int g = 0; g<m_gen; g++) {
-		//At each generation we make a copy of the population into popnew
-		// We compute the crowding distance and the pareto rank of pop
-		pop.update_pareto_information();
-		population popnew(pop);
-
 		//We create some pseudo-random permutation of the poulation indexes
 		std::random_shuffle(shuffle1.begin(),shuffle1.end(),p_idx);
 		std::random_shuffle(shuffle2.begin(),shuffle2.end(),p_idx);
@@ -294,32 +405,66 @@ void nsga2::evolve(population &pop) const
 		//each create 2 new offspring
 		for (pagmo::population::size_type i=0; i< NP; i+=4) {
 			// We create two offsprings using the shuffled list 1
-			parent1_idx = tournament_selection(shuffle1[i], shuffle1[i+1],pop);
-			parent2_idx = tournament_selection(shuffle1[i+2], shuffle1[i+3],pop);
-			crossover(child1, child2, parent1_idx,parent2_idx,pop);
-			mutate(child1,pop);
-			mutate(child2,pop);
-			popnew.push_back(child1);
-			popnew.push_back(child2);
+			parent1_idx = tournament_selection(shuffle1[i], shuffle1[i+1],a);
+			parent2_idx = tournament_selection(shuffle1[i+2], shuffle1[i+3],a);
+			crossover(offspring[i], offspring[i+1], a.x[parent1_idx],a.x[parent2_idx],prob);
+			mutate(offspring[i],prob);
+			mutate(offspring[i+1],prob);
 
 			// We repeat with the shuffled list 2
-			parent1_idx = tournament_selection(shuffle2[i], shuffle2[i+1],pop);
-			parent2_idx = tournament_selection(shuffle2[i+2], shuffle2[i+3],pop);
-			crossover(child1, child2, parent1_idx,parent2_idx,pop);
-			mutate(child1,pop);
-			mutate(child2,pop);
-			popnew.push_back(child1);
-			popnew.push_back(child2);
-		} // popnew now contains 2NP individuals
-
-		// This method returns the sorted N best individuals in the population according to the crowded comparison operator
-		// defined in population.cpp
-		best_idx = popnew.get_best_idx(NP);
-		// We completely cancel the population (NOTE: memory of all individuals and the notion of
-		// champion is thus destroyed)
-		pop.clear();
-		for (population::size_type i=0; i < NP; ++i) pop.push_back(popnew.get_individual(best_idx[i]).cur_x);
-	} // end of main SGA loop
+			parent1_idx = tournament_selection(shuffle2[i], shuffle2[i+1],a);
+			parent2_idx = tournament_selection(shuffle2[i+2], shuffle2[i+3],a);
+			crossover(offspring[i+2], offspring[i+3], a.x[parent1_idx],a.x[parent2_idx],prob);
+			mutate(offspring[i+2],prob);
+			mutate(offspring[i+3],prob);
+		}
+		// The NP offspring are evaluated all at once, and moved to the last NP slots of the arena
+		prob.objfun_batch(offspring_f,offspring);
+		prob.compute_constraints_batch(offspring_c,offspring);
+		for (population::size_type i=0; i < NP; ++i) {
+			a.x[NP + i].swap(offspring[i]);
+			a.f[NP + i].swap(offspring_f[i]);
+			a.c[NP + i].swap(offspring_c[i]);
+		}
+
+		// The 2NP individuals are sorted until the fronts contain NP of them. The fronts
+		// are selected in order, and the last one is truncated according to the crowding distance.
+		sort_arena(a,prob,2*NP,NP);
+		std::fill(survives.begin(),survives.end(),0);
+		population::size_type n_survivors = 0;
+		for (std::vector<population::size_type>::size_type k = 0; k < a.n_fronts; ++k) {
+			std::vector<population::size_type> &F = a.fronts[k];
+			if (n_survivors + F.size() > NP) {
+				std::sort(F.begin(),F.end(),crowding_d_comp(a.crowding_d));
+				F.resize(NP - n_survivors);
+			}
+			for (population::size_type i=0; i < F.size(); ++i) {
+				survives[F[i]] = 1;
+			}
+			n_survivors += F.size();
+		}
+		// The survivors among the offspring replace the discarded parents
+		population::size_type j = NP;
+		for (population::size_type i=0; i < NP; ++i) {
+			if (!survives[i]) {
+				while (!survives[j]) ++j;
+				swap_slots(a,i,j);
+				++j;
+			}
+		}
+	} // end of main NSGA-II loop
+
+	// We completely cancel the population (NOTE: memory of all individuals and the notion of
+	// champion is thus destroyed) and insert the survivors, whose fitness is known.
+	// The domination information is needed only after all the individuals have been inserted:
+	// it is thus recomputed lazily, in a single pass.
+	const population::dom_update_type dom_update = pop.get_dom_update();
+	pop.set_dom_update(population::LAZY_DOM);
+	pop.clear();
+	for (population::size_type i=0; i < NP; ++i) {
+		pop.push_back(a.x[i],a.f[i],a.c[i]);
+	}
+	pop.set_dom_update(dom_update);
 }
 
 /// Algorithm name
@@ -25,8 +25,13 @@
 #ifndef PAGMO_ALGORITHM_NSGA2_H
 #define PAGMO_ALGORITHM_NSGA2_H
 
+#include <vector>
+
 #include "../config.h"
+#include "../population.h"
+#include "../problem/base.h"
 #include "../serialization.h"
+#include "../types.h"
 #include "base.h"
 
 
@@ -40,6 +45,11 @@ namespace pagmo { namespace algorithm {
  *
  * The algorithm can be applied to continuous box-bounded optimization. The version for mixed integer
  * and constrained optimization is also planned.
+ *
+ * The parents and the offspring of a generation are kept in a buffer allocated once per call to evolve() and reused across generations.
+ * The offspring of a generation are evaluated in a single call to problem::base::objfun_batch(), which runs in parallel if the problem
+ * has a thread pool (see problem::base::set_thread_pool()). The parents and the offspring are sorted once per generation: as in the
+ * reference implementation of Deb, the survivors keep the Pareto rank and the crowding distance computed in the combined population.
  * 
  * @see Deb, K. and Pratap, A. and Agarwal, S. and Meyarivan, T., "A fast and elitist multiobjective genetic algorithm: NSGA-II"
  *
@@ -58,9 +68,45 @@ protected:
 	std::string human_readable_extra() const;
 	
 private:
-	pagmo::population::size_type tournament_selection(pagmo::population::size_type, pagmo::population::size_type, const pagmo::population&) const;
-	void crossover(decision_vector&, decision_vector&, pagmo::population::size_type, pagmo::population::size_type,const pagmo::population&) const;
-	void mutate(decision_vector&, const pagmo::population&) const;
+	// Parents and offspring of a generation, stored in 2NP slots allocated once and reused across generations
+	struct arena {
+		std::vector<decision_vector> x;
+		std::vector<fitness_vector> f;
+		std::vector<constraint_vector> c;
+		std::vector<population::size_type> pareto_rank;
+		std::vector<double> crowding_d;
+		// scratch space of the nondominated sorting
+		std::vector<std::vector<population::size_type> > dom_list;
+		std::vector<population::size_type> dom_count;
+		std::vector<std::vector<population::size_type> > fronts;
+		std::vector<population::size_type>::size_type n_fronts;
+	};
+
+	struct one_dim_fit_comp {
+		one_dim_fit_comp(const std::vector<fitness_vector> &fit, fitness_vector::size_type dim):m_fit(fit),m_dim(dim){};
+		bool operator()(const population::size_type& idx1, const population::size_type& idx2) const
+		{
+			return m_fit[idx1][m_dim] < m_fit[idx2][m_dim];
+		}
+		const std::vector<fitness_vector>& m_fit;
+		fitness_vector::size_type m_dim;
+	};
+
+	struct crowding_d_comp {
+		crowding_d_comp(const std::vector<double> &crowding_d):m_crowding_d(crowding_d){};
+		bool operator()(const population::size_type& idx1, const population::size_type& idx2) const
+		{
+			return m_crowding_d[idx1] > m_crowding_d[idx2];
+		}
+		const std::vector<double> &m_crowding_d;
+	};
+
+	pagmo::population::size_type tournament_selection(pagmo::population::size_type, pagmo::population::size_type, const arena&) const;
+	void crossover(decision_vector&, decision_vector&, const decision_vector&, const decision_vector&, const problem::base&) const;
+	void mutate(decision_vector&, const problem::base&) const;
+	void sort_arena(arena&, const problem::base&, const population::size_type, const population::size_type) const;
+	void update_crowding_d(arena&, const std::vector<population::size_type>&) const;
+	void swap_slots(arena&, const population::size_type, const population::size_type) const;
 	
 	friend class boost::serialization::access;
 	template <class Archive>
@@ -191,6 +191,8 @@ void pso::evolve(population &pop) const
 	
 	double r1 = 0.0;
 	double r2 = 0.0;
+	// uniform draws of the velocity update of a particle, drawn as a block in the order of the original loops
+	std::vector<double> r;
 	
 	/* --- Main PSO loop ---
 	 */
@@ -212,10 +214,9 @@ void pso::evolve(population &pop) const
 			/*-------PSO canonical (with inertia weight) ---------------------------------------------*/
 			/*-------Original algorithm used in PaGMO paper-------------------------------------------*/
 			if( m_variant == 1 ){
+				fill_uniform( r, 2 * Dc );
 				for( d = 0; d < Dc; d++ ){
-					r1 = m_drng();
-					r2 = m_drng();
-					V[p][d] = m_omega * V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d]) + m_eta2 * r2 * (best_neighb[d] - X[p][d]);
+					V[p][d] = m_omega * V[p][d] + m_eta1 * r[2 * d] * (lbX[p][d] - X[p][d]) + m_eta2 * r[2 * d + 1] * (best_neighb[d] - X[p][d]);
 				}
 			}
 			
@@ -223,9 +224,9 @@ void pso::evolve(population &pop) const
 			/*-------and with equal random weights of social and cognitive components-----------------*/
 			/*-------Check with Rastrigin-------------------------------------------------------------*/
 			else if( m_variant == 2 ){
+				fill_uniform( r, Dc );
 				for( d = 0; d < Dc; d++ ){
-					r1 = m_drng();
-					V[p][d] = m_omega * V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d]) + m_eta2 * r1 * (best_neighb[d] - X[p][d]);
+					V[p][d] = m_omega * V[p][d] + m_eta1 * r[d] * (lbX[p][d] - X[p][d]) + m_eta2 * r[d] * (best_neighb[d] - X[p][d]);
 				}
 			}
 			
@@ -263,10 +264,9 @@ void pso::evolve(population &pop) const
 			 *  This being the canonical PSO of today, this variant is set as the default in PaGMO.
 			 *-------------------------------------------------------------------------------------*/
 			else if( m_variant == 5 ){
+				fill_uniform( r, 2 * Dc );
 				for( d = 0; d < Dc; d++ ){
-					r1 = m_drng();
-					r2 = m_drng();
-					V[p][d] = m_omega * ( V[p][d] + m_eta1 * r1 * (lbX[p][d] - X[p][d]) + m_eta2 * r2 * (best_neighb[d] - X[p][d]) );
+					V[p][d] = m_omega * ( V[p][d] + m_eta1 * r[2 * d] * (lbX[p][d] - X[p][d]) + m_eta2 * r[2 * d + 1] * (best_neighb[d] - X[p][d]) );
 				}
 			}
 			
@@ -281,10 +281,11 @@ void pso::evolve(population &pop) const
 			 *  [Mendes et al., 2004] http://dx.doi.org/10.1109/TEVC.2004.826074
 			 *-------------------------------------------------------------------------------------*/
 			else if( m_variant == 6 ){
+				fill_uniform( r, Dc * neighb[p].size() );
 				for( d = 0; d < Dc; d++ ){
 					sum_forces = 0.0;
 					for( n = 0; n < neighb[p].size(); n++ )
-						sum_forces += m_drng() * acceleration_coefficient * ( lbX[ neighb[p][n] ][d] - X[p][d] );
+						sum_forces += r[d * neighb[p].size() + n] * acceleration_coefficient * ( lbX[ neighb[p][n] ][d] - X[p][d] );
 					
 					V[p][d] = m_omega * ( V[p][d] + sum_forces / neighb[p].size() );
 				}
@@ -141,6 +141,11 @@ void pso_generational::evolve(population &pop) const
 	std::vector<fitness_vector>  lbfit(swarm_size);		// particles' fitness values at their previous best positions
 
 
+	std::vector<population::size_type> particle_idx(swarm_size);	// indexes of all the particles, used for batch evaluations
+	for( population::size_type i = 0; i < swarm_size; i++ ){
+		particle_idx[i] = i;
+	}
+
 	std::vector< std::vector<int> > neighb(swarm_size);	// swarm topology (iterators over indexes of each particle's neighbors in the swarm)
 
 	decision_vector best_neighb(Dc);			// search space position of particles' best neighbor
@@ -336,15 +341,15 @@ void pso_generational::evolve(population &pop) const
 			dynamic_cast<const pagmo::problem::base_stochastic &>(prob).set_seed(m_urng());
 			pop.clear(); // Removes memory based on different seeds (champion and best_x, best_f, best_c)
 
-			// Re-evaluate wrt new seed the particle position and memory
+			// Re-evaluate wrt new seed the particle memory and position, the whole swarm at once.
+			// We now set the cleared pop. cur_x is the best_x, re-evaluated with new seed.
+			pop.push_back_batch(lbX);
+			for( p = 0; p < swarm_size; p++ ){
+				lbfit[p] = pop.get_individual(p).cur_f;
+			}
+			pop.set_x_batch(particle_idx,X);
 			for( p = 0; p < swarm_size; p++ ){
-				// We evaluate here the new individual fitness
-				prob.objfun( fit[p], X[p] );
-				// We re-evaluate the fitness of the particle memory
-				prob.objfun( lbfit[p], lbX[p] );
-				///We now set the cleared pop. cur_x is the best_x, re-evaluated with new seed.
-				pop.push_back(lbX[p]);
-				pop.set_x(p,X[p]);
+				fit[p] = pop.get_individual(p).cur_f;
 				pop.set_v(p,V[p]);
 			}
 			//UPDATE BEST_FIT and BEST to account for the new seed
@@ -360,11 +365,10 @@ void pso_generational::evolve(population &pop) const
 		}
 		catch (const std::bad_cast& e)
 		{
-			//Only evaluate new position
+			//Only evaluate new position, the whole swarm at once
+			pop.set_x_batch(particle_idx,X);
 			for( p = 0; p < swarm_size; p++ ){
-				// We evaluate here the new individual fitness
-				prob.objfun( fit[p], X[p] );
-				pop.set_x(p,X[p]);
+				fit[p] = pop.get_individual(p).cur_f;
 				pop.set_v(p,V[p]);
 			}
 		}
@@ -130,6 +130,9 @@ void sga::evolve(population &pop) const
 	std::vector<double> selectionfitness(NP), cumsum(NP), cumsumTemp(NP);
 	std::vector <int> selection(NP);
 
+	std::vector<double> draws(NP), deltas;			//blocks of random variates
+	std::vector<pagmo::population::size_type> mutated;	//individuals hit by the mutation
+
 	int tempID;
 	std::vector<int> fitnessID(NP);
 
@@ -192,9 +195,9 @@ void sga::evolve(population &pop) const
 			}
 
 			//we throw a dice and pick up the corresponding index
-			double r2;
+			fill_uniform(draws,NP);
 			for (pagmo::population::size_type i = 0; i < NP; i++) {
-				r2 = m_drng();
+				const double r2 = draws[i];
 				for (pagmo::population::size_type j = 0; j < NP; j++) {
 					if (cumsum[j] > r2) {
 						selection[i]=j;
@@ -229,8 +232,9 @@ void sga::evolve(population &pop) const
 					//0 - binomial crossover
 				case crossover::BINOMIAL: {
 					size_t n = boost::uniform_int<int>(0,D-1)(m_urng);
+					fill_uniform(draws,D);
 					for (size_t L = 0; L < D; ++L) { /* perform D binomial trials */
-						if ((m_drng() < m_cr) || L + 1 == D) { /* change at least one parameter */
+						if ((draws[L] < m_cr) || L + 1 == D) { /* change at least one parameter */
 							member1[n] = member2[n];
 						}
 						n = (n+1)%D;
@@ -254,26 +258,25 @@ void sga::evolve(population &pop) const
 		//3 - Mutation
 		switch (m_mut.m_type) {
 		case mutation::GAUSSIAN: {
-			boost::normal_distribution<double> dist;
-			boost::variate_generator<boost::lagged_fibonacci607 &, boost::normal_distribution<double> > delta(m_drng,dist);
-			for (pagmo::problem::base::size_type k = 0; k < Dc;k++) { //for each continuous variable
+			// For each variable, the individuals to mutate are drawn first, then their perturbations as a single block.
+			for (pagmo::problem::base::size_type k = 0; k < D;k++) { //for each variable
 				double std = (ub[k]-lb[k]) * m_mut.m_width;
+				fill_uniform(draws,NP);
+				mutated.clear();
 				for (pagmo::population::size_type i = 0; i < NP;i++) { //for each individual
-					if (m_drng() < m_m) {
-						double mean = Xnew[i][k];
-						double tmp = (delta() * std + mean);
-						if ( (tmp < ub[k]) &&  (tmp > lb[k]) ) Xnew[i][k] = tmp;
+					if (draws[i] < m_m) {
+						mutated.push_back(i);
 					}
 				}
-			}
-			for (pagmo::problem::base::size_type k = Dc; k < D;k++) { //for each integer variable
-				double std = (ub[k]-lb[k]) * m_mut.m_width;
-				for (pagmo::population::size_type i = 0; i < NP;i++) { //for each individual
-					if (m_drng() < m_m) {
-						double mean = Xnew[i][k];
-						double tmp = boost::math::iround(delta() * std + mean);
-						if ( (tmp < ub[k]) &&  (tmp > lb[k]) ) Xnew[i][k] = tmp;
+				fill_normal(deltas,mutated.size());
+				for (std::vector<pagmo::population::size_type>::size_type m = 0; m < mutated.size(); ++m) {
+					const pagmo::population::size_type i = mutated[m];
+					double mean = Xnew[i][k];
+					double tmp = deltas[m] * std + mean;
+					if (k >= Dc) { //integer variable
+						tmp = boost::math::iround(tmp);
 					}
+					if ( (tmp < ub[k]) &&  (tmp > lb[k]) ) Xnew[i][k] = tmp;
 				}
 			}
 			break;
@@ -46,6 +46,9 @@ namespace pagmo { namespace algorithm {
  * The algorithm works on single objective, box constrained problems. The mutation operator acts
  * differently on continuous and discrete variables.
  *
+ * The gaussian mutation selects, for each variable, the individuals to mutate before drawing their perturbations,
+ * hence seeded runs do not reproduce the results of the versions of PaGMO drawing them one individual at a time.
+ *
  * @author Dario Izzo (dario.izzo@googlemail.com)
  *
  */
@@ -27,6 +27,7 @@
 #include <boost/random/variate_generator.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/math/special_functions/round.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -35,6 +36,7 @@
 #include "../population.h"
 #include "../problem/base.h"
 #include "../types.h"
+#include "../util/hv_contribution_tracker.h"
 #include "base.h"
 #include "sms_emoa.h"
 
@@ -282,14 +284,20 @@ void sms_emoa::mutate(decision_vector& child, const pagmo::population& pop) cons
 	}
 }
 
-// Find the index of the least contributing individual
-population::size_type sms_emoa::evaluate_s_metric_selection(const population & pop) const
+// Find the index of the least contributing individual. While the whole population forms a single front, the contributions are
+// kept in the tracker across generations, ids holding the tracker id of each individual.
+population::size_type sms_emoa::evaluate_s_metric_selection(const population & pop, boost::scoped_ptr<util::hv_contribution_tracker> &tracker,
+	std::vector<util::hv_contribution_tracker::id_type> &ids) const
 {
 
 	std::vector< std::vector< population::size_type> > fronts = pop.compute_pareto_fronts();
 
 	const std::vector< population::size_type> &last_front = fronts.back();
 
+	if (fronts.size() > 1) {
+		tracker.reset();
+	}
+
 	if (last_front.size() == 1) {
 		return last_front[0];
 	}
@@ -306,6 +314,25 @@ population::size_type sms_emoa::evaluate_s_metric_selection(const population & p
 		pagmo::util::hypervolume hypvol(points);
 		fitness_vector r = hypvol.get_nadir_point(1.0);
 
+		// Single front, 2 to 4 objectives and automatic choice of the algorithm: update the tracker with the new individual (the last one),
+		// unless the reference point has moved.
+		if (fronts.size() == 1 && r.size() <= 4 && !m_hv_algorithm) {
+			if (tracker && tracker->get_reference_point() == r && ids.size() + 1 == points.size()) {
+				ids.push_back(tracker->insert(points.back()));
+			} else {
+				tracker.reset(new util::hv_contribution_tracker(points, r));
+				ids.resize(points.size());
+				for (population::size_type idx = 0 ; idx < ids.size() ; ++idx) {
+					ids[idx] = idx;
+				}
+			}
+			const util::hv_contribution_tracker::id_type least_id = tracker->least_contributor();
+			const population::size_type least_idx = std::find(ids.begin(), ids.end(), least_id) - ids.begin();
+			tracker->erase(least_id);
+			ids.erase(ids.begin() + least_idx);
+			return last_front[least_idx];
+		}
+
 		population::size_type least_idx;
 
 		if (m_hv_algorithm) {
@@ -361,6 +388,9 @@ void sms_emoa::evolve(population &pop) const
 	
 	population::size_type parent1_idx, parent2_idx;
 	decision_vector child1(D), child2(D);
+	// Hypervolume contributions of the population, kept across generations.
+	boost::scoped_ptr<util::hv_contribution_tracker> tracker;
+	std::vector<util::hv_contribution_tracker::id_type> ids;
 	
 	// Main SMS-EMOA loop
 	for (int g = 0; g < m_gen; g++) {
@@ -372,7 +402,7 @@ void sms_emoa::evolve(population &pop) const
 		++m_fevals;
 		mutate(child1, pop);
 		pop.push_back(child1);
-		pop.erase(evaluate_s_metric_selection(pop));
+		pop.erase(evaluate_s_metric_selection(pop, tracker, ids));
 	}
 }
 
@@ -25,10 +25,14 @@
 #ifndef PAGMO_ALGORITHM_SMS_EMOA_H
 #define PAGMO_ALGORITHM_SMS_EMOA_H
 
+#include <boost/scoped_ptr.hpp>
+#include <vector>
+
 #include "base.h"
 #include "../config.h"
 #include "../serialization.h"
 #include "../util/hypervolume.h"
+#include "../util/hv_contribution_tracker.h"
 
 
 namespace pagmo { namespace algorithm {
@@ -37,6 +41,9 @@ namespace pagmo { namespace algorithm {
 /**
  * SMS-EMOA is a S-metric (hypervolume indicator) based evolutionary algorithm.
  *
+ * For problems with 2 to 4 objectives, when the whole population is non-dominated and no hypervolume algorithm was chosen by the user,
+ * the exclusive contributions are kept in a pagmo::util::hv_contribution_tracker, which updates them incrementally as individuals are added and removed.
+ *
  * @see Nicola Beume, Boris Naujoks, Michael Emmerich, "SMS-EMOA: Multiobjective selection based on dominated hypervolume"
  *
  * @author Krzysztof Nowak kn@kiryx.net
@@ -60,7 +67,8 @@ private:
 	void validate_parameters();
 	void crossover(decision_vector&, decision_vector&, pagmo::population::size_type, pagmo::population::size_type,const pagmo::population&) const;
 	void mutate(decision_vector&, const pagmo::population&) const;
-	population::size_type evaluate_s_metric_selection(const population & pop) const;
+	population::size_type evaluate_s_metric_selection(const population &, boost::scoped_ptr<util::hv_contribution_tracker> &,
+		std::vector<util::hv_contribution_tracker::id_type> &) const;
 	
 	friend class boost::serialization::access;
 	template <class Archive>
@@ -168,49 +168,16 @@ void spea2::evolve(population &pop) const
 		//2 - Fill the archive (Environmental selection)
 		if(n_non_dominated > archive_size) { //truncate according to delta
 
-			archive = std::vector<spea2_individual>(n_non_dominated,spea2_individual());
-			for(unsigned int i = 0; i < n_non_dominated; ++i) {
-				archive[i] = new_pop[ordered_by_fitness[i]];
-			}
-
 			//fitness vector of the non-dominated individuals
 			std::vector<fitness_vector> fit_nd(n_non_dominated);
 			for ( population::size_type i = 0; i<n_non_dominated; i++ ) {
-				fit_nd[i]	=	archive[i].f;
+				fit_nd[i]	=	new_pop[ordered_by_fitness[i]].f;
 			}
 
-			//computing K-NN distances for K=0,...,n_non_dominated
-			std::vector<std::vector<pagmo::population::size_type> > neighbours_nd;
-			pagmo::util::neighbourhood::euclidian::compute_neighbours(neighbours_nd, fit_nd);
-			std::vector<population::size_type> rv(n_non_dominated);
-			for(unsigned int i=0; i<n_non_dominated; ++i) rv[i] = i;
-
-			while(archive.size() > archive_size) {
-
-				//Calculate which is the worst element according to the distance sorter
-				pagmo::population::size_type idx_to_delete = *(std::max_element(rv.begin(), rv.end(), distance_sorter(neighbours_nd, fit_nd)));
-
-				//Remove the element from rv, archive and fit_nd
-				rv.erase(rv.end()-1);
-				archive.erase(archive.begin() + idx_to_delete);
-				fit_nd.erase(fit_nd.begin() + idx_to_delete);
-
-				//Remove the row of neighbours_nd coresponding to idx_to_delete
-				neighbours_nd.erase(neighbours_nd.begin() + idx_to_delete);
-
-				for(unsigned int i=0; i < neighbours_nd.size(); ++i) {
-					for(unsigned int j=0; j < neighbours_nd[i].size(); ++j) {
-						//Remove all the occurencies of idx_to_delete
-						if (neighbours_nd[i][j] == idx_to_delete) {
-							neighbours_nd[i].erase(neighbours_nd[i].begin() + j);
-							j--;
-						//Adjust all the indexes after idx_to_delete
-						} else if (neighbours_nd[i][j] > idx_to_delete) {
-							neighbours_nd[i][j]--;
-						}
-					}
-				}
-
+			const std::vector<population::size_type> kept = truncate(fit_nd, archive_size);
+			archive.resize(archive_size);
+			for(unsigned int i = 0; i < archive_size; ++i) {
+				archive[i] = new_pop[ordered_by_fitness[kept[i]]];
 			}
 
 		} else { //fill with the best dominated individuals
@@ -321,11 +288,15 @@ std::vector<std::vector<population::size_type> > spea2::compute_domination_list(
 	std::vector<population::size_type> dummy;
 	std::vector<std::vector<population::size_type> > domination_list(fit.size(), dummy);
 
+	// Each pair is visited once. As domination is asymmetric, the reverse comparison is
+	// needed only when the first one fails.
 	for(unsigned int i=0; i<fit.size();++i) {
-		for(unsigned int j=0; j<fit.size(); ++j) {
-			// Check if individual in position i dominates individual in position n.
+		for(unsigned int j=i+1; j<fit.size(); ++j) {
+			// Check if individual in position i dominates individual in position j, or vice versa.
 			if(prob.compare_fc(fit[i],cons[i],fit[j],cons[j])) {
 				domination_list[i].push_back(j);
+			} else if(prob.compare_fc(fit[j],cons[j],fit[i],cons[i])) {
+				domination_list[j].push_back(i);
 			}
 		}
 	}
@@ -349,9 +320,6 @@ void spea2::compute_spea2_fitness(std::vector<double> &F,
 		fit[i]	=	pop[i].f;
 		cons[i]	=	pop[i].c;
 	}
-	std::vector<std::vector<pagmo::population::size_type> > neighbours;
-	pagmo::util::neighbourhood::euclidian::compute_neighbours(neighbours, fit);
-
 	std::vector<std::vector<population::size_type> > domination_list = compute_domination_list(prob, fit,cons);
 
 	for(unsigned int i=0; i<NP; ++i) {
@@ -366,9 +334,124 @@ void spea2::compute_spea2_fitness(std::vector<double> &F,
 		}
 	}
 
+	// The density is computed from the distance to the K-th nearest neighbour, which is selected
+	// among the squared distances without sorting them.
+	std::vector<double> distances(NP);
 	for(unsigned int i=0; i<NP; ++i) {
-		F[i] = F[i] +
-				(1.0 / (pagmo::util::neighbourhood::euclidian::distance(fit[i], fit[neighbours[i][K]]) + 2));
+		const fitness_vector &fi = fit[i];
+		for(unsigned int j=0; j<NP; ++j) {
+			const fitness_vector &fj = fit[j];
+			double d2 = 0.;
+			for(fitness_vector::size_type k = 0; k < fi.size(); ++k) {
+				d2 += (fi[k] - fj[k]) * (fi[k] - fj[k]);
+			}
+			distances[j] = d2;
+		}
+		std::nth_element(distances.begin(), distances.begin() + K, distances.end());
+		F[i] = F[i] + (1.0 / (std::sqrt(distances[K]) + 2));
+	}
+}
+
+// Computes the distances among the points fit. The lists of neighbours are initially unsorted.
+spea2::neighbour_lists::neighbour_lists(const std::vector<fitness_vector> &fit):
+	m_n(fit.size()), m_dist(fit.size() * fit.size(), 0.), m_lists(fit.size(), std::vector<population::size_type>(fit.size())), m_sorted(fit.size(), 0)
+{
+	for(population::size_type i = 0; i < m_n; ++i) {
+		for(population::size_type j = i + 1; j < m_n; ++j) {
+			m_dist[i * m_n + j] = m_dist[j * m_n + i] = pagmo::util::neighbourhood::euclidian::distance(fit[i], fit[j]);
+		}
+		for(population::size_type j = 0; j < m_n; ++j) {
+			m_lists[i][j] = j;
+		}
+	}
+}
+
+// Returns the k-th nearest neighbour of i (i itself being among the nearest ones). Only the first k + 1 positions of the
+// list of i need to be sorted: the sorted part is doubled whenever needed.
+population::size_type spea2::neighbour_lists::get(const population::size_type i, const population::size_type k)
+{
+	if(k >= m_sorted[i]) {
+		const population::size_type new_sorted = std::min(m_n, std::max(k + 1, 2 * m_sorted[i] + 8));
+		std::vector<population::size_type> &list = m_lists[i];
+		// The unsorted part holds the farthest points, so that the sorted part can be extended by sorting it
+		std::partial_sort(list.begin() + m_sorted[i], list.begin() + new_sorted, list.end(), distance_comp(&m_dist[i * m_n]));
+		m_sorted[i] = new_sorted;
+	}
+	return m_lists[i][k];
+}
+
+/// Truncation operator.
+/**
+ * Truncates a set of non dominated individuals, with fitness vectors fit, to archive_size individuals.
+ * The SPEA2 truncation operator removes, one at a time, the individual whose distances to the others, in ascending order,
+ * are lexicographically the smallest (the first one in case of ties). The distances are computed once, and each individual
+ * keeps the list of the others ordered by distance. Removed individuals are skipped when the lists are read, and each
+ * individual keeps track of the position of its nearest neighbour in its list, which only moves forward.
+ *
+ * @param[in] fit fitness vectors of the non dominated individuals.
+ * @param[in] archive_size number of individuals to retain.
+ *
+ * @return the positions in fit of the retained individuals, in ascending order.
+ */
+std::vector<population::size_type> spea2::truncate(const std::vector<fitness_vector> &fit, const population::size_type archive_size) const
+{
+	const population::size_type n = fit.size();
+	neighbour_lists neighbours(fit);
+	std::vector<char> alive(n, 1);
+	// nn[i] is the position in the list of i of the nearest alive neighbour of i
+	std::vector<population::size_type> nn(n, 0);
+	for(population::size_type i = 0; i < n; ++i) {
+		while(neighbours.get(i, nn[i]) == i) ++nn[i];
+	}
+
+	for(population::size_type n_alive = n; n_alive > archive_size; --n_alive) {
+		population::size_type worst = n;
+		for(population::size_type i = 0; i < n; ++i) {
+			if(alive[i] && (worst == n || truncation_less(i, worst, neighbours, alive, nn))) {
+				worst = i;
+			}
+		}
+		alive[worst] = 0;
+		for(population::size_type i = 0; i < n; ++i) {
+			if(alive[i] && n_alive > 2) {
+				while(!alive[neighbours.get(i, nn[i])] || neighbours.get(i, nn[i]) == i) ++nn[i];
+			}
+		}
+	}
+
+	std::vector<population::size_type> retval;
+	retval.reserve(archive_size);
+	for(population::size_type i = 0; i < n; ++i) {
+		if(alive[i]) {
+			retval.push_back(i);
+		}
+	}
+	return retval;
+}
+
+// Checks if the distances of the individual a to the other alive individuals, in ascending order, are lexicographically
+// smaller than those of the individual b.
+bool spea2::truncation_less(const population::size_type a, const population::size_type b, neighbour_lists &neighbours,
+			const std::vector<char> &alive, const std::vector<population::size_type> &nn) const
+{
+	const population::size_type n = neighbours.m_n;
+	population::size_type ia = nn[a], ib = nn[b];
+	// In most cases the nearest neighbours decide
+	const double da = neighbours.distance(a, neighbours.get(a, ia)), db = neighbours.distance(b, neighbours.get(b, ib));
+	if(da != db) {
+		return da < db;
+	}
+	for(++ia, ++ib;; ++ia, ++ib) {
+		while(ia < n && (!alive[neighbours.get(a, ia)] || neighbours.get(a, ia) == a)) ++ia;
+		while(ib < n && (!alive[neighbours.get(b, ib)] || neighbours.get(b, ib) == b)) ++ib;
+		// Both lists contain the same number of alive individuals
+		if(ia == n || ib == n) {
+			return false;
+		}
+		const double d1 = neighbours.distance(a, neighbours.get(a, ia)), d2 = neighbours.distance(b, neighbours.get(b, ib));
+		if(d1 != d2) {
+			return d1 < d2;
+		}
 	}
 }
 
@@ -32,36 +32,6 @@
 
 namespace pagmo { namespace algorithm {
 
-class  distance_sorter {
-public:
-	distance_sorter(const std::vector<std::vector<pagmo::population::size_type>  > &neighbours,
-					const std::vector<fitness_vector> &fit):
-		m_neighbours(neighbours),
-		m_fit(fit) {}
-	bool operator()(unsigned int a, unsigned int b) {
-		if(a>=m_fit.size() || a>=m_neighbours.size()){
-			pagmo_throw(value_error,"SPEA2 sorting of KNN values failure");
-		}
-		if(b>=m_fit.size() || b>=m_neighbours.size()){
-			pagmo_throw(value_error,"SPEA2 sorting of KNN values failure");
-		}
-		double delta_a, delta_b;
-		unsigned int i = 0;
-		do{
-			if(m_neighbours[b][i]>=m_fit.size() || m_neighbours[a][i]>=m_fit.size()){
-				pagmo_throw(value_error,"SPEA2 sorting of KNN values failure");
-			}
-			delta_a = pagmo::util::neighbourhood::euclidian::distance(m_fit[a], m_fit[m_neighbours[a][i]]);
-			delta_b = pagmo::util::neighbourhood::euclidian::distance(m_fit[b], m_fit[m_neighbours[b][i]]);
-			i++;
-		} while (i<m_neighbours[0].size() && delta_a == delta_b);
-		return delta_a > delta_b;
-	}
-private:
-	const std::vector<std::vector<pagmo::population::size_type>  > &m_neighbours;
-	const std::vector<fitness_vector> &m_fit;
-};
-
 /// "Strength Pareto Evolutionary Algorithm (SPEA2)"
 /**
  *
@@ -72,6 +42,10 @@ private:
  * The size of the archive is kept constant throughout the run by mean of a truncation operator taking into
  * consideration the distance of each individual to its closest neighbours.
  *
+ * The truncation operator computes the distances among the non dominated individuals once, and then removes the individuals
+ * one at a time skipping the removed ones in the lists of neighbours, so that archives of thousands of individuals can be truncated
+ * in about O(N^2) time rather than O(N^3).
+ *
  * @author Andrea Mambrini (andrea.mambrini@gmail.com)
  * @author Annalisa Riccardi (nina1983@gmail.com)
  *
@@ -84,6 +58,7 @@ public:
 	base_ptr clone() const;
 	void evolve(population &) const;
 	std::string get_name() const;
+	std::vector<population::size_type> truncate(const std::vector<fitness_vector> &, const population::size_type) const;
 
 protected:
 	std::string human_readable_extra() const;
@@ -105,6 +80,29 @@ private:
 	pagmo::population::size_type tournament_selection(pagmo::population::size_type, pagmo::population::size_type,
 													  const std::vector<population::size_type> &) const;
 	std::vector<population::size_type> compute_domination_count(const std::vector<std::vector<population::size_type> > &) const;
+	// Lists of the neighbours of a set of points, ordered by distance. Each list is sorted on demand, in chunks of growing size.
+	struct neighbour_lists {
+		neighbour_lists(const std::vector<fitness_vector> &);
+		population::size_type get(const population::size_type, const population::size_type);
+		double distance(const population::size_type i, const population::size_type j) const
+		{
+			return m_dist[i * m_n + j];
+		}
+		const population::size_type m_n;
+		std::vector<double> m_dist;
+		std::vector<std::vector<population::size_type> > m_lists;
+		std::vector<population::size_type> m_sorted;
+	};
+	struct distance_comp {
+		distance_comp(const double *row):m_row(row) {}
+		bool operator()(const population::size_type &a, const population::size_type &b) const
+		{
+			return m_row[a] < m_row[b];
+		}
+		const double *m_row;
+	};
+	bool truncation_less(const population::size_type, const population::size_type, neighbour_lists &,
+			const std::vector<char> &, const std::vector<population::size_type> &) const;
 	void crossover(decision_vector&, decision_vector&, pagmo::population::size_type, pagmo::population::size_type,
 				   const std::vector<spea2_individual> &, const pagmo::problem::base &) const;
 	void mutate(decision_vector&, const pagmo::problem::base&) const;
@@ -22,14 +22,20 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
+#include <boost/atomic.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/random/uniform_int.hpp>
 #include <boost/thread/barrier.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/thread.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/tuple/tuple_io.hpp>
 #include <boost/random/uniform_int.hpp>
 #include <boost/random/variate_generator.hpp>
+#include <boost/shared_ptr.hpp>
 #include <cstddef>
+#include <deque>
 #include <iostream>
 #include <iterator>
 #include <sstream>
@@ -58,6 +64,311 @@ void archipelago::check_migr_attributes() const
 	}
 }
 
+// Fixed-size pool of threads evolving the islands of the archipelago. Each task consists of a single evolution
+// of one island: when a task is completed, the island is put back at the end of the ready queue of the worker that
+// evolved it (so that islands tend to stay on the same thread), and idle workers steal ready islands from the queues
+// of the other workers. Migration happens within each task via pre_evolution() and post_evolution(), without any
+// global synchronisation point.
+struct archipelago::island_scheduler
+{
+	// Worker thread object.
+	struct worker
+	{
+		worker(island_scheduler *s, const std::size_t &idx):m_s(s),m_idx(idx) {}
+		void operator()()
+		{
+			m_s->run(m_idx);
+		}
+		island_scheduler	*m_s;
+		const std::size_t	m_idx;
+	};
+	// Decreases the count of running workers when a worker leaves run(), including when it is interrupted
+	// while waiting for a task in next_task().
+	struct running_guard
+	{
+		explicit running_guard(island_scheduler *s):m_s(s) {}
+		~running_guard()
+		{
+			lock_type lock(m_s->m_mutex);
+			--m_s->m_running;
+			m_s->m_cond.notify_all();
+		}
+		island_scheduler	*m_s;
+	};
+	// n is the number of evolutions for each island if timed is false, otherwise the minimum amount of
+	// time (in milliseconds) to evolve each island.
+	island_scheduler(archipelago &a, const std::size_t &n, bool timed):m_archi(a),m_n(n),m_timed(timed),
+		m_start(boost::posix_time::microsec_clock::local_time()),m_count(a.m_container.size(),0),
+		m_active(a.m_container.size()),m_running(0),m_stop(false)
+	{}
+	~island_scheduler()
+	{
+		join();
+	}
+	void start(const std::size_t &n_threads)
+	{
+		pagmo_assert(n_threads);
+		m_queues.resize(n_threads);
+		for (size_type i = 0; i < m_archi.m_container.size(); ++i) {
+			m_queues[i % n_threads].push_back(i);
+		}
+		try {
+			for (std::size_t i = 0; i < n_threads; ++i) {
+				{
+					lock_type lock(m_mutex);
+					++m_running;
+				}
+				try {
+					m_threads.create_thread(worker(this,i));
+				} catch (...) {
+					lock_type lock(m_mutex);
+					--m_running;
+					throw;
+				}
+			}
+		} catch (...) {
+			interrupt();
+			pagmo_throw(std::runtime_error,"failed to launch the thread");
+		}
+	}
+	void run(const std::size_t &idx)
+	{
+		const running_guard guard(this);
+		size_type isl_idx;
+		while (next_task(idx,isl_idx)) {
+			bool failed = false;
+			try {
+				m_archi.evolve_island(*m_archi.m_container[isl_idx]);
+			} catch (const boost::thread_interrupted &) {
+				lock_type lock(m_mutex);
+				m_stop = true;
+				break;
+			} catch (...) {
+				// Errors have already been reported: stop evolving the island.
+				failed = true;
+			}
+			task_done(idx,isl_idx,failed);
+		}
+	}
+	bool next_task(const std::size_t &idx, size_type &isl_idx)
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		while (!m_stop && m_active) {
+			if (!m_queues[idx].empty()) {
+				isl_idx = m_queues[idx].front();
+				m_queues[idx].pop_front();
+				return true;
+			}
+			// Steal from the back of the other workers' queues.
+			for (std::size_t i = 1; i < m_queues.size(); ++i) {
+				std::deque<size_type> &q = m_queues[(idx + i) % m_queues.size()];
+				if (!q.empty()) {
+					isl_idx = q.back();
+					q.pop_back();
+					return true;
+				}
+			}
+			m_cond.wait(lock);
+		}
+		return false;
+	}
+	void task_done(const std::size_t &idx, const size_type &isl_idx, bool failed)
+	{
+		lock_type lock(m_mutex);
+		++m_count[isl_idx];
+		bool finished = failed;
+		if (!finished) {
+			if (m_timed) {
+				const boost::posix_time::time_duration diff = boost::posix_time::microsec_clock::local_time() - m_start;
+				// Take care of negative timings.
+				finished = diff.total_milliseconds() >= 0 && boost::numeric_cast<std::size_t>(diff.total_milliseconds()) >= m_n;
+			} else {
+				finished = m_count[isl_idx] >= m_n;
+			}
+		}
+		if (finished) {
+			pagmo_assert(m_active);
+			if (!--m_active) {
+				m_cond.notify_all();
+			}
+		} else {
+			m_queues[idx].push_back(isl_idx);
+			m_cond.notify_one();
+		}
+	}
+	void join()
+	{
+		m_threads.join_all();
+	}
+	bool busy()
+	{
+		lock_type lock(m_mutex);
+		return m_running != 0;
+	}
+	void interrupt()
+	{
+		{
+			lock_type lock(m_mutex);
+			m_stop = true;
+		}
+		m_cond.notify_all();
+		m_threads.interrupt_all();
+		join();
+	}
+	archipelago				&m_archi;
+	const std::size_t			m_n;
+	const bool				m_timed;
+	const boost::posix_time::ptime		m_start;
+	boost::mutex				m_mutex;
+	boost::condition_variable		m_cond;
+	std::vector<std::deque<size_type> >	m_queues;
+	std::vector<std::size_t>		m_count;
+	size_type				m_active;
+	std::size_t				m_running;
+	bool					m_stop;
+	boost::thread_group			m_threads;
+};
+
+// Per-island migration state. The mailboxes are accessed concurrently by the islands without locks:
+// - the inbox (used in source migration) is a lock-free stack of batches of emigrants, to which any island can push and
+//   which is emptied in a single atomic operation by the owning island before its evolution;
+// - the outbox (used in destination migration) is an immutable snapshot of the emigrants of the island, which is
+//   atomically replaced by the owning island after each evolution and which the other islands can read without blocking it.
+// The rngs and the migration history are instead accessed only by the thread evolving the island.
+struct archipelago::migration_slot
+{
+	// Batch of emigrants coming from island m_src.
+	struct node
+	{
+		node(const size_type &src, const std::vector<individual_type> &inds):m_src(src),m_inds(inds),m_next(0) {}
+		const size_type				m_src;
+		const std::vector<individual_type>	m_inds;
+		node					*m_next;
+	};
+	typedef boost::shared_ptr<const std::vector<individual_type> > snapshot_type;
+	explicit migration_slot(const rng_uint32::result_type &seed):m_inbox(0),m_drng(seed),m_urng(seed + 1) {}
+	// NOTE: copies are performed only when no island is evolving.
+	migration_slot(const migration_slot &other):m_inbox(0),m_outbox(other.m_outbox),m_drng(other.m_drng),
+		m_urng(other.m_urng),m_hist(other.m_hist)
+	{
+		std::vector<const node *> batches;
+		for (const node *n = other.m_inbox.load(); n; n = n->m_next) {
+			batches.push_back(n);
+		}
+		// Push the batches starting from the oldest one, so that the order is preserved.
+		for (std::vector<const node *>::reverse_iterator it = batches.rbegin(); it != batches.rend(); ++it) {
+			push((*it)->m_src,(*it)->m_inds);
+		}
+	}
+	~migration_slot()
+	{
+		destroy(m_inbox.load());
+	}
+	// Add a batch of emigrants to the inbox. Can be called concurrently by any number of islands.
+	void push(const size_type &src, const std::vector<individual_type> &inds)
+	{
+		node *n = new node(src,inds);
+		n->m_next = m_inbox.load(boost::memory_order_relaxed);
+		while (!m_inbox.compare_exchange_weak(n->m_next,n,boost::memory_order_release,boost::memory_order_relaxed)) {}
+	}
+	// Detach all the batches from the inbox, returning them in arrival order. Must be destroyed by the caller.
+	node *pop_all()
+	{
+		node *head = m_inbox.exchange(0,boost::memory_order_acquire), *retval = 0;
+		while (head) {
+			node *next = head->m_next;
+			head->m_next = retval;
+			retval = head;
+			head = next;
+		}
+		return retval;
+	}
+	static void destroy(node *n)
+	{
+		while (n) {
+			node *next = n->m_next;
+			delete n;
+			n = next;
+		}
+	}
+	snapshot_type get_outbox() const
+	{
+		return boost::atomic_load(&m_outbox);
+	}
+	void set_outbox(const snapshot_type &snapshot)
+	{
+		boost::atomic_store(&m_outbox,snapshot);
+	}
+	boost::atomic<node *>	m_inbox;
+	snapshot_type		m_outbox;
+	rng_double		m_drng;
+	rng_uint32		m_urng;
+	migr_hist_type		m_hist;
+	private:
+		migration_slot &operator=(const migration_slot &);
+};
+
+// Create a new migration slot, seeding its rngs from the archipelago's rng.
+archipelago::migration_slot_ptr archipelago::new_migration_slot()
+{
+	return migration_slot_ptr(new migration_slot(m_urng()));
+}
+
+// Extract the content of the mailboxes in the format used for serialisation.
+archipelago::migration_map_type archipelago::get_migr_map() const
+{
+	migration_map_type retval;
+	for (size_type i = 0; i < m_slots.size(); ++i) {
+		switch (m_migr_dir) {
+			case source:
+			{
+				std::vector<const migration_slot::node *> batches;
+				for (const migration_slot::node *n = m_slots[i]->m_inbox.load(); n; n = n->m_next) {
+					batches.push_back(n);
+				}
+				for (std::vector<const migration_slot::node *>::reverse_iterator it = batches.rbegin(); it != batches.rend(); ++it) {
+					std::vector<individual_type> &inds = retval[i][(*it)->m_src];
+					inds.insert(inds.end(),(*it)->m_inds.begin(),(*it)->m_inds.end());
+				}
+				break;
+			}
+			case destination:
+			{
+				const migration_slot::snapshot_type snapshot = m_slots[i]->get_outbox();
+				if (snapshot) {
+					retval[i][i] = *snapshot;
+				}
+			}
+		}
+	}
+	return retval;
+}
+
+// Fill the mailboxes (which will be re-created) from a migration map.
+void archipelago::set_migr_map(const migration_map_type &migr_map)
+{
+	m_slots.clear();
+	for (size_type i = 0; i < m_container.size(); ++i) {
+		m_slots.push_back(new_migration_slot());
+	}
+	for (migration_map_type::const_iterator it = migr_map.begin(); it != migr_map.end(); ++it) {
+		if (it->first >= m_slots.size()) {
+			pagmo_throw(index_error,"invalid island index in migration map");
+		}
+		for (boost::unordered_map<size_type,std::vector<individual_type> >::const_iterator it2 = it->second.begin();
+			it2 != it->second.end(); ++it2)
+		{
+			switch (m_migr_dir) {
+				case source:
+					m_slots[it->first]->push(it2->first,it2->second);
+					break;
+				case destination:
+					m_slots[it->first]->set_outbox(migration_slot::snapshot_type(new std::vector<individual_type>(it2->second)));
+			}
+		}
+	}
+}
+
 /// Default constructor.
 /**
  * Will construct an empty archipelago with topology::unconnected topology, with point_to_point distribution_type and destination migration_direction.
@@ -67,7 +378,7 @@ void archipelago::check_migr_attributes() const
  */
 archipelago::archipelago(distribution_type dt, migration_direction md):m_islands_sync_point(),m_topology(new topology::unconnected()),
 	m_dist_type(dt),m_migr_dir(md),
-	m_migr_map(),m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_migr_mutex()
+	m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_pool_size(0)
 {
 	check_migr_attributes();
 }
@@ -83,7 +394,7 @@ archipelago::archipelago(distribution_type dt, migration_direction md):m_islands
  */
 archipelago::archipelago(const topology::base &t, distribution_type dt, migration_direction md):
 	m_islands_sync_point(),m_topology(),m_dist_type(dt),m_migr_dir(md),
-	m_migr_map(),m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_migr_mutex()
+	m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_pool_size(0)
 {
 	// NOTE: we cannot set the topology in the initialiser list directly,
 	// since we do not know if the topology is suitable. Set it here.
@@ -106,7 +417,7 @@ archipelago::archipelago(const topology::base &t, distribution_type dt, migratio
  */
 archipelago::archipelago(const algorithm::base &a, const problem::base &p, int n, int m, const topology::base &t, distribution_type dt, migration_direction md):
 	m_islands_sync_point(),m_topology(new topology::unconnected()),m_dist_type(dt),m_migr_dir(md),
-	m_migr_map(),m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_migr_mutex()
+	m_drng(rng_generator::get<rng_double>()),m_urng(rng_generator::get<rng_uint32>()),m_pool_size(0)
 {
 	check_migr_attributes();
 	for (size_type i = 0; i < boost::numeric_cast<size_type>(n); ++i) {
@@ -123,7 +434,7 @@ archipelago::archipelago(const algorithm::base &a, const problem::base &p, int n
  *
  * @param[in] a archipelago to be copied.
  */
-archipelago::archipelago(const archipelago &a)
+archipelago::archipelago(const archipelago &a):m_pool_size(0)
 {
 	a.join();
 	// Deep copy from islands pointers.
@@ -134,10 +445,12 @@ archipelago::archipelago(const archipelago &a)
 	m_topology = a.m_topology->clone();
 	m_dist_type = a.m_dist_type;
 	m_migr_dir = a.m_migr_dir;
-	m_migr_map = a.m_migr_map;
 	m_drng = a.m_drng;
 	m_urng = a.m_urng;
-	m_migr_hist = a.m_migr_hist;
+	for (size_type i = 0; i < a.m_slots.size(); ++i) {
+		m_slots.push_back(migration_slot_ptr(new migration_slot(*a.m_slots[i])));
+	}
+	m_pool_size = a.m_pool_size;
 }
 
 /// Assignment operator.
@@ -162,10 +475,13 @@ archipelago &archipelago::operator=(const archipelago &a)
 		m_topology = a.m_topology->clone();
 		m_dist_type = a.m_dist_type;
 		m_migr_dir = a.m_migr_dir;
-		m_migr_map = a.m_migr_map;
 		m_drng = a.m_drng;
 		m_urng = a.m_urng;
-		m_migr_hist = a.m_migr_hist;
+		m_slots.clear();
+		for (size_type i = 0; i < a.m_slots.size(); ++i) {
+			m_slots.push_back(migration_slot_ptr(new migration_slot(*a.m_slots[i])));
+		}
+		m_pool_size = a.m_pool_size;
 	}
 	return *this;
 }
@@ -182,10 +498,14 @@ archipelago::~archipelago()
 
 /// Wait until evolution on each island has terminated.
 /**
- * Will call iteratively island::join() on all islands of the archipelago.
+ * Will wait for the pool of threads (if any) to complete the evolution, and then call iteratively
+ * island::join() on all islands of the archipelago.
  */
 void archipelago::join() const
 {
+	if (m_scheduler) {
+		m_scheduler->join();
+	}
 	const const_iterator it_f = m_container.end();
 	for (const_iterator it = m_container.begin(); it != it_f; ++it) {
 		(*it)->join();
@@ -225,6 +545,7 @@ void archipelago::push_back(const base_island &isl)
 	m_container.push_back(isl.clone());
 	// Tell the island that it is living in an archipelago now.
 	m_container.back()->m_archi = this;
+	m_slots.push_back(new_migration_slot());
 	// Insert the island in the topology.
 	m_topology->push_back();
 }
@@ -427,6 +748,12 @@ void archipelago::reevaluate_immigrants(std::vector<std::pair<population::size_t
 void archipelago::set_seeds(unsigned int seed) {
 	m_drng.seed(seed);
 	m_urng.seed(seed+1); // we do not care if it overflows
+	// Re-seed the rngs used by the islands during migration.
+	for (size_type i = 0; i < m_slots.size(); ++i) {
+		const rng_uint32::result_type isl_seed = m_urng();
+		m_slots[i]->m_drng.seed(isl_seed);
+		m_slots[i]->m_urng.seed(isl_seed + 1);
+	}
 }
 
 
@@ -443,28 +770,26 @@ void archipelago::pre_evolution(base_island &isl)
 	// Determine the island's index in the archipelago.
 	const size_type isl_idx = locate_island(isl);
 	pagmo_assert(isl_idx < m_container.size());
+	migration_slot &slot = *m_slots[isl_idx];
 	//1. Obtain immigrants.
 	std::vector<std::pair<population::size_type, individual_type> > immigrants;
 	switch (m_migr_dir) {
 		case source:
 		{
-			lock_type lock(m_migr_mutex);
-			// For source migration direction, migration map contains islands' "inboxes". Or, in other words, it contains
+			// For source migration direction, the slots contain islands' "inboxes". Or, in other words, they contain
 			// the individuals that are destined to go into the island. Such inboxes have been assembled previously,
 			// during a post_evolution operation.
-			// Iterate over all the vectors of individuals provided by the different islands.
-			for (boost::unordered_map<size_type,std::vector<individual_type> >::iterator it = m_migr_map[isl_idx].begin();
-				it != m_migr_map[isl_idx].end(); ++it)
-			{
-				pagmo_assert(it->first < m_container.size());
-				build_immigrants_vector(immigrants,*m_container[it->first],isl,it->second);
+			// Detach the batches of individuals provided by the different islands and iterate over them.
+			migration_slot::node *batches = slot.pop_all();
+			for (const migration_slot::node *n = batches; n; n = n->m_next) {
+				pagmo_assert(n->m_src < m_container.size());
+				build_immigrants_vector(immigrants,*m_container[n->m_src],isl,n->m_inds);
 			}
-			// Delete stuff in the migration map.
-			m_migr_map.erase(isl_idx);
+			migration_slot::destroy(batches);
 			break;
 		}
 		case destination:
-			// For destination migration direction, items in the migration map behave like "outboxes", i.e. each one is a
+			// For destination migration direction, the slots contain "outboxes", i.e. each one is a
 			// "database of best individuals" seen in the islands of the archipelago.
 			// Get neighbours connecting into isl.
 			const std::vector<topology::base::vertices_size_type> inv_adj_islands(m_topology->get_v_inv_adjacent_vertices(boost::numeric_cast<topology::base::vertices_size_type>(isl_idx)));
@@ -473,32 +798,32 @@ void archipelago::pre_evolution(base_island &isl)
 				switch (m_dist_type) {
 					case point_to_point:
 					{
-						lock_type lock(m_migr_mutex);
 						// Get the index of a random island connecting into isl.
 						boost::uniform_int<std::vector<topology::base::vertices_size_type>::size_type> u_int(0,inv_adj_islands.size() - 1);
-						const size_type rn_isl_idx = boost::numeric_cast<size_type>(inv_adj_islands[u_int(m_urng)]);
-						// Get the immigrants from the outbox of the random island. Note the redundant information in the last
-						// argument of the function.
-						pagmo_assert(m_migr_map[rn_isl_idx].size() <= 1);
-
-						double next_rng = m_drng();
+						const size_type rn_isl_idx = boost::numeric_cast<size_type>(inv_adj_islands[u_int(slot.m_urng)]);
+						double next_rng = slot.m_drng();
 						double migr_prob = m_topology->get_weight(rn_isl_idx, isl_idx);
 						if (next_rng < migr_prob) {
-							build_immigrants_vector(immigrants,*m_container[rn_isl_idx],isl,m_migr_map[rn_isl_idx][rn_isl_idx]);
+							// Get the immigrants from the outbox of the random island.
+							const migration_slot::snapshot_type snapshot = m_slots[rn_isl_idx]->get_outbox();
+							if (snapshot) {
+								build_immigrants_vector(immigrants,*m_container[rn_isl_idx],isl,*snapshot);
+							}
 						}
 						break;
 					}
 					case broadcast:
 					{
-						lock_type lock(m_migr_mutex);
 						// For broadcast migration fetch immigrants from all neighbour islands' databases.
 						for (std::vector<topology::base::vertices_size_type>::size_type i = 0; i < inv_adj_islands.size(); ++i) {
 							const size_type src_isl_idx = boost::numeric_cast<size_type>(inv_adj_islands[i]);
-							pagmo_assert(m_migr_map[src_isl_idx].size() <= 1);
-							double next_rng = m_drng();
+							double next_rng = slot.m_drng();
 							double migr_prob = m_topology->get_weight(src_isl_idx, isl_idx);
 							if (next_rng < migr_prob) {
-								build_immigrants_vector(immigrants,*m_container[src_isl_idx],isl,m_migr_map[src_isl_idx][src_isl_idx]);
+								const migration_slot::snapshot_type snapshot = m_slots[src_isl_idx]->get_outbox();
+								if (snapshot) {
+									build_immigrants_vector(immigrants,*m_container[src_isl_idx],isl,*snapshot);
+								}
 							}
 						}
 					}
@@ -514,10 +839,9 @@ void archipelago::pre_evolution(base_island &isl)
 		// We then insert the incoming individuals into the population, storing how many from where
 		std::vector<std::pair<population::size_type, size_type> > rec_history;
 		rec_history = isl.accept_immigrants(immigrants);
-		lock_type lock(m_migr_mutex);
 		// Record the migration history.
 		for (size_t i =0; i< rec_history.size(); ++i) {
-			m_migr_hist.push_back( boost::make_tuple(
+			slot.m_hist.push_back( boost::make_tuple(
 				rec_history[i].first,
 				rec_history[i].second,
 				isl_idx)
@@ -538,6 +862,7 @@ void archipelago::post_evolution(base_island &isl)
 	// Determine the island's index in the archipelago.
 	const size_type isl_idx = locate_island(isl);
 	pagmo_assert(isl_idx < m_container.size());
+	migration_slot &slot = *m_slots[isl_idx];
 	// Create the vector of emigrants.
 	std::vector<individual_type> emigrants;
 	switch (m_migr_dir) {
@@ -553,28 +878,24 @@ void archipelago::post_evolution(base_island &isl)
 					{
 						case point_to_point:
 						{
-							lock_type lock(m_migr_mutex);
 							// For one-to-one migration choose a random neighbour island and put immigrants to its inbox.
 							boost::uniform_int<std::vector<topology::base::vertices_size_type>::size_type> u_int(0,adj_islands.size() - 1);
-							const size_type chosen_adj = boost::numeric_cast<size_type>(adj_islands[u_int(m_urng)]);
-							double next_rng = m_drng();
+							const size_type chosen_adj = boost::numeric_cast<size_type>(adj_islands[u_int(slot.m_urng)]);
+							double next_rng = slot.m_drng();
 							double migr_prob = m_topology->get_weight(isl_idx, chosen_adj);
 							if (next_rng < migr_prob) {
-								m_migr_map[chosen_adj][isl_idx].insert(m_migr_map[chosen_adj][isl_idx].end(),emigrants.begin(),emigrants.end());
+								m_slots[chosen_adj]->push(isl_idx,emigrants);
 							}
 							break;
 						}
 						case broadcast:
 						{
-							lock_type lock(m_migr_mutex);
 							// For broadcast migration put immigrants to all neighbour islands' inboxes.
 							for (std::vector<topology::base::vertices_size_type>::size_type i = 0; i < adj_islands.size(); ++i) {
-								double next_rng = m_drng();
+								double next_rng = slot.m_drng();
 								double migr_prob = m_topology->get_weight(isl_idx, adj_islands[i]);
 								if (next_rng < migr_prob) {
-									m_migr_map[boost::numeric_cast<size_type>(adj_islands[i])][isl_idx]
-										.insert(m_migr_map[boost::numeric_cast<size_type>(adj_islands[i])][isl_idx].end(),
-										emigrants.begin(),emigrants.end());
+									m_slots[boost::numeric_cast<size_type>(adj_islands[i])]->push(isl_idx,emigrants);
 								}
 							}
 						}
@@ -585,24 +906,78 @@ void archipelago::post_evolution(base_island &isl)
 		}
 		case destination:
 		{
-			// For destination migration direction, migration map behaves like "outboxes", i.e. each is a "database of best individuals" for corresponding island.
-			emigrants = isl.get_emigrants();
-			lock_type lock(m_migr_mutex);
-			pagmo_assert(m_migr_map[isl_idx].size() <= 1);
-			m_migr_map[isl_idx][isl_idx].swap(emigrants);
+			// For destination migration direction, slots behave like "outboxes", i.e. each is a "database of best individuals" for corresponding island.
+			// Publish a new snapshot: islands still reading the previous one will keep it alive until they are done.
+			boost::shared_ptr<std::vector<individual_type> > snapshot(new std::vector<individual_type>(isl.get_emigrants()));
+			slot.set_outbox(snapshot);
 		}
 	}
 }
 
+// Perform a single evolution of the island isl, including migration. This is the task executed by the island scheduler.
+void archipelago::evolve_island(base_island &isl)
+{
+	// RAII object calling the island's thread hooks.
+	struct thread_hook
+	{
+		thread_hook(base_island &i):m_i(i)
+		{
+			m_i.thread_entry();
+		}
+		~thread_hook()
+		{
+			m_i.thread_exit();
+		}
+		base_island &m_i;
+	};
+	const boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+	try {
+		const thread_hook hook(isl);
+		isl.evolution_step();
+		// Set the interruption point.
+		boost::this_thread::interruption_point();
+	} catch (const boost::thread_interrupted &) {
+		throw;
+	} catch (const std::exception &e) {
+		std::cout << "Error during island evolution using " << isl.m_algo->get_name() << ": " << e.what() << std::endl;
+		throw;
+	} catch (...) {
+		std::cout << "Error during island evolution using " << isl.m_algo->get_name() << ", unknown exception caught. :(" << std::endl;
+		throw;
+	}
+	// Low-accuracy clocks might yield negative time differences for really short evolutions.
+	const boost::posix_time::time_duration diff = boost::posix_time::microsec_clock::local_time() - start;
+	if (diff.total_milliseconds() >= 0) {
+		isl.m_evo_time += boost::numeric_cast<std::size_t>(diff.total_milliseconds());
+	}
+}
+
+// Launch an evolution of the islands on the pool of threads. See island_scheduler for the meaning of the parameters.
+void archipelago::pool_evolve(const std::size_t &n, bool timed)
+{
+	pagmo_assert(m_pool_size);
+	m_scheduler.reset(0);
+	if (m_container.empty() || (!timed && !n)) {
+		return;
+	}
+	m_scheduler.reset(new island_scheduler(*this,n,timed));
+	m_scheduler->start(std::min<std::size_t>(m_pool_size,m_container.size()));
+}
+
 /// Run the evolution for the given number of iterations.
 /**
- * Will iteratively call island::evolve(n) on each island of the archipelago and then return.
+ * Will iteratively call island::evolve(n) on each island of the archipelago and then return. If the pool size
+ * is not null, the evolutions will instead be performed asynchronously by the pool of threads (see set_pool_size()).
  *
  * \param[in] n number of time each island will be evolved.
  */
 void archipelago::evolve(int n)
 {
 	join();
+	if (m_pool_size) {
+		pool_evolve(boost::numeric_cast<std::size_t>(n),false);
+		return;
+	}
 	const iterator it_f = m_container.end();
 	// Reset thread barrier.
 	reset_barrier(m_container.size());
@@ -656,13 +1031,20 @@ void archipelago::evolve_batch(int n, unsigned int b, bool randomize)
 
 /// Run the evolution for a minimum amount of time.
 /**
- * Will iteratively call island::evolve_t(n) on each island of the archipelago and then return.
+ * Will iteratively call island::evolve_t(n) on each island of the archipelago and then return. If the pool size
+ * is not null, the evolutions will instead be performed asynchronously by the pool of threads (see set_pool_size()):
+ * each island will be evolved at least once, and it will keep on being evolved until t milliseconds have passed
+ * from the call to this method.
  *
  * \param[in] t amount of time to evolve each island (in milliseconds).
  */
 void archipelago::evolve_t(int t)
 {
 	join();
+	if (m_pool_size) {
+		pool_evolve(boost::numeric_cast<std::size_t>(t),true);
+		return;
+	}
 	const iterator it_f = m_container.end();
 	reset_barrier(m_container.size());
 	for (iterator it = m_container.begin(); it != it_f; ++it) {
@@ -676,6 +1058,9 @@ void archipelago::evolve_t(int t)
  */
 bool archipelago::busy() const
 {
+	if (m_scheduler && m_scheduler->busy()) {
+		return true;
+	}
 	const const_iterator it_f = m_container.end();
 	for (const_iterator it = m_container.begin(); it != it_f; ++it) {
 		if ((*it)->busy()) {
@@ -687,16 +1072,48 @@ bool archipelago::busy() const
 
 /// Interrupt ongoing evolution.
 /**
- * Will iteratively called island::interrupt() on all the islands of the archipelago.
+ * Will stop the pool of threads (if any) and then iteratively call island::interrupt() on all the islands of the archipelago.
  */
 void archipelago::interrupt()
 {
+	if (m_scheduler) {
+		m_scheduler->interrupt();
+	}
 	const iterator it_f = m_container.end();
 	for (iterator it = m_container.begin(); it != it_f; ++it) {
 		(*it)->interrupt();
 	}
 }
 
+/// Set the size of the pool of threads.
+/**
+ * By default (pool size 0), evolve() and evolve_t() will launch one thread per island. With a non-null pool size n,
+ * the evolutions will instead be performed by a pool of at most n threads: each single evolution of an island is a task,
+ * and idle threads will pick the next island ready to be evolved, so that large archipelagos do not oversubscribe the
+ * machine. Migration still happens before and after each evolution of an island, but there is no synchronisation between
+ * the islands at the start of the evolution. evolve_batch() is not affected by this setting.
+ *
+ * Will call join() before changing the pool size.
+ *
+ * @param[in] n size of the pool of threads (0 for one thread per island).
+ */
+void archipelago::set_pool_size(unsigned int n)
+{
+	join();
+	m_pool_size = n;
+}
+
+/// Get the size of the pool of threads.
+/**
+ * @return the size of the pool of threads used in evolve() and evolve_t(), or 0 if one thread per island is used.
+ *
+ * @see set_pool_size().
+ */
+unsigned int archipelago::get_pool_size() const
+{
+	return m_pool_size;
+}
+
 /// Island getter.
 /**
  * @param[in] idx index of the desired island.
@@ -762,20 +1179,146 @@ void archipelago::sync_island_start() const
 	m_islands_sync_point->wait();
 }
 
+// Write a string as a CSV field.
+static void csv_string(std::ostream &os, const std::string &str)
+{
+	os << '"';
+	for (std::string::const_iterator it = str.begin(); it != str.end(); ++it) {
+		if (*it == '"') {
+			os << '"';
+		}
+		os << *it;
+	}
+	os << '"';
+}
+
+// Write a string as a JSON string.
+static void json_string(std::ostream &os, const std::string &str)
+{
+	os << '"';
+	for (std::string::const_iterator it = str.begin(); it != str.end(); ++it) {
+		switch (*it) {
+			case '"':
+				os << "\\\"";
+				break;
+			case '\\':
+				os << "\\\\";
+				break;
+			case '\n':
+				os << "\\n";
+				break;
+			case '\t':
+				os << "\\t";
+				break;
+			default:
+				os << *it;
+		}
+	}
+	os << '"';
+}
+
+/// Dump the evolution telemetry of the islands.
+/**
+ * Will call join() and then write the telemetry of each island (see base_island::telemetry_type) in the requested format. Each record
+ * contains the index of the island, its type, the name of its algorithm, the statistics collected by the island and the derived
+ * quantities (mean time of an evolution step, objective function evaluations per second and cache hit rate).
+ * All times are in milliseconds.
+ *
+ * In CSV format, the first line contains the names of the fields, followed by one line per island. In JSON format, the output
+ * is an array of objects, one per island, whose keys are the names of the fields.
+ *
+ * @param[in] format output format.
+ *
+ * @return the telemetry of the islands as a string.
+ *
+ * @throws value_error if format is not a valid telemetry format.
+ */
+std::string archipelago::dump_telemetry(telemetry_format format) const
+{
+	if (format != csv && format != json) {
+		pagmo_throw(value_error,"invalid telemetry format");
+	}
+	join();
+	static const char *names[] = {"island","type","algorithm","n_evolutions","evo_time","mean_evo_time","min_evo_time","max_evo_time",
+		"pre_evolution_time","post_evolution_time","sync_time","objfun_time","fevals","fevals_per_second","cache_hits","cache_misses",
+		"cache_hit_rate"};
+	const std::size_t n_names = sizeof(names) / sizeof(names[0]);
+	std::ostringstream oss;
+	oss.precision(15);
+	if (format == csv) {
+		for (std::size_t j = 0; j < n_names; ++j) {
+			oss << (j ? "," : "") << names[j];
+		}
+		oss << '\n';
+	} else {
+		oss << '[';
+	}
+	for (size_type i = 0; i < m_container.size(); ++i) {
+		const base_island::telemetry_type &t = m_container[i]->m_telemetry;
+		// Textual fields first, then numerical fields.
+		const std::string text[] = {m_container[i]->get_name(), m_container[i]->m_algo->get_name()};
+		const double values[] = {static_cast<double>(t.n_evolutions),t.evo_time,t.get_mean_evo_time(),t.min_evo_time,t.max_evo_time,
+			t.pre_evolution_time,t.post_evolution_time,t.sync_time,t.objfun_time,static_cast<double>(t.fevals),t.get_fevals_per_second(),
+			static_cast<double>(t.cache_hits),static_cast<double>(t.cache_misses),t.get_cache_hit_rate()};
+		if (format == csv) {
+			oss << i;
+			for (std::size_t j = 0; j < 2; ++j) {
+				oss << ',';
+				csv_string(oss,text[j]);
+			}
+			for (std::size_t j = 0; j < n_names - 3; ++j) {
+				oss << ',' << values[j];
+			}
+			oss << '\n';
+		} else {
+			oss << (i ? ",\n" : "\n") << "{\"" << names[0] << "\":" << i;
+			for (std::size_t j = 0; j < 2; ++j) {
+				oss << ",\"" << names[j + 1] << "\":";
+				json_string(oss,text[j]);
+			}
+			for (std::size_t j = 0; j < n_names - 3; ++j) {
+				oss << ",\"" << names[j + 3] << "\":" << values[j];
+			}
+			oss << '}';
+		}
+	}
+	if (format == json) {
+		oss << (m_container.empty() ? "]\n" : "\n]\n");
+	}
+	return oss.str();
+}
+
+/// Reset the evolution telemetry of the islands.
+/**
+ * Will call base_island::reset_telemetry() on all the islands of the archipelago.
+ */
+void archipelago::reset_telemetry()
+{
+	join();
+	for (iterator it = m_container.begin(); it != m_container.end(); ++it) {
+		(*it)->reset_telemetry();
+	}
+}
+
 /// Dumps the archipelago migration history
 /**
  * @return A string formatted as follows: (x1,y1,z1)\n(x2,y2,z2)..... where x is the number of individuals
- * accepted in island z and coming from island y
+ * accepted in island z and coming from island y. The entries are grouped by destination island, and
+ * are in chronological order within each group.
  */
 std::string archipelago::dump_migr_history() const
 {
 	join();
 	std::ostringstream oss;
-	for (migr_hist_type::const_iterator it = m_migr_hist.begin(); it != m_migr_hist.end(); ++it) {
-		oss << "(" << (*it).get<0>()
-			<< "," << (*it).get<1>()
-			<< "," << (*it).get<2>() << ")"
-			<< '\n';
+	// Merge the histories recorded by the islands.
+	for (size_type i = 0; i < m_slots.size(); ++i) {
+		const migr_hist_type &hist = m_slots[i]->m_hist;
+		for (migr_hist_type::const_iterator it = hist.begin(); it != hist.end(); ++it) {
+			oss << "(" << (*it).get<0>()
+				<< "," << (*it).get<1>()
+				<< "," << (*it).get<2>() << ")"
+				<< '\n';
+		}
 	}
 	return oss.str();
 }
@@ -788,7 +1331,9 @@ std::string archipelago::dump_migr_history() const
 void archipelago::clear_migr_history()
 {
 	join();
-	m_migr_hist.clear();
+	for (size_type i = 0; i < m_slots.size(); ++i) {
+		m_slots[i]->m_hist.clear();
+	}
 }
 
 /// Overload stream operator for pagmo::archipelago.
@@ -26,12 +26,14 @@
 #define PAGMO_ARCHIPELAGO_H
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/thread/barrier.hpp>
 #include <boost/thread/locks.hpp>
 #include <boost/thread/mutex.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <boost/serialization/map.hpp>
 #include <boost/unordered_map.hpp>
+#include <cstddef>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -105,11 +107,22 @@ class __PAGMO_VISIBLE archipelago
 			 */
 			destination = 1
 		};
+		/// Output format of the evolution telemetry.
+		/**
+		 * @see archipelago::dump_telemetry().
+		 */
+		enum telemetry_format
+		{
+			/// Comma-separated values, with a header line.
+			csv = 0,
+			/// Array of JSON objects.
+			json = 1
+		};
 	private:
 		// Iterators.
 		typedef container_type::iterator iterator;
 		typedef container_type::const_iterator const_iterator;
-		// Container for migrating individuals. This a hash map containing hash maps as values.
+		// Container for migrating individuals, used to serialise the content of the migration slots. This a hash map containing hash maps as values.
 		// Please NOTE carefully: in case of desination migration, item n in the outer hash map is supposed to contain a hash map with a single
 		// (n,emigrants vector) pair (in other words, containing redundantly n twice). In case of source migration, item n will contain a map of
 		// emigrants from other islands.
@@ -120,6 +133,9 @@ class __PAGMO_VISIBLE archipelago
 		typedef boost::tuple<population::size_type,size_type,size_type> migr_hist_item;
 		// Container of migration history: vector of history items.
 		typedef std::vector<migr_hist_item> migr_hist_type;
+		// Per-island migration state (mailboxes, rngs and migration history).
+		struct migration_slot;
+		typedef boost::shared_ptr<migration_slot> migration_slot_ptr;
 	public:
 		explicit archipelago(distribution_type = point_to_point, migration_direction = destination);
 		explicit archipelago(const topology::base &, distribution_type = point_to_point, migration_direction = destination);
@@ -143,6 +159,10 @@ class __PAGMO_VISIBLE archipelago
 		void evolve_t(int);
 		bool busy() const;
 		void interrupt();
+		void set_pool_size(unsigned int);
+		unsigned int get_pool_size() const;
+		std::string dump_telemetry(telemetry_format = csv) const;
+		void reset_telemetry();
 		std::string dump_migr_history() const;
 		void clear_migr_history();
 		void set_island(const size_type &, const base_island &);
@@ -150,9 +170,16 @@ class __PAGMO_VISIBLE archipelago
 		base_island_ptr get_island(const size_type &) const;
 		void set_seeds(unsigned int);
 	private:
+		// Fixed-size pool of threads used to evolve the islands when the pool size is not null.
+		struct island_scheduler;
+		void pool_evolve(const std::size_t &, bool);
+		void evolve_island(base_island &);
 		void pre_evolution(base_island &);
 		void post_evolution(base_island &);
 		void reset_barrier(const size_type &);
+		migration_slot_ptr new_migration_slot();
+		migration_map_type get_migr_map() const;
+		void set_migr_map(const migration_map_type &);
 		void build_immigrants_vector(std::vector<std::pair<population::size_type, individual_type > > &,
 			const base_island &, base_island &,
 			const std::vector<individual_type> &) const;
@@ -165,35 +192,44 @@ class __PAGMO_VISIBLE archipelago
 	private:
 		friend class boost::serialization::access;
 		template <class Archive>
-		void serialize(Archive &ar, const unsigned int version)
+		void save(Archive &ar, const unsigned int) const
 		{
 			join();
-			ar & m_container;
-			ar & m_topology;
-			ar & m_dist_type;
-			ar & m_migr_dir;
-			ar & m_migr_map;
-			ar & m_drng;
-			ar & m_urng;
-			// NOTE: this would need tuple serialization...
-			//ar & m_migr_hist;
-			boost::serialization::split_member(ar, *this, version);
+			ar << m_container;
+			ar << m_topology;
+			ar << m_dist_type;
+			ar << m_migr_dir;
+			const migration_map_type migr_map(get_migr_map());
+			ar << migr_map;
+			ar << m_drng;
+			ar << m_urng;
+			ar << m_pool_size;
+			// NOTE: the migration history is not saved, as this would need tuple serialization.
 		}
-
 		template <class Archive>
-		void save(Archive &, const unsigned int) const
-		{}
-		template <class Archive>
-		void load(Archive &, const unsigned int)
+		void load(Archive &ar, const unsigned int version)
 		{
+			join();
+			ar >> m_container;
+			ar >> m_topology;
+			ar >> m_dist_type;
+			ar >> m_migr_dir;
+			migration_map_type migr_map;
+			ar >> migr_map;
+			ar >> m_drng;
+			ar >> m_urng;
+			if (version >= 1) {
+				ar >> m_pool_size;
+			}
 			// NOTE: archi pointer is not saved during island serialization. Hence, upon loading,
 			// we are going to set the archi pointer of the islands to this. 
 			for (size_type i = 0; i < m_container.size(); ++i) {
 				m_container[i]->m_archi = this;
 			}
-			// NOTE: migr history is not saved, so upon loading we clear it.
-			m_migr_hist.clear();
+			// NOTE: migr history is not saved, so upon loading it will be empty.
+			set_migr_map(migr_map);
 		}
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
 		// Container of islands.
 		container_type				m_container;
 		// A barrier used to synchronise the start time of islands.
@@ -204,15 +240,15 @@ class __PAGMO_VISIBLE archipelago
 		distribution_type			m_dist_type;
 		// Migration direction.
 		migration_direction			m_migr_dir;
-		// Migration container.
-		migration_map_type			m_migr_map;
-		// Rngs used during migration.
+		// Rngs used to seed the migration slots and to shuffle islands in evolve_batch().
 		rng_double					m_drng;
 		rng_uint32					m_urng;
-		// Migration mutex.
-		boost::mutex				m_migr_mutex;
-		// Migration history.
-		migr_hist_type				m_migr_hist;
+		// Migration slots, one per island.
+		std::vector<migration_slot_ptr>		m_slots;
+		// Size of the pool of threads used for evolution (0 means one thread per island).
+		unsigned int				m_pool_size;
+		// Scheduler of the current pool evolution.
+		boost::scoped_ptr<island_scheduler>	m_scheduler;
 
 };
 
@@ -220,4 +256,6 @@ std::ostream __PAGMO_VISIBLE_FUNC &operator<<(std::ostream &, const archipelago
 
 }
 
+BOOST_CLASS_VERSION(pagmo::archipelago,1)
+
 #endif
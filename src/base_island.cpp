@@ -64,7 +64,7 @@ namespace pagmo
  */
 base_island::base_island(const algorithm::base &a, const problem::base &p, int n,
 	const migration::base_s_policy &s_policy, const migration::base_r_policy &r_policy):
-	m_algo(a.clone()),m_pop(p,n),m_archi(0),m_evo_time(0),m_s_policy(s_policy.clone()),m_r_policy(r_policy.clone()) { }
+	m_algo(a.clone()),m_pop(p,n),m_archi(0),m_evo_time(0),m_s_policy(s_policy.clone()),m_r_policy(r_policy.clone()),m_telemetry() { }
 
 /// Copy constructor.
 /**
@@ -81,6 +81,7 @@ base_island::base_island(const base_island &isl):m_pop(isl.get_population())
 	m_s_policy = isl.m_s_policy->clone();
 	m_r_policy = isl.m_r_policy->clone();
 	m_evo_thread.reset(0);
+	m_telemetry = isl.m_telemetry;
 }
 
 /// Constructor from population.
@@ -96,7 +97,7 @@ base_island::base_island(const base_island &isl):m_pop(isl.get_population())
  */
 base_island::base_island(const algorithm::base &a, const population &pop,
 	const migration::base_s_policy &s_policy, const migration::base_r_policy &r_policy):
-	m_algo(a.clone()),m_pop(pop),m_archi(0),m_evo_time(0),m_s_policy(s_policy.clone()),m_r_policy(r_policy.clone()) { }
+	m_algo(a.clone()),m_pop(pop),m_archi(0),m_evo_time(0),m_s_policy(s_policy.clone()),m_r_policy(r_policy.clone()),m_telemetry() { }
 
 /// Assignment operator.
 /**
@@ -120,6 +121,7 @@ base_island &base_island::operator=(const base_island &isl)
 		m_s_policy = isl.m_s_policy->clone();
 		m_r_policy = isl.m_r_policy->clone();
 		m_evo_thread.reset(0);
+		m_telemetry = isl.m_telemetry;
 	}
 	return *this;
 }
@@ -233,6 +235,72 @@ struct base_island::raii_thread_hook
 	base_island *m_ptr;
 };
 
+// Elapsed wall-clock time in milliseconds since start.
+static double elapsed_ms(const boost::posix_time::ptime &start)
+{
+	return (boost::posix_time::microsec_clock::universal_time() - start).total_microseconds() / 1000.;
+}
+
+// Increase of a monotonic counter of the problem. If the problem was replaced during the evolution, the counter might
+// have been reset: in that case, the whole value is taken.
+template <class T>
+static T counter_diff(const T &before, const T &after)
+{
+	return (after >= before) ? after - before : after;
+}
+
+// Wait for the other islands of the archipelago (if any) to be ready to start evolution.
+void base_island::sync_start()
+{
+	if (m_archi) {
+		const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+		m_archi->sync_island_start();
+		m_telemetry.sync_time += elapsed_ms(start);
+	}
+}
+
+// Perform a single evolution step: migration and problem hooks around the call to perform_evolution(). The telemetry is updated
+// only upon successful completion of the step.
+void base_island::evolution_step()
+{
+	const boost::posix_time::ptime start = boost::posix_time::microsec_clock::universal_time();
+	const unsigned long fevals = m_pop.problem().get_fevals(), hits = m_pop.problem().get_cache_hits(),
+		misses = m_pop.problem().get_cache_misses();
+	const double objfun_time = m_pop.problem().get_objfun_time();
+	double pre_time = 0, post_time = 0;
+	// Call pre-evolve hooks.
+	if (m_archi) {
+		m_archi->pre_evolution(*this);
+		pre_time = elapsed_ms(start);
+	}
+	m_pop.problem().pre_evolution(m_pop);
+	// Call the evolution.
+	perform_evolution(*m_algo,m_pop);
+	// Post-evolve hooks.
+	if (m_archi) {
+		const boost::posix_time::ptime post_start = boost::posix_time::microsec_clock::universal_time();
+		m_archi->post_evolution(*this);
+		post_time = elapsed_ms(post_start);
+	}
+	m_pop.problem().post_evolution(m_pop);
+	// Record the telemetry.
+	const double evo_time = elapsed_ms(start);
+	if (!m_telemetry.n_evolutions || evo_time < m_telemetry.min_evo_time) {
+		m_telemetry.min_evo_time = evo_time;
+	}
+	if (!m_telemetry.n_evolutions || evo_time > m_telemetry.max_evo_time) {
+		m_telemetry.max_evo_time = evo_time;
+	}
+	++m_telemetry.n_evolutions;
+	m_telemetry.evo_time += evo_time;
+	m_telemetry.pre_evolution_time += pre_time;
+	m_telemetry.post_evolution_time += post_time;
+	m_telemetry.objfun_time += counter_diff(objfun_time,m_pop.problem().get_objfun_time());
+	m_telemetry.fevals += counter_diff<unsigned long>(fevals,m_pop.problem().get_fevals());
+	m_telemetry.cache_hits += counter_diff(hits,m_pop.problem().get_cache_hits());
+	m_telemetry.cache_misses += counter_diff(misses,m_pop.problem().get_cache_misses());
+}
+
 // Evolver thread object. This is a callable helper object used to launch an evolution for a given number of iterations.
 struct base_island::int_evolver {
 	int_evolver(base_island *i, const std::size_t &n):m_i(i),m_n(n) {}
@@ -246,23 +314,10 @@ void base_island::int_evolver::juice_impl(boost::posix_time::ptime &start)
 {
 	start = boost::posix_time::microsec_clock::local_time();
 	// Synchronise start with all other threads if we are in an archi.
-	if (m_i->m_archi) {
-		m_i->m_archi->sync_island_start();
-	}
+	m_i->sync_start();
 	const raii_thread_hook hook(m_i);
 	for (std::size_t i = 0; i < m_n; ++i) {
-		// Call pre-evolve hooks.
-		if (m_i->m_archi) {
-			m_i->m_archi->pre_evolution(*m_i);
-		}
-		m_i->m_pop.problem().pre_evolution(m_i->m_pop);
-		// Call the evolution.
-		m_i->perform_evolution(*m_i->m_algo,m_i->m_pop);
-		// Post-evolve hooks.
-		if (m_i->m_archi) {
-			m_i->m_archi->post_evolution(*m_i);
-		}
-		m_i->m_pop.problem().post_evolution(m_i->m_pop);
+		m_i->evolution_step();
 		// Set the interruption point.
 		boost::this_thread::interruption_point();
 	}
@@ -330,20 +385,10 @@ void base_island::t_evolver::juice_impl(boost::posix_time::ptime &start)
 	boost::posix_time::time_duration diff;
 	start = boost::posix_time::microsec_clock::local_time();
 	// Synchronise start.
-	if (m_i->m_archi) {
-		m_i->m_archi->sync_island_start();
-	}
+	m_i->sync_start();
 	const raii_thread_hook hook(m_i);
 	do {
-		if (m_i->m_archi) {
-			m_i->m_archi->pre_evolution(*m_i);
-		}
-		m_i->m_pop.problem().pre_evolution(m_i->m_pop);
-		m_i->perform_evolution(*m_i->m_algo,m_i->m_pop);
-		if (m_i->m_archi) {
-			m_i->m_archi->post_evolution(*m_i);
-		}
-		m_i->m_pop.problem().post_evolution(m_i->m_pop);
+		m_i->evolution_step();
 		// Set the interruption point.
 		boost::this_thread::interruption_point();
 		diff = boost::posix_time::microsec_clock::local_time() - start;
@@ -437,6 +482,64 @@ std::size_t base_island::get_evolution_time() const
 	return m_evo_time;
 }
 
+/// Default constructor.
+/**
+ * Will set all the statistics to zero.
+ */
+base_island::telemetry_type::telemetry_type():n_evolutions(0),evo_time(0),min_evo_time(0),max_evo_time(0),pre_evolution_time(0),
+	post_evolution_time(0),sync_time(0),objfun_time(0),fevals(0),cache_hits(0),cache_misses(0)
+{}
+
+/// Mean time of an evolution step.
+/**
+ * @return the mean time of an evolution step in milliseconds, or zero if no evolution step was performed.
+ */
+double base_island::telemetry_type::get_mean_evo_time() const
+{
+	return n_evolutions ? evo_time / static_cast<double>(n_evolutions) : 0.;
+}
+
+/// Rate of objective function evaluations.
+/**
+ * @return the number of objective function evaluations per second of evolution time, or zero if the evolution time is zero.
+ */
+double base_island::telemetry_type::get_fevals_per_second() const
+{
+	return (evo_time > 0) ? static_cast<double>(fevals) / evo_time * 1000. : 0.;
+}
+
+/// Cache hit rate.
+/**
+ * @return the fraction of successful look-ups in the problem's cache, or zero if no look-up was performed.
+ */
+double base_island::telemetry_type::get_cache_hit_rate() const
+{
+	return (cache_hits + cache_misses) ? static_cast<double>(cache_hits) / static_cast<double>(cache_hits + cache_misses) : 0.;
+}
+
+/// Return the evolution telemetry.
+/**
+ * Will call join() before returning the statistics accumulated since the construction of the island
+ * or since the last call to reset_telemetry().
+ *
+ * @return the evolution telemetry of the island.
+ */
+base_island::telemetry_type base_island::get_telemetry() const
+{
+	join();
+	return m_telemetry;
+}
+
+/// Reset the evolution telemetry.
+/**
+ * Will call join() before setting all the statistics to zero.
+ */
+void base_island::reset_telemetry()
+{
+	join();
+	m_telemetry = telemetry_type();
+}
+
 /// Return copy of the internal algorithm.
 /**
  * @return algorithm::base_ptr to the cloned algorithm.
@@ -116,12 +116,68 @@ class __PAGMO_VISIBLE base_island
 		 * Methods related to island evolution.
 		 */
 		//@{
+		/// Evolution telemetry.
+		/**
+		 * Statistics collected by the island during evolution, in order to establish where the evolution time is spent.
+		 * All times are wall-clock times in milliseconds. Each evolution step consists of the archipelago's migration hooks
+		 * (if the island belongs to an archipelago), the problem's hooks and the call to perform_evolution().
+		 *
+		 * @see base_island::get_telemetry().
+		 */
+		struct __PAGMO_VISIBLE telemetry_type
+		{
+			telemetry_type();
+			double get_mean_evo_time() const;
+			double get_fevals_per_second() const;
+			double get_cache_hit_rate() const;
+			/// Number of evolution steps performed.
+			std::size_t	n_evolutions;
+			/// Total time spent in evolution steps.
+			double		evo_time;
+			/// Time of the shortest evolution step.
+			double		min_evo_time;
+			/// Time of the longest evolution step.
+			double		max_evo_time;
+			/// Time spent selecting and inserting immigrants before the evolution steps.
+			double		pre_evolution_time;
+			/// Time spent publishing emigrants after the evolution steps.
+			double		post_evolution_time;
+			/// Time spent waiting for the other islands of the archipelago before starting evolution.
+			double		sync_time;
+			/// Time spent in the objective function (available only if timing was enabled in the problem, see problem::base::set_objfun_timing()).
+			double		objfun_time;
+			/// Number of objective function evaluations.
+			unsigned long	fevals;
+			/// Number of fitness and constraint vectors retrieved from the problem's cache.
+			unsigned long	cache_hits;
+			/// Number of unsuccessful look-ups in the problem's cache.
+			unsigned long	cache_misses;
+			private:
+				friend class boost::serialization::access;
+				template <class Archive>
+				void serialize(Archive &ar, const unsigned int)
+				{
+					ar & n_evolutions;
+					ar & evo_time;
+					ar & min_evo_time;
+					ar & max_evo_time;
+					ar & pre_evolution_time;
+					ar & post_evolution_time;
+					ar & sync_time;
+					ar & objfun_time;
+					ar & fevals;
+					ar & cache_hits;
+					ar & cache_misses;
+				}
+		};
 		virtual void join() const;
 		bool busy() const;
 		void evolve(int = 1);
 		void evolve_t(int);
 		void interrupt();
 		std::size_t get_evolution_time() const;
+		telemetry_type get_telemetry() const;
+		void reset_telemetry();
 	protected:
 		/// Method that implements the evolution of the population.
 		virtual void perform_evolution(const algorithm::base &, population &) const = 0;
@@ -154,6 +210,8 @@ class __PAGMO_VISIBLE base_island
 		// RAII threads hook object.
 		struct raii_thread_hook;
 		friend struct raii_thread_hook;
+		void evolution_step();
+		void sync_start();
 	protected:
 		/// Algorithm.
 		algorithm::base_ptr			m_algo;
@@ -169,6 +227,8 @@ class __PAGMO_VISIBLE base_island
 		migration::base_r_policy_ptr		m_r_policy;
 		/// Evolution thread.
 		boost::scoped_ptr<boost::thread>	m_evo_thread;
+		/// Evolution telemetry.
+		telemetry_type				m_telemetry;
 	private:
 		friend class boost::serialization::access;
 		template <class Archive>
@@ -182,6 +242,9 @@ class __PAGMO_VISIBLE base_island
 			ar & m_evo_time;
 			ar & m_s_policy;
 			ar & m_r_policy;
+			if (version >= 1) {
+				ar & m_telemetry;
+			}
 			boost::serialization::split_member(ar, *this, version);
 		}
 		template <class Archive>
@@ -235,5 +298,6 @@ class island_init: public base
 }
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT(pagmo::base_island)
+BOOST_CLASS_VERSION(pagmo::base_island,1)
 
 #endif
@@ -177,8 +177,6 @@ void mpi_environment::listen()
 			break;
 		}
 
-		// Create copy of data received
-		const boost::shared_ptr<population> pop_copy(new population(*payload.first));
 		try {
 			// Perform the evolution.
 			payload.second->evolve(*payload.first);
@@ -188,18 +186,19 @@ void mpi_environment::listen()
 			std::cout << "MPI Remote Error during island evolution using " << payload.second->get_name() << ", unknown exception caught. :(" << std::endl;
 		}
 
-		try {                
+		// NOTE: no backup copy of the received population is kept. The master still owns the original
+		// population, so if the evolved one cannot be sent back an empty payload is sent instead and
+		// the master keeps its own population.
+		try {
 			// Send back to the master the evolved population.
 			send(payload.first,0);
 		} catch (const boost::archive::archive_exception &e) {
 			std::cout << "MPI Send Error during island evolution using " << payload.second->get_name() << ": " << e.what() << std::endl;
-			// Send back to the master the original population.
-			send(pop_copy,0);
+			send(boost::shared_ptr<population>(),0);
 		} catch (...) {
 			std::cout << "MPI Send Error during island evolution using " << payload.second->get_name() << ", unknown exception caught. :(" << std::endl;
-			// Send back to the master the original population.
-			send(pop_copy,0);
-                }
+			send(boost::shared_ptr<population>(),0);
+		}
 	}
 	// Destroy the MPI environment before exiting.
 	MPI_Finalize();
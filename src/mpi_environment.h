@@ -25,13 +25,14 @@
 #ifndef PAGMO_MPI_ENVIRONMENT_H
 #define PAGMO_MPI_ENVIRONMENT_H
 
-#include <boost/archive/text_iarchive.hpp>
-#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/utility.hpp>
 #include <mpi.h>
-#include <sstream>
-#include <string>
 #include <vector>
 
 #include "config.h"
@@ -59,6 +60,9 @@ In a PaGMO MPI cluster, problem, population and algorithm instances are sent fro
 takes place. In order for the objects to be sent over the network, they need to be serializable. Serialization for all classes shipped with PaGMO is
 already implemented. The writer of new PaGMO classes will need to make sure that her own classes are serializable. 
 
+Objects are exchanged using Boost's binary archives, hence all nodes participating in the cluster must share the same
+architecture (endianness and size of the fundamental types) and must be running the same PaGMO executable.
+
 Additionally, it must always kept in mind that when working with MPI each processor is living inside a separate process: aside from the objects serialized
 and dispatched around in the cluster, there is no other form of communication. For instance, problems or algorithms employing a shared memory state
 (e.g., static class members) must be carefully treated during serialization in order to provide to the remote processes all the information needed
@@ -182,6 +186,8 @@ class __PAGMO_VISIBLE mpi_environment: private boost::noncopyable
 		/// Receive MPI payload.
 		/**
 		 * Receive an instance of class T from the processor with ID source and store it into retval.
+		 * The payload is transferred in a single MPI message: its size is determined via MPI_Probe, and the
+		 * incoming bytes are deserialised directly from the receive buffer.
 		 * This method is thread-safe only if mpi_environment::is_multithread returns true.
 		 * 
 		 * @param[out] retval instance of class T that will contain the payload.
@@ -192,23 +198,22 @@ class __PAGMO_VISIBLE mpi_environment: private boost::noncopyable
 		{
 			check_init();
 			MPI_Status status;
-			// First receive the size.
+			// Probe the incoming message to establish its size.
+			MPI_Probe(source,0,MPI_COMM_WORLD,&status);
 			int size;
-			MPI_Recv(static_cast<void *>(&size),1,MPI_INT,source,0,MPI_COMM_WORLD,&status);
-			// Prepare the vector of chars.
-			std::vector<char> buffer_char(boost::numeric_cast<std::vector<char>::size_type>(size),0);
+			MPI_Get_count(&status,MPI_CHAR,&size);
+			std::vector<char> buffer(boost::numeric_cast<std::vector<char>::size_type>(size),0);
 			// Receive the payload.
-			MPI_Recv(static_cast<void *>(&buffer_char[0]),size,MPI_CHAR,source,1,MPI_COMM_WORLD,&status);
-			// Build the string from the vector.
-			const std::string buffer_str(buffer_char.begin(),buffer_char.end());
-			// Unpickle the payload.
-			std::stringstream ss(buffer_str);
-			boost::archive::text_iarchive ia(ss);
+			MPI_Recv(static_cast<void *>(&buffer[0]),size,MPI_CHAR,source,0,MPI_COMM_WORLD,&status);
+			// Unpickle the payload in-place.
+			boost::iostreams::stream<boost::iostreams::array_source> is(&buffer[0],buffer.size());
+			boost::archive::binary_iarchive ia(is);
 			ia >> retval;
 		}
 		/// Send MPI payload.
 		/**
-		 * Send an instance of class T to the processor with ID destination.
+		 * Send an instance of class T to the processor with ID destination. The payload is serialised
+		 * into a binary archive and transferred in a single MPI message.
 		 * This method is thread-safe only if mpi_environment::is_multithread returns true.
 		 * 
 		 * @param[in] payload instance of class T that will be sent to destination.
@@ -218,16 +223,14 @@ class __PAGMO_VISIBLE mpi_environment: private boost::noncopyable
 		static void send(const T &payload, int destination)
 		{
 			check_init();
-			std::stringstream ss;
-			boost::archive::text_oarchive oa(ss);
-			oa << payload;
-			const std::string buffer_str(ss.str());
-			std::vector<char> buffer_char(buffer_str.begin(),buffer_str.end());
-			// Send the size.
-			int size = boost::numeric_cast<int>(buffer_char.size());
-			MPI_Send(static_cast<void *>(&size),1,MPI_INT,destination,0,MPI_COMM_WORLD);
-			// Send the string.
-			MPI_Send(static_cast<void *>(&buffer_char[0]),size,MPI_CHAR,destination,1,MPI_COMM_WORLD);
+			std::vector<char> buffer;
+			{
+				boost::iostreams::stream<boost::iostreams::back_insert_device<std::vector<char> > > os(buffer);
+				boost::archive::binary_oarchive oa(os);
+				oa << payload;
+			}
+			const int size = boost::numeric_cast<int>(buffer.size());
+			MPI_Send(static_cast<void *>(&buffer[0]),size,MPI_CHAR,destination,0,MPI_COMM_WORLD);
 		}
 		static bool iprobe(int);
 	private:
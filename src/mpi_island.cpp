@@ -53,6 +53,16 @@ boost::mutex mpi_island::m_mpi_mutex;
 std::list<mpi_island const *> mpi_island::m_queue;
 boost::scoped_ptr<std::set<int> > mpi_island::m_available_processors;
 
+namespace {
+
+// Deleter used to wrap a population in a non-owning shared pointer for serialisation.
+struct null_deleter
+{
+	void operator()(const void *) const {}
+};
+
+}
+
 /// Constructor from problem::base, algorithm::base, number of individuals, migration probability and selection/replacement policies.
 /**
  * @see pagmo::base_island constructors.
@@ -93,10 +103,11 @@ base_island_ptr mpi_island::clone() const
 // Method that perform the actual evolution for the island population, and is used to distribute the computation load over multiple processors
 void mpi_island::perform_evolution(const algorithm::base &algo, population &pop) const
 {
-	// Create copy of data to be transmitted - will use a std::pair for packing everything in a single object.
-	const boost::shared_ptr<population> pop_copy(new population(pop));
+	// Pack everything in a single object. The population is not copied: it is serialised directly
+	// from pop via a non-owning pointer, as it is left untouched until the evolved population comes back.
+	const boost::shared_ptr<population> pop_ptr(&pop,null_deleter());
 	const algorithm::base_ptr algo_copy = algo.clone();
-	const std::pair<boost::shared_ptr<population>,algorithm::base_ptr> out(pop_copy,algo_copy);
+	const std::pair<boost::shared_ptr<population>,algorithm::base_ptr> out(pop_ptr,algo_copy);
 	const int processor = acquire_processor();
 	if (mpi_environment::is_multithread()) {
 		mpi_environment::send(out,processor);
@@ -122,7 +133,8 @@ void mpi_island::perform_evolution(const algorithm::base &algo, population &pop)
 				boost::this_thread::sleep(boost::posix_time::milliseconds(10));
 			}
 		}
-		successful = true;
+		// A null population signals that the remote evolution could not be sent back.
+		successful = (in.get() != 0);
 	} catch (const boost::archive::archive_exception &e) {
 		std::cout << "MPI Recv Error during island evolution using " << algo.get_name() << ": " << e.what() << std::endl;
 	} catch (...) {
@@ -130,9 +142,7 @@ void mpi_island::perform_evolution(const algorithm::base &algo, population &pop)
 	}
 	release_processor(processor);
 	if (successful) {
-		// NOTE: implement via population::swap (to be written) in order to avoid
-		// extra copying?
-		pop = *in;
+		pop.swap(*in);
 	}
 }
 
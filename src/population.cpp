@@ -66,7 +66,8 @@ problem::base_ptr &population_access::get_problem_ptr(population &pop)
  *
  * @throw value_error if n is negative.
  */
-population::population(const problem::base &p, int n, const boost::uint32_t &seed):m_prob(p.clone()), m_pareto_rank(n), m_crowding_d(n), m_drng(seed),m_urng(seed)
+population::population(const problem::base &p, int n, const boost::uint32_t &seed):m_prob(p.clone()), m_dom_update(EAGER_DOM), m_dom_dirty(false),
+	m_pareto_rank(n), m_crowding_d(n), m_drng(seed),m_urng(seed)
 {
 	if (n < 0) {
 		pagmo_throw(value_error,"number of individuals cannot be negative");
@@ -76,6 +77,9 @@ population::population(const problem::base &p, int n, const boost::uint32_t &see
 	const fitness_vector::size_type f_size = m_prob->get_f_dimension();
 	const constraint_vector::size_type c_size = m_prob->get_c_dimension();
 	const decision_vector::size_type p_size = m_prob->get_dimension();
+	m_container.reserve(size);
+	m_dom_list.reserve(size);
+	m_dom_count.reserve(size);
 	for (size_type i = 0; i < size; ++i) {
 		// Push back an empty individual.
 		m_container.push_back(individual_type());
@@ -101,7 +105,7 @@ population::population(const problem::base &p, int n, const boost::uint32_t &see
  * @param[in] p population used to initialise this.
  */
 population::population(const population &p):m_prob(p.m_prob->clone()),m_container(p.m_container),m_dom_list(p.m_dom_list),m_dom_count(p.m_dom_count),
-	m_champion(p.m_champion), m_pareto_rank(p.m_pareto_rank), m_crowding_d(p.m_crowding_d),m_drng(p.m_drng),m_urng(p.m_urng)
+	m_dom_update(p.m_dom_update),m_dom_dirty(p.m_dom_dirty),m_champion(p.m_champion), m_pareto_rank(p.m_pareto_rank), m_crowding_d(p.m_crowding_d),m_drng(p.m_drng),m_urng(p.m_urng)
 {}
 
 /// Assignment operator.
@@ -121,6 +125,8 @@ population &population::operator=(const population &p)
 		m_container = p.m_container;
 		m_dom_list = p.m_dom_list;
 		m_dom_count = p.m_dom_count;
+		m_dom_update = p.m_dom_update;
+		m_dom_dirty = p.m_dom_dirty;
 		m_champion = p.m_champion;
 		m_pareto_rank = p.m_pareto_rank;
 		m_crowding_d = p.m_crowding_d;
@@ -130,6 +136,35 @@ population &population::operator=(const population &p)
 	return *this;
 }
 
+/// Swap contents with another population.
+/**
+ * Exchanges all the elements of this with the elements of p in constant time with respect to
+ * the size of the populations (the problems and the individuals are not copied). This is useful
+ * to replace a population with a freshly-received one (e.g., in pagmo::mpi_island) without
+ * incurring in the cost of a deep copy.
+ *
+ * @param[in,out] p population whose contents will be swapped with this.
+ */
+void population::swap(population &p)
+{
+	if (this != &p) {
+		pagmo_assert(m_prob && p.m_prob);
+		m_prob.swap(p.m_prob);
+		m_container.swap(p.m_container);
+		m_dom_list.swap(p.m_dom_list);
+		m_dom_count.swap(p.m_dom_count);
+		std::swap(m_dom_update,p.m_dom_update);
+		std::swap(m_dom_dirty,p.m_dom_dirty);
+		m_champion.x.swap(p.m_champion.x);
+		m_champion.c.swap(p.m_champion.c);
+		m_champion.f.swap(p.m_champion.f);
+		m_pareto_rank.swap(p.m_pareto_rank);
+		m_crowding_d.swap(p.m_crowding_d);
+		std::swap(m_drng,p.m_drng);
+		std::swap(m_urng,p.m_urng);
+	}
+}
+
 // Update the domination list and the domination count when the individual at position n has changed
 void population::update_dom(const size_type &n)
 {
@@ -142,6 +177,12 @@ void population::update_dom(const size_type &n)
 	const size_type size = m_container.size();
 	pagmo_assert(m_dom_list.size() == size && m_dom_count.size() == size && n < size);
 
+	// In lazy mode, everything will be recomputed when needed.
+	if (m_dom_update == LAZY_DOM || m_dom_dirty) {
+		m_dom_dirty = true;
+		return;
+	}
+
 	// Decrease the domination count for the individuals that were dominated
 	for  (size_type i = 0; i < m_dom_list[n].size(); ++i) {
 		m_dom_count[ m_dom_list[n][i] ]--;
@@ -179,6 +220,72 @@ void population::update_dom(const size_type &n)
 	}
 }
 
+// Recompute from scratch the domination lists and counts, if they are out of date.
+void population::update_dom_all() const
+{
+	if (!m_dom_dirty) {
+		return;
+	}
+	const size_type size = m_container.size();
+	pagmo_assert(m_dom_list.size() == size && m_dom_count.size() == size);
+	for (size_type i = 0; i < size; ++i) {
+		m_dom_list[i].clear();
+		m_dom_count[i] = 0;
+	}
+	// Each pair is visited once. As domination is asymmetric, the reverse comparison is
+	// needed only when the first one fails.
+	for (size_type i = 0; i < size; ++i) {
+		for (size_type j = i + 1; j < size; ++j) {
+			if (m_prob->compare_fc(m_container[i].best_f,m_container[i].best_c,m_container[j].best_f,m_container[j].best_c)) {
+				m_dom_list[i].push_back(j);
+				m_dom_count[j]++;
+			} else if (m_prob->compare_fc(m_container[j].best_f,m_container[j].best_c,m_container[i].best_f,m_container[i].best_c)) {
+				m_dom_list[j].push_back(i);
+				m_dom_count[i]++;
+			}
+		}
+	}
+	m_dom_dirty = false;
+}
+
+/// Set the update policy of the domination information.
+/**
+ * With population::EAGER_DOM (the default), the domination list and count of all individuals are updated each time an individual is
+ * modified, added or removed. This costs a scan of the population for each modification.
+ *
+ * With population::LAZY_DOM, modifications only mark the domination information as out of date, and the domination lists and counts
+ * are recomputed in a single pass the next time they are needed (e.g., by get_domination_list(), get_domination_count() or
+ * update_pareto_information()). This is convenient when many individuals are modified before the domination information is used, as
+ * it happens in generational multi-objective algorithms. It is not convenient when the domination information is queried after every
+ * modification (e.g., in steady-state algorithms). In this mode update_pareto_information() and compute_pareto_fronts() rank the
+ * individuals with a fast non-dominated sort, which does not need the domination lists, unless the problem reimplements the comparison
+ * of fitness and constraint vectors (see problem::base::has_default_comparison()).
+ *
+ * The results are the same in both modes, apart from the order of the indices in the domination lists.
+ *
+ * @param[in] dom_update update policy.
+ *
+ * @throws value_error if dom_update is not a valid policy.
+ */
+void population::set_dom_update(dom_update_type dom_update)
+{
+	if (dom_update != EAGER_DOM && dom_update != LAZY_DOM) {
+		pagmo_throw(value_error,"invalid domination update policy");
+	}
+	// Leaving the lazy mode requires up-to-date information.
+	update_dom_all();
+	m_dom_update = dom_update;
+}
+
+/// Get the update policy of the domination information.
+/**
+ * @return the update policy of the domination information.
+ */
+population::dom_update_type population::get_dom_update() const
+{
+	return m_dom_update;
+}
+
 // Init randomly the velocity of the individual in position idx.
 void population::init_velocity(const size_type &idx)
 {
@@ -298,6 +405,7 @@ const std::vector<population::size_type> &population::get_domination_list(const
 	if (idx >= size()) {
 		pagmo_throw(index_error,"invalid index");
 	}
+	update_dom_all();
 	return m_dom_list[idx];
 }
 
@@ -316,6 +424,7 @@ population::size_type population::get_domination_count(const size_type &idx) con
 	if (idx >= size()) {
 		pagmo_throw(index_error,"invalid index");
 	}
+	update_dom_all();
 	return m_dom_count[idx];
 }
 
@@ -361,24 +470,55 @@ double population::get_crowding_d(const size_type &idx) const
 	return m_crowding_d[idx];
 }
 
-// This functor is used to sort (minimization assumed) along a particular fitness dimension.
-// Needed for the computations of the crowding distance
+// This functor is used to sort (minimization assumed) positions within a contiguous vector of values
+// of one fitness component. Needed for the computations of the crowding distance
 struct one_dim_fit_comp {
-	one_dim_fit_comp(const population &pop, fitness_vector::size_type dim):m_pop(pop), m_dim(dim) {};
-	bool operator()(const population::size_type& idx1, const population::size_type& idx2) const
+	one_dim_fit_comp(const double *values):m_values(values) {};
+	bool operator()(const population::size_type& p1, const population::size_type& p2) const
 	{
-		return m_pop.get_individual(idx1).cur_f[m_dim] < m_pop.get_individual(idx2).cur_f[m_dim];
+		return m_values[p1] < m_values[p2];
 	}
-	const population& m_pop;
-	fitness_vector::size_type m_dim;
+	const double *m_values;
 };
 
 
+// This functor orders the individuals so that, under the default problem::base::compare_fc(), an individual can only be
+// dominated by individuals coming before it: feasible individuals come first, sorted lexicographically by fitness, and the
+// infeasible ones are sorted by problem::base::compare_constraints() and then lexicographically by fitness.
+struct presort_comp {
+	presort_comp(const problem::base &prob, const population::container_type &container):m_prob(prob),m_container(container) {};
+	bool operator()(const population::size_type& p1, const population::size_type& p2) const
+	{
+		const population::individual_type &i1 = m_container[p1], &i2 = m_container[p2];
+		if (m_prob.get_c_dimension()) {
+			const bool feas1 = m_prob.feasibility_c(i1.best_c), feas2 = m_prob.feasibility_c(i2.best_c);
+			if (feas1 != feas2) {
+				return feas1;
+			}
+			if (!feas1) {
+				if (m_prob.compare_constraints(i1.best_c,i2.best_c)) {
+					return true;
+				}
+				if (m_prob.compare_constraints(i2.best_c,i1.best_c)) {
+					return false;
+				}
+			}
+		}
+		return std::lexicographical_compare(i1.best_f.begin(),i1.best_f.end(),i2.best_f.begin(),i2.best_f.end());
+	}
+	const problem::base &m_prob;
+	const population::container_type &m_container;
+};
+
 /// Update Pareto Information
 /**
  * Computes all pareto fronts, updates the pareto rank and the crowding distance of each individual.
  * Member variables for rank and crowding distance are set to zero and domination lists and
  * domination count are used to for the computation.
+ *
+ * If the domination information is out of date (see population::set_dom_update()) and the problem compares fitness and constraint
+ * vectors with the default rules (see problem::base::has_default_comparison()), the fronts are instead computed with a fast
+ * non-dominated sorting algorithm, without building the domination lists.
  */
 
 void population::update_pareto_information() const {
@@ -390,42 +530,99 @@ void population::update_pareto_information() const {
 	std::fill(m_pareto_rank.begin(), m_pareto_rank.end(), 0);
 	std::fill(m_crowding_d.begin(), m_crowding_d.end(), 0);
 
-	// We define some utility vectors .....
-	std::vector<population::size_type> F,S;
+	std::vector<std::vector<population::size_type> > fronts;
+	if (m_dom_dirty && m_prob->has_default_comparison()) {
+		fronts = sort_non_dominated();
+	} else {
+		update_dom_all();
 
-	// And make a copy of the domination count (number of individuals that dominating one individual)
-	std::vector<population::size_type> dom_count_copy(m_dom_count);
+		// We define some utility vectors .....
+		std::vector<population::size_type> F,S;
 
-	// 1 - Find the first Pareto Front
-	for (population::size_type idx = 0; idx < m_container.size(); ++idx){
-		if (m_dom_count[idx] == 0) {
-			F.push_back(idx);
-		}
-	}
+		// And make a copy of the domination count (number of individuals that dominating one individual)
+		std::vector<population::size_type> dom_count_copy(m_dom_count);
 
-	unsigned int irank = 1;
+		// 1 - Find the first Pareto Front
+		for (population::size_type idx = 0; idx < m_container.size(); ++idx){
+			if (m_dom_count[idx] == 0) {
+				F.push_back(idx);
+			}
+		}
 
-	// We loop to find subsequent fronts
-	while (F.size()!=0) {
-		// update crowding distance of the current pareto front
-		population::update_crowding_d(F);
-		//For each individual F in the current front
-		for (population::size_type i=0; i < F.size(); ++i) {
-			//For each individual dominated by F
-			for (population::size_type j=0; j<m_dom_list[F[i]].size(); ++j) {
-				dom_count_copy[m_dom_list[F[i]][j]]--;
-				if (dom_count_copy[m_dom_list[F[i]][j]] == 0){
-					S.push_back(m_dom_list[F[i]][j]);
-					m_pareto_rank[m_dom_list[F[i]][j]] = irank;
+		// We loop to find subsequent fronts
+		while (F.size()!=0) {
+			//For each individual F in the current front
+			for (population::size_type i=0; i < F.size(); ++i) {
+				//For each individual dominated by F
+				for (population::size_type j=0; j<m_dom_list[F[i]].size(); ++j) {
+					dom_count_copy[m_dom_list[F[i]][j]]--;
+					if (dom_count_copy[m_dom_list[F[i]][j]] == 0){
+						S.push_back(m_dom_list[F[i]][j]);
+					}
 				}
 			}
+			fronts.push_back(F);
+			F = S;
+			S.clear();
 		}
-		F = S;
-		S.clear();
-		irank++;
+	}
+
+	for (std::vector<std::vector<population::size_type> >::size_type irank = 0; irank < fronts.size(); ++irank) {
+		// The individuals of a front are sorted by position, so that the crowding distances do not depend on the
+		// order in which the front was found
+		std::sort(fronts[irank].begin(), fronts[irank].end());
+		for (population::size_type i = 0; i < fronts[irank].size(); ++i) {
+			m_pareto_rank[fronts[irank][i]] = irank;
+		}
+		// update crowding distance of the current pareto front
+		population::update_crowding_d(fronts[irank]);
 	}
 }
 
+// Efficient non-dominated sort with binary search (ENS-BS). The individuals are visited in an order in which no individual
+// dominates one visited before it, hence each of them can be put in its front as soon as it is visited: the fronts found so far
+// are ordered by domination, and the binary search finds the first of them containing no individual dominating it. Most
+// comparisons are avoided with respect to the pairwise scan, in particular with few objectives.
+// Requires compare_fc() to follow the default rules, as the order of the visit is derived from them.
+// Returns the Pareto fronts, from the first one.
+//
+// See: Xingyi Zhang, Ye Tian, Ran Cheng and Yaochu Jin, "An efficient approach to nondominated sorting for evolutionary
+// multiobjective optimization", IEEE Transactions on Evolutionary Computation 19(2), 2015.
+std::vector<std::vector<population::size_type> > population::sort_non_dominated() const
+{
+	const size_type size = m_container.size();
+	std::vector<size_type> order(size);
+	for (size_type i = 0; i < size; ++i) {
+		order[i] = i;
+	}
+	std::sort(order.begin(), order.end(), presort_comp(*m_prob, m_container));
+
+	std::vector<std::vector<size_type> > fronts;
+	for (size_type i = 0; i < size; ++i) {
+		const individual_type &ind = m_container[order[i]];
+		std::vector<std::vector<size_type> >::size_type low = 0, high = fronts.size();
+		while (low < high) {
+			const std::vector<std::vector<size_type> >::size_type mid = low + (high - low) / 2;
+			// The last individuals put in a front are the closest ones in the order of the visit, hence the most
+			// likely to dominate the current one: the front is scanned backwards
+			bool dominated = false;
+			for (size_type j = fronts[mid].size(); j > 0 && !dominated; --j) {
+				const individual_type &other = m_container[fronts[mid][j - 1]];
+				dominated = m_prob->compare_fc(other.best_f,other.best_c,ind.best_f,ind.best_c);
+			}
+			if (dominated) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+		if (low == fronts.size()) {
+			fronts.push_back(std::vector<size_type>());
+		}
+		fronts[low].push_back(order[i]);
+	}
+	return fronts;
+}
 
 /// Update Crowding Distance
 /**
@@ -439,29 +636,44 @@ void population::update_pareto_information() const {
  */
 void population::update_crowding_d(std::vector<population::size_type> I) const {
 
-	size_type lastidx = I.size() - 1;
+	const size_type n = I.size(), lastidx = n - 1;
+	const fitness_vector::size_type f_dim = problem().get_f_dimension();
+
+	// we copy the fitnesses of the front in contiguous storage, one fitness component after the other,
+	// so that sorting and differencing along a component work on consecutive memory locations
+	std::vector<double> fit(n * f_dim);
+	for (size_type j = 0; j < n; ++j) {
+		const fitness_vector &f = m_container[I[j]].cur_f;
+		for (fitness_vector::size_type i = 0; i < f_dim; ++i) {
+			fit[i * n + j] = f[i];
+		}
+	}
 
-	// we construct the comparison functor along the first fitness component
-		one_dim_fit_comp funct(*this,0);
+	// positions of the individuals of the front in fit, sorted along the current fitness component
+	std::vector<size_type> P(n);
+	for (size_type j = 0; j < n; ++j) {
+		P[j] = j;
+	}
 
 	// we loop along fitness components
-		for (fitness_vector::size_type i = 0; i < problem().get_f_dimension(); ++i) {
-			funct.m_dim = i;
-				// we sort I along the fitness_dimension i
-		std::sort(I.begin(),I.end(), funct );
-			// assign Inf to the boundaries
-			m_crowding_d[I[0]] = std::numeric_limits<double>::max();
-			m_crowding_d[I[lastidx]] = std::numeric_limits<double>::max();
-			//and compute the crowding distance
-			double df = get_individual(I[lastidx]).cur_f[i] - get_individual(I[0]).cur_f[i];
-			for (population::size_type j = 1; j < lastidx; ++j) {
-				if (df == 0.0) { 						// handles the case in which the pareto front collapses to one single point
-					m_crowding_d[I[j]] += 0.0;			// avoiding creation of nans that can't be serialized
-				} else {
-					m_crowding_d[I[j]] += (get_individual(I[j+1]).cur_f[i] - get_individual(I[j-1]).cur_f[i])/df;
-				}
-			}
+	for (fitness_vector::size_type i = 0; i < f_dim; ++i) {
+		const double *values = &fit[i * n];
+		// we sort the positions along the fitness_dimension i
+		std::sort(P.begin(),P.end(),one_dim_fit_comp(values));
+		// assign Inf to the boundaries
+		m_crowding_d[I[P[0]]] = std::numeric_limits<double>::max();
+		m_crowding_d[I[P[lastidx]]] = std::numeric_limits<double>::max();
+		//and compute the crowding distance
+		const double df = values[P[lastidx]] - values[P[0]];
+		if (df == 0.0) {
+			// handles the case in which the pareto front collapses to one single point
+			// avoiding creation of nans that can't be serialized
+			continue;
 		}
+		for (population::size_type j = 1; j < lastidx; ++j) {
+			m_crowding_d[I[P[j]]] += (values[P[j+1]] - values[P[j-1]])/df;
+		}
+	}
 }
 
 /// Computes and returns the population Pareto fronts
@@ -850,6 +1062,7 @@ std::string population::human_readable() const
 	std::ostringstream oss;
 	oss << human_readable_terse();
 	if (size()) {
+		update_dom_all();
 		oss << "\nList of individuals:\n";
 		for (size_type i = 0; i < size(); ++i) {
 			oss << '#' << i << ":\n";
@@ -900,6 +1113,82 @@ void population::set_x(const size_type &idx, const decision_vector &x)
 	m_prob->objfun(m_container[idx].cur_f,x);
 	// Update current constraints vector.
 	m_prob->compute_constraints(m_container[idx].cur_c,x);
+	update_individual(idx);
+}
+
+/// Set the decision vector of individual at position idx to x, with known fitness and constraint vectors.
+/**
+ * Same as set_x(const size_type &, const decision_vector &), but the fitness and constraint vectors of x are not computed and the
+ * values f and c are used instead. The caller is responsible for providing the values that problem() would compute for x,
+ * typically obtained through problem::base::objfun_batch() and problem::base::compute_constraints_batch().
+ *
+ * @param[in] idx positional index of the individual to be set.
+ * @param[in] x decision vector to be set for the individual at position idx.
+ * @param[in] f fitness vector of x.
+ * @param[in] c constraint vector of x.
+ *
+ * @throws index_error if idx is out of range.
+ * @throws value_error if x, f or c are not compatible with the problem.
+ */
+void population::set_x(const size_type &idx, const decision_vector &x, const fitness_vector &f, const constraint_vector &c)
+{
+	if (idx >= size()) {
+		pagmo_throw(index_error,"invalid individual position");
+	}
+	if (!m_prob->verify_x(x)) {
+		pagmo_throw(value_error,"decision vector is not compatible with problem");
+	}
+	if (f.size() != m_prob->get_f_dimension() || c.size() != m_prob->get_c_dimension()) {
+		pagmo_throw(value_error,"fitness and/or constraint vectors are not compatible with problem");
+	}
+	m_container[idx].cur_x = x;
+	m_container[idx].cur_f = f;
+	m_container[idx].cur_c = c;
+	update_individual(idx);
+}
+
+/// Set the decision vectors of a batch of individuals.
+/**
+ * The decision vector of the individual at position idx[i] will be set to x[i]. All fitness and constraint vectors are computed
+ * with a single call to problem::base::objfun_batch() and problem::base::compute_constraints_batch(), the individuals are then updated in order
+ * as in set_x().
+ *
+ * @param[in] idx positional indices of the individuals to be set.
+ * @param[in] x decision vectors to be set.
+ *
+ * @throws index_error if any index is out of range.
+ * @throws value_error if idx and x have different sizes or if any decision vector is not compatible with the problem.
+ */
+void population::set_x_batch(const std::vector<size_type> &idx, const std::vector<decision_vector> &x)
+{
+	if (idx.size() != x.size()) {
+		pagmo_throw(value_error,"inconsistent sizes of indices and decision vectors");
+	}
+	for (std::vector<size_type>::size_type i = 0; i < idx.size(); ++i) {
+		if (idx[i] >= size()) {
+			pagmo_throw(index_error,"invalid individual position");
+		}
+		if (!m_prob->verify_x(x[i])) {
+			pagmo_throw(value_error,"decision vector is not compatible with problem");
+		}
+	}
+	std::vector<fitness_vector> f;
+	std::vector<constraint_vector> c;
+	m_prob->objfun_batch(f,x);
+	m_prob->compute_constraints_batch(c,x);
+	for (std::vector<size_type>::size_type i = 0; i < idx.size(); ++i) {
+		m_container[idx[i]].cur_x = x[i];
+		m_container[idx[i]].cur_f.swap(f[i]);
+		m_container[idx[i]].cur_c.swap(c[i]);
+		update_individual(idx[i]);
+	}
+}
+
+// Update the bests of the individual in position idx, the champion and the domination lists after the current
+// decision, fitness and constraint vectors of the individual have been set.
+void population::update_individual(const size_type &idx)
+{
+	pagmo_assert(idx < m_container.size());
 	// If needed, update the best decision, fitness and constraint vectors for the individual.
 	// NOTE: we update the bests in two cases:
 	// - the bests are empty, meaning they are not defined and we are being called by push_back()
@@ -936,10 +1225,16 @@ void population::erase(const population::size_type & idx) {
 	if (idx >= size()) {
 		pagmo_throw(index_error,"invalid individual position");
 	}
+	m_container.erase(m_container.begin() + idx);
+	// If the domination information is out of date, it will be recomputed anyway.
+	if (m_dom_dirty) {
+		m_dom_count.erase(m_dom_count.begin() + idx);
+		m_dom_list.erase(m_dom_list.begin() + idx);
+		return;
+	}
 	for (population::size_type i = 0; i < m_dom_list[idx].size(); ++i) {
 		m_dom_count[m_dom_list[idx][i]]--;
 	}
-	m_container.erase(m_container.begin() + idx);
 	m_dom_count.erase(m_dom_count.begin() + idx);
 	m_dom_list.erase(m_dom_list.begin() + idx);
 	// Since an element is erased indexes in dom_list need an update
@@ -992,6 +1287,72 @@ void population::push_back(const decision_vector &x)
 	init_velocity(m_container.size() - 1);
 }
 
+/// Append individual with given decision vector, with known fitness and constraint vectors.
+/**
+ * Same as push_back(const decision_vector &), but the fitness and constraint vectors of x are not computed and the values f and c are
+ * used instead. The caller is responsible for providing the values that problem() would compute for x, as in
+ * set_x(const size_type &, const decision_vector &, const fitness_vector &, const constraint_vector &).
+ *
+ * @param[in] x decision vector of the individual to be appended.
+ * @param[in] f fitness vector of x.
+ * @param[in] c constraint vector of x.
+ *
+ * @throws value_error if x, f or c are not compatible with the problem.
+ */
+void population::push_back(const decision_vector &x, const fitness_vector &f, const constraint_vector &c)
+{
+	if (!m_prob->verify_x(x)) {
+		pagmo_throw(value_error,"decision vector is not compatible with problem");
+	}
+	if (f.size() != m_prob->get_f_dimension() || c.size() != m_prob->get_c_dimension()) {
+		pagmo_throw(value_error,"fitness and/or constraint vectors are not compatible with problem");
+	}
+	m_container.push_back(individual_type());
+	m_dom_list.push_back(std::vector<size_type>());
+	m_dom_count.push_back(0);
+	m_container.back().cur_x = x;
+	m_container.back().cur_v.resize(m_prob->get_dimension());
+	m_container.back().cur_f = f;
+	m_container.back().cur_c = c;
+	update_individual(m_container.size() - 1);
+	init_velocity(m_container.size() - 1);
+}
+
+/// Append a batch of individuals with given decision vectors.
+/**
+ * Equivalent to calling push_back() on each element of x, but all fitness and constraint vectors are computed
+ * with a single call to problem::base::objfun_batch() and problem::base::compute_constraints_batch().
+ *
+ * @param[in] x decision vectors of the individuals to be appended.
+ *
+ * @throws value_error if any decision vector is not compatible with the problem.
+ */
+void population::push_back_batch(const std::vector<decision_vector> &x)
+{
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (!m_prob->verify_x(x[i])) {
+			pagmo_throw(value_error,"decision vector is not compatible with problem");
+		}
+	}
+	std::vector<fitness_vector> f;
+	std::vector<constraint_vector> c;
+	m_prob->objfun_batch(f,x);
+	m_prob->compute_constraints_batch(c,x);
+	const decision_vector::size_type p_size = m_prob->get_dimension();
+	m_container.reserve(m_container.size() + x.size());
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		m_container.push_back(individual_type());
+		m_dom_list.push_back(std::vector<size_type>());
+		m_dom_count.push_back(0);
+		m_container.back().cur_x = x[i];
+		m_container.back().cur_v.resize(p_size);
+		m_container.back().cur_f.swap(f[i]);
+		m_container.back().cur_c.swap(c[i]);
+		update_individual(m_container.size() - 1);
+		init_velocity(m_container.size() - 1);
+	}
+}
+
 /// Set the velocity vector of individual at position idx.
 /**
  * Will fail if dimension of v differs from the problem dimension.
@@ -1052,11 +1413,187 @@ void population::clear()
 	m_container.clear();
 	m_dom_list.clear();
 	m_dom_count.clear();
+	m_dom_dirty = false;
 	m_crowding_d.clear();
 	m_pareto_rank.clear();
 	m_champion = champion_type();
 }
 
+// Member of an individual corresponding to a population::field_type.
+const std::vector<double> &population::get_field(const individual_type &ind, field_type field)
+{
+	switch (field) {
+		case CUR_X:
+			return ind.cur_x;
+		case CUR_V:
+			return ind.cur_v;
+		case CUR_C:
+			return ind.cur_c;
+		case CUR_F:
+			return ind.cur_f;
+		case BEST_X:
+			return ind.best_x;
+		case BEST_C:
+			return ind.best_c;
+		case BEST_F:
+			return ind.best_f;
+	}
+	pagmo_throw(value_error,"invalid individual field");
+}
+
+/// Copy a member of all individuals into a contiguous matrix.
+/**
+ * The selected member of all individuals (e.g., the current fitness vectors if field is population::CUR_F) is written into m as
+ * a row-major matrix, with one row per individual. The number of columns is the problem dimension for decision and velocity vectors,
+ * the fitness dimension for fitness vectors and the constraints dimension for constraint vectors. m is resized accordingly.
+ *
+ * This allows to stream over the whole population with unit stride, which is significantly faster than accessing
+ * the individuals one by one when the same computation must be performed on all of them.
+ *
+ * @param[out] m vector into which the matrix will be written.
+ * @param[in] field member of the individuals to be copied.
+ *
+ * @throws value_error if field is not valid.
+ */
+void population::get_matrix(std::vector<double> &m, field_type field) const
+{
+	size_type n_cols;
+	switch (field) {
+		case CUR_X:
+		case CUR_V:
+		case BEST_X:
+			n_cols = m_prob->get_dimension();
+			break;
+		case CUR_C:
+		case BEST_C:
+			n_cols = m_prob->get_c_dimension();
+			break;
+		case CUR_F:
+		case BEST_F:
+			n_cols = m_prob->get_f_dimension();
+			break;
+		default:
+			pagmo_throw(value_error,"invalid individual field");
+	}
+	m.resize(m_container.size() * n_cols);
+	std::vector<double>::iterator it = m.begin();
+	for (size_type i = 0; i < m_container.size(); ++i) {
+		const std::vector<double> &v = get_field(m_container[i],field);
+		pagmo_assert(v.size() == n_cols);
+		it = std::copy(v.begin(),v.end(),it);
+	}
+}
+
+/// Copy all individuals into a block.
+/**
+ * The members of all individuals are written into the row-major matrices of block, as in get_matrix(). Copying the block afterwards
+ * (e.g., to ship the individuals to another island) costs one memory copy per matrix.
+ *
+ * @param[out] block block into which the individuals will be written.
+ */
+void population::get_block(block_type &block) const
+{
+	block.n = m_container.size();
+	block.dimension = m_prob->get_dimension();
+	block.c_dimension = m_prob->get_c_dimension();
+	block.f_dimension = m_prob->get_f_dimension();
+	get_matrix(block.cur_x,CUR_X);
+	get_matrix(block.cur_v,CUR_V);
+	get_matrix(block.cur_c,CUR_C);
+	get_matrix(block.cur_f,CUR_F);
+	get_matrix(block.best_x,BEST_X);
+	get_matrix(block.best_c,BEST_C);
+	get_matrix(block.best_f,BEST_F);
+}
+
+/// Replace the individuals with the contents of a block.
+/**
+ * The individuals of the population are replaced by the individuals stored in block, typically obtained through get_block()
+ * from a population with the same problem. The fitness and constraint vectors are not recomputed, and the caller is responsible
+ * for their consistency with problem(). The champion and the domination information are rebuilt from the best vectors of the new individuals.
+ *
+ * @param[in] block block containing the new individuals.
+ *
+ * @throws value_error if the dimensions of block are not compatible with the problem, if the sizes of its matrices are not consistent
+ * with its dimensions or if any current decision vector is not compatible with the problem.
+ */
+void population::set_block(const block_type &block)
+{
+	if (block.dimension != m_prob->get_dimension() || block.c_dimension != m_prob->get_c_dimension() ||
+		block.f_dimension != m_prob->get_f_dimension())
+	{
+		pagmo_throw(value_error,"block is not compatible with problem");
+	}
+	if (block.cur_x.size() != block.n * block.dimension || block.cur_v.size() != block.n * block.dimension ||
+		block.best_x.size() != block.n * block.dimension || block.cur_c.size() != block.n * block.c_dimension ||
+		block.best_c.size() != block.n * block.c_dimension || block.cur_f.size() != block.n * block.f_dimension ||
+		block.best_f.size() != block.n * block.f_dimension)
+	{
+		pagmo_throw(value_error,"inconsistent sizes of the block matrices");
+	}
+	for (size_type i = 0; i < block.n; ++i) {
+		const decision_vector x(block.cur_x.begin() + i * block.dimension,block.cur_x.begin() + (i + 1) * block.dimension);
+		if (!m_prob->verify_x(x)) {
+			pagmo_throw(value_error,"decision vector is not compatible with problem");
+		}
+	}
+	clear();
+	load_block(block);
+	m_dom_list.resize(block.n);
+	m_dom_count.resize(block.n,0);
+	for (size_type i = 0; i < block.n; ++i) {
+		update_champion(i);
+	}
+	m_dom_dirty = true;
+	if (m_dom_update == EAGER_DOM) {
+		update_dom_all();
+	}
+}
+
+// Replace the container of individuals with the contents of block.
+void population::load_block(const block_type &block)
+{
+	m_container.resize(block.n);
+	for (size_type i = 0; i < block.n; ++i) {
+		const block_type::individual_view ind = block[i];
+		m_container[i].cur_x.assign(ind.cur_x,ind.cur_x + ind.dimension);
+		m_container[i].cur_v.assign(ind.cur_v,ind.cur_v + ind.dimension);
+		m_container[i].cur_c.assign(ind.cur_c,ind.cur_c + ind.c_dimension);
+		m_container[i].cur_f.assign(ind.cur_f,ind.cur_f + ind.f_dimension);
+		m_container[i].best_x.assign(ind.best_x,ind.best_x + ind.dimension);
+		m_container[i].best_c.assign(ind.best_c,ind.best_c + ind.c_dimension);
+		m_container[i].best_f.assign(ind.best_f,ind.best_f + ind.f_dimension);
+	}
+}
+
+/// View of an individual of the block.
+/**
+ * @param[in] idx position of the individual in the block.
+ *
+ * @return view of the rows of the individual at position idx.
+ *
+ * @throws index_error if idx is out of range.
+ */
+population::block_type::individual_view population::block_type::operator[](const size_type &idx) const
+{
+	if (idx >= n) {
+		pagmo_throw(index_error,"invalid individual position");
+	}
+	individual_view retval;
+	// NOTE: empty matrices (e.g., the constraints of unconstrained problems) give null pointers.
+	retval.cur_x = dimension ? &cur_x[idx * dimension] : 0;
+	retval.cur_v = dimension ? &cur_v[idx * dimension] : 0;
+	retval.cur_c = c_dimension ? &cur_c[idx * c_dimension] : 0;
+	retval.cur_f = f_dimension ? &cur_f[idx * f_dimension] : 0;
+	retval.best_x = dimension ? &best_x[idx * dimension] : 0;
+	retval.best_c = c_dimension ? &best_c[idx * c_dimension] : 0;
+	retval.best_f = f_dimension ? &best_f[idx * f_dimension] : 0;
+	retval.dimension = dimension;
+	retval.c_dimension = c_dimension;
+	retval.f_dimension = f_dimension;
+	return retval;
+}
+
 /// Iterator to the beginning of the population.
 /**
  * @return iterator to the first individual.
@@ -185,6 +185,36 @@ class __PAGMO_VISIBLE population
 					boost::serialization::split_member(ar,*this,version);
 				}
 		};
+		/// Members of individual_type that can be copied into contiguous matrices.
+		/**
+		 * @see population::get_matrix().
+		 */
+		enum field_type {
+			/// Current decision vectors.
+			CUR_X,
+			/// Current velocity vectors.
+			CUR_V,
+			/// Current constraint vectors.
+			CUR_C,
+			/// Current fitness vectors.
+			CUR_F,
+			/// Best decision vectors.
+			BEST_X,
+			/// Best constraint vectors.
+			BEST_C,
+			/// Best fitness vectors.
+			BEST_F
+		};
+		/// Update policy of the domination information.
+		/**
+		 * @see population::set_dom_update().
+		 */
+		enum dom_update_type {
+			/// Update after each modification of the population.
+			EAGER_DOM = 0,
+			/// Recompute when needed.
+			LAZY_DOM = 1
+		};
 		/// Underlying container type.
 		typedef std::vector<individual_type> container_type;
 
@@ -193,12 +223,118 @@ class __PAGMO_VISIBLE population
 
 		/// Const iterator.
 		typedef container_type::const_iterator const_iterator;
+		/// Individuals stored as contiguous matrices.
+		/**
+		 * Structure-of-arrays representation of the individuals of a population: each member of individual_type is stored for all
+		 * the individuals in a single row-major matrix, with one row per individual. The matrices can be scanned with unit stride,
+		 * and copying a block, or writing it into a binary archive, costs a single memory copy per matrix, instead of one per member
+		 * of each individual.
+		 *
+		 * @see population::get_block(), population::set_block().
+		 */
+		struct block_type
+		{
+				/// Read-only view of an individual stored in a block.
+				/**
+				 * The pointers address the rows of the individual in the matrices of the block. They are invalidated
+				 * by any modification of the block.
+				 */
+				struct individual_view
+				{
+					/// Current decision vector.
+					const double			*cur_x;
+					/// Current velocity vector.
+					const double			*cur_v;
+					/// Current constraint vector.
+					const double			*cur_c;
+					/// Current fitness vector.
+					const double			*cur_f;
+					/// Best decision vector so far.
+					const double			*best_x;
+					/// Best constraint vector so far.
+					const double			*best_c;
+					/// Best fitness vector so far.
+					const double			*best_f;
+					/// Size of the decision and velocity vectors.
+					decision_vector::size_type	dimension;
+					/// Size of the constraint vectors.
+					constraint_vector::size_type	c_dimension;
+					/// Size of the fitness vectors.
+					fitness_vector::size_type	f_dimension;
+				};
+				/// Default constructor.
+				/**
+				 * Builds an empty block.
+				 */
+				block_type():n(0),dimension(0),c_dimension(0),f_dimension(0) {}
+				individual_view operator[](const size_type &) const;
+				/// Number of individuals.
+				size_type			n;
+				/// Size of the decision and velocity vectors.
+				decision_vector::size_type	dimension;
+				/// Size of the constraint vectors.
+				constraint_vector::size_type	c_dimension;
+				/// Size of the fitness vectors.
+				fitness_vector::size_type	f_dimension;
+				/// Current decision vectors.
+				std::vector<double>		cur_x;
+				/// Current velocity vectors.
+				std::vector<double>		cur_v;
+				/// Current constraint vectors.
+				std::vector<double>		cur_c;
+				/// Current fitness vectors.
+				std::vector<double>		cur_f;
+				/// Best decision vectors so far.
+				std::vector<double>		best_x;
+				/// Best constraint vectors so far.
+				std::vector<double>		best_c;
+				/// Best fitness vectors so far.
+				std::vector<double>		best_f;
+			private:
+				friend class boost::serialization::access;
+				template <class Archive>
+				void save(Archive &ar, const unsigned int version) const
+				{
+					ar << n;
+					ar << dimension;
+					ar << c_dimension;
+					ar << f_dimension;
+					custom_vector_double_save(ar,cur_x,version);
+					custom_vector_double_save(ar,cur_v,version);
+					custom_vector_double_save(ar,cur_c,version);
+					custom_vector_double_save(ar,cur_f,version);
+					custom_vector_double_save(ar,best_x,version);
+					custom_vector_double_save(ar,best_c,version);
+					custom_vector_double_save(ar,best_f,version);
+				}
+				template <class Archive>
+				void load(Archive &ar, const unsigned int version)
+				{
+					ar >> n;
+					ar >> dimension;
+					ar >> c_dimension;
+					ar >> f_dimension;
+					custom_vector_double_load(ar,cur_x,version);
+					custom_vector_double_load(ar,cur_v,version);
+					custom_vector_double_load(ar,cur_c,version);
+					custom_vector_double_load(ar,cur_f,version);
+					custom_vector_double_load(ar,best_x,version);
+					custom_vector_double_load(ar,best_c,version);
+					custom_vector_double_load(ar,best_f,version);
+				}
+				template <class Archive>
+				void serialize(Archive &ar, const unsigned int version)
+				{
+					boost::serialization::split_member(ar,*this,version);
+				}
+		};
 		explicit population(const problem::base &, int = 0, const boost::uint32_t &seed = getSeed());
         static boost::uint32_t getSeed(){
 			return rng_generator::get<rng_uint32>()();
 		}
 		population(const population &);
 		population &operator=(const population &);
+		void swap(population &);
 		const individual_type &get_individual(const size_type &) const;
 
 		// Multi-Objective stuff
@@ -207,6 +343,8 @@ class __PAGMO_VISIBLE population
 		size_type get_pareto_rank(const size_type &) const;
 		double get_crowding_d(const size_type &) const;
 		void update_pareto_information() const;
+		void set_dom_update(dom_update_type);
+		dom_update_type get_dom_update() const;
 		size_type n_dominated(const individual_type &) const;
 		std::vector<std::vector<size_type> > compute_pareto_fronts() const;
 		fitness_vector compute_ideal() const;
@@ -220,12 +358,19 @@ class __PAGMO_VISIBLE population
 		std::vector<size_type> get_best_idx(const size_type & N) const;
 		size_type get_worst_idx() const;
 		void set_x(const size_type &, const decision_vector &);
+		void set_x(const size_type &, const decision_vector &, const fitness_vector &, const constraint_vector &);
+		void set_x_batch(const std::vector<size_type> &, const std::vector<decision_vector> &);
 		void set_v(const size_type &, const decision_vector &);
 		void push_back(const decision_vector &);
+		void push_back(const decision_vector &, const fitness_vector &, const constraint_vector &);
+		void push_back_batch(const std::vector<decision_vector> &);
 		void erase(const size_type &);
 		size_type size() const;
 		const_iterator begin() const;
 		const_iterator end() const;
+		void get_matrix(std::vector<double> &, field_type) const;
+		void get_block(block_type &) const;
+		void set_block(const block_type &);
 
 		void reinit(const size_type &);
 		void reinit();
@@ -261,28 +406,68 @@ class __PAGMO_VISIBLE population
 	private:
 		void init_velocity(const size_type &);
 		void update_champion(const size_type &);
+		void update_individual(const size_type &);
+		static const std::vector<double> &get_field(const individual_type &, field_type);
+		void load_block(const block_type &);
 
 		// Multi-objective stuff
 		void update_crowding_d(std::vector<size_type>) const;
+		std::vector<std::vector<size_type> > sort_non_dominated() const;
 
 	protected:
 		void update_dom(const size_type &);
+		void update_dom_all() const;
 
 	private:
 		// Data members + their serialization
 		friend class boost::serialization::access;
 		template <class Archive>
-		void serialize(Archive &ar, const unsigned int)
+		void save(Archive &ar, const unsigned int) const
 		{
-			ar & m_prob;
-			ar & m_container;
-			ar & m_dom_list;
-			ar & m_dom_count;
-			ar & m_pareto_rank;
-			ar & m_crowding_d;
-			ar & m_champion;
-			ar & m_drng;
-			ar & m_urng;
+			ar << m_prob;
+			// The individuals are written as a block, one matrix at a time.
+			block_type block;
+			get_block(block);
+			ar << block;
+			ar << m_dom_list;
+			ar << m_dom_count;
+			ar << m_dom_update;
+			ar << m_dom_dirty;
+			ar << m_pareto_rank;
+			ar << m_crowding_d;
+			ar << m_champion;
+			ar << m_drng;
+			ar << m_urng;
+		}
+		template <class Archive>
+		void load(Archive &ar, const unsigned int version)
+		{
+			ar >> m_prob;
+			// The individuals are stored as a block since version 2.
+			if (version >= 2) {
+				block_type block;
+				ar >> block;
+				load_block(block);
+			} else {
+				ar >> m_container;
+			}
+			ar >> m_dom_list;
+			ar >> m_dom_count;
+			// The domination update policy was introduced in version 1.
+			if (version >= 1) {
+				ar >> m_dom_update;
+				ar >> m_dom_dirty;
+			}
+			ar >> m_pareto_rank;
+			ar >> m_crowding_d;
+			ar >> m_champion;
+			ar >> m_drng;
+			ar >> m_urng;
+		}
+		template <class Archive>
+		void serialize(Archive &ar, const unsigned int version)
+		{
+			boost::serialization::split_member(ar,*this,version);
 		}
 		// Problem.
 		problem::base_ptr				m_prob;
@@ -291,9 +476,13 @@ class __PAGMO_VISIBLE population
 		// the set_x mechanism avoiding function re-evaluations. (use this option at your own risk)
 		container_type					m_container;
 		// List of dominated individuals.
-		std::vector<std::vector<size_type> >		m_dom_list;
+		mutable std::vector<std::vector<size_type> >	m_dom_list;
 		// Domination Count (number of dominant individuals)
-		std::vector<size_type>				m_dom_count;
+		mutable std::vector<size_type>			m_dom_count;
+		// Update policy of the domination information.
+		dom_update_type					m_dom_update;
+		// Flag signalling that the domination information is out of date.
+		mutable bool					m_dom_dirty;
 	private:
 		// Population champion.
 		champion_type					m_champion;
@@ -321,6 +510,11 @@ struct __PAGMO_VISIBLE population_access
 
 }
 
+BOOST_CLASS_VERSION(pagmo::population,2)
+BOOST_CLASS_VERSION(pagmo::population::block_type,pagmo::binary_vector_double_version)
+BOOST_CLASS_VERSION(pagmo::population::individual_type,pagmo::binary_vector_double_version)
+BOOST_CLASS_VERSION(pagmo::population::champion_type,pagmo::binary_vector_double_version)
+
 namespace boost { namespace serialization {
 
 template <class Archive>
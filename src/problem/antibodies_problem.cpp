@@ -113,6 +113,15 @@ bool antibodies_problem::compare_fitness_impl(const fitness_vector &v_f1, const
 	return m_original_problem->compare_fitness(v_f1,v_f2);
 }
 
+/// Implementation of the check of the comparison rules.
+/**
+ * @return false, as compare_fitness_impl() is reimplemented.
+ */
+bool antibodies_problem::has_default_comparison_impl() const
+{
+	return false;
+}
+
 /// Extra human readable info for the problem.
 /**
  * Will return a formatted string containing the type of constraint handling
@@ -72,6 +72,7 @@ protected:
 	std::string human_readable_extra() const;
 	void objfun_impl(fitness_vector &, const decision_vector &) const;
 	bool compare_fitness_impl(const fitness_vector &, const fitness_vector &) const;
+	bool has_default_comparison_impl() const;
 
 private:
 	friend class boost::serialization::access;
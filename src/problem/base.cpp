@@ -25,6 +25,7 @@
 // 30/01/10 Created by Francesco Biscani.
 
 #include <algorithm>
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
 #include <boost/numeric/conversion/bounds.hpp>
 #include <boost/numeric/conversion/cast.hpp>
@@ -66,15 +67,14 @@ base::base(int n, int ni, int nf, int nc, int nic, const double &c_tol): //TODO
 	m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 	m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 	m_c_tol(nc,c_tol),
-	m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-	m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity)),
+	m_cache(cache_capacity),
 	m_best_x(0),
 	m_best_f(0),
 	m_best_c(0),
 	m_fevals(0),
-	m_cevals(0)
+	m_cevals(0),
+	m_objfun_timing(false),
+	m_objfun_time(0)
 {
 	if (c_tol < 0) {
 		pagmo_throw(value_error,"constraints tolerance must be non-negative");
@@ -112,15 +112,14 @@ base::base(int n, int ni, int nf, int nc, int nic, const std::vector<double> &c_
 	m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 	m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 	m_c_tol(c_tol),
-	m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-	m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity)),
+	m_cache(cache_capacity),
 	m_best_x(0),
 	m_best_f(0),
 	m_best_c(0),
 	m_fevals(0),
-	m_cevals(0)
+	m_cevals(0),
+	m_objfun_timing(false),
+	m_objfun_time(0)
 {
 	if (c_tol.size() != static_cast<constraint_vector::size_type>(nc) ) {
 		pagmo_throw(value_error,"invalid constraints vector dimension");
@@ -165,15 +164,14 @@ base::base(const double &l_value, const double &u_value, int n, int ni, int nf,
 	m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 	m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 	m_c_tol(nc,c_tol),
-	m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-	m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity)),
+	m_cache(cache_capacity),
 	m_best_x(0),
 	m_best_f(0),
 	m_best_c(0),
 	m_fevals(0),
-	m_cevals(0)
+	m_cevals(0),
+	m_objfun_timing(false),
+	m_objfun_time(0)
 {
 	if (c_tol < 0) {
 		pagmo_throw(value_error,"constraints tolerance must be non-negative");
@@ -216,15 +214,14 @@ base::base(const decision_vector &lb, const decision_vector &ub, int ni, int nf,
 	m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 	m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 	m_c_tol(nc,c_tol),
-	m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-	m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-	m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity)),
+	m_cache(cache_capacity),
 	m_best_x(0),
 	m_best_f(0),
 	m_best_c(0),
 	m_fevals(0),
-	m_cevals(0)
+	m_cevals(0),
+	m_objfun_timing(false),
+	m_objfun_time(0)
 {
 	if (c_tol < 0) {
 		pagmo_throw(value_error,"constraints tolerance must be non-negative");
@@ -551,6 +548,25 @@ fitness_vector base::objfun(const decision_vector &x) const
 	return f;
 }
 
+// RAII helper accumulating into the problem the wall-clock time spent in the objective function, if timing is enabled.
+struct base::objfun_timer
+{
+	objfun_timer(const base &prob):m_prob(prob)
+	{
+		if (m_prob.m_objfun_timing) {
+			m_start = boost::posix_time::microsec_clock::universal_time();
+		}
+	}
+	~objfun_timer()
+	{
+		if (m_prob.m_objfun_timing) {
+			m_prob.m_objfun_time += (boost::posix_time::microsec_clock::universal_time() - m_start).total_microseconds() / 1000.;
+		}
+	}
+	const base			&m_prob;
+	boost::posix_time::ptime	m_start;
+};
+
 /// Write fitness of pagmo::decision_vector into pagmo::fitness_vector.
 /**
  * Will call objfun_impl() internally.
@@ -571,39 +587,135 @@ void base::objfun(fitness_vector &f, const decision_vector &x) const
 		pagmo_throw(value_error,"wrong decision vector size when calling objective function");
 	}
 	// Look into the cache.
-	typedef decision_vector_cache_type::iterator x_iterator;
-	typedef fitness_vector_cache_type::iterator f_iterator;
-	const x_iterator x_it = std::find(m_decision_vector_cache_f.begin(),m_decision_vector_cache_f.end(),x);
-	if (x_it == m_decision_vector_cache_f.end()) {
+	if (!m_cache.get_f(f,x)) {
 		// Fitness is not into memory. Calculate it.
-		objfun_impl(f,x);
+		{
+			const objfun_timer timer(*this);
+			objfun_impl(f,x);
+		}
 		// Increase function evaluation counter.
 		m_fevals++;
 		// Make sure that the implementation of objfun_impl() in the derived class did not fuck up the dimension of the fitness vector.
 		if (f.size() != m_f_dimension) {
 			pagmo_throw(value_error,"fitness dimension was changed inside objfun_impl()");
 		}
-		// Store the decision vector and the newly-calculated fitness in the front of the buffers.
-		m_decision_vector_cache_f.push_front(x);
-		m_fitness_vector_cache.push_front(f);
-	} else {
-		// Compute the corresponding iterator in the fitness vector cache.
-		f_iterator f_it = m_fitness_vector_cache.begin();
-		std::advance(f_it,std::distance(m_decision_vector_cache_f.begin(),x_it));
-		pagmo_assert(f_it != m_fitness_vector_cache.end());
-		// Assign to the fitness vector the value in the cache.
-		f = *f_it;
-		// Move the content of the current positions to the front of the buffers, and shift everything else down
-		// by one position.
-		x_iterator tmp_x_it = m_decision_vector_cache_f.begin();
-		f_iterator tmp_f_it = m_fitness_vector_cache.begin();
-		while (x_it != tmp_x_it) {
-			x_it->swap(*tmp_x_it);
-			f_it->swap(*tmp_f_it);
-			++tmp_x_it;
-			++tmp_f_it;
+		// Store the decision vector and the newly-calculated fitness in the cache.
+		m_cache.set_f(x,f);
+	}
+}
+
+/// Write the fitnesses of a batch of pagmo::decision_vector into a vector of pagmo::fitness_vector.
+/**
+ * Will call objfun_batch_impl() internally, after having checked the dimensions of all the decision vectors in x.
+ * f will be resized to the size of x, and each of its elements to the fitness dimension of the problem.
+ *
+ * As in objfun(), the fitnesses of the decision vectors found in the cache are not re-computed: only the remaining decision vectors
+ * are passed to objfun_batch_impl(). The last computed quantities are then stored in the cache.
+ *
+ * @param[out] f vector of fitness vectors to which the fitnesses of x will be written.
+ * @param[in] x decision vectors whose fitnesses will be calculated.
+ *
+ * @throws value_error if the dimension of any of the decision vectors is different from the dimension of the problem.
+ */
+void base::objfun_batch(std::vector<fitness_vector> &f, const std::vector<decision_vector> &x) const
+{
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (x[i].size() != get_dimension()) {
+			pagmo_throw(value_error,"wrong decision vector size when calling batch objective function");
 		}
-		pagmo_assert(tmp_f_it == f_it);
+	}
+	f.resize(x.size());
+	for (std::vector<fitness_vector>::size_type i = 0; i < f.size(); ++i) {
+		f[i].resize(m_f_dimension);
+	}
+	// Look into the cache, and record the positions of the decision vectors that need to be evaluated.
+	std::vector<std::vector<decision_vector>::size_type> miss;
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (!m_cache.get_f(f[i],x[i])) {
+			miss.push_back(i);
+		}
+	}
+	if (miss.empty()) {
+		return;
+	}
+	// If some decision vectors were found in the cache, evaluate the others in temporary storage.
+	const bool all_miss = (miss.size() == x.size());
+	std::vector<decision_vector> x_miss;
+	std::vector<fitness_vector> f_miss;
+	if (!all_miss) {
+		x_miss.resize(miss.size());
+		f_miss.resize(miss.size(),fitness_vector(m_f_dimension));
+		for (std::vector<decision_vector>::size_type j = 0; j < miss.size(); ++j) {
+			x_miss[j] = x[miss[j]];
+		}
+	}
+	std::vector<fitness_vector> &f_eval = all_miss ? f : f_miss;
+	{
+		const objfun_timer timer(*this);
+		objfun_batch_impl(f_eval,all_miss ? x : x_miss);
+	}
+	m_fevals += boost::numeric_cast<unsigned int>(miss.size());
+	if (f_eval.size() != miss.size()) {
+		pagmo_throw(value_error,"number of fitness vectors was changed inside objfun_batch_impl()");
+	}
+	for (std::vector<fitness_vector>::size_type j = 0; j < f_eval.size(); ++j) {
+		if (f_eval[j].size() != m_f_dimension) {
+			pagmo_throw(value_error,"fitness dimension was changed inside objfun_batch_impl()");
+		}
+	}
+	if (!all_miss) {
+		for (std::vector<decision_vector>::size_type j = 0; j < miss.size(); ++j) {
+			f[miss[j]].swap(f_miss[j]);
+		}
+	}
+	// Store the last computed values in the cache, in the same order objfun() would have.
+	const std::vector<decision_vector>::size_type n_cached = std::min<std::vector<decision_vector>::size_type>(miss.size(),m_cache.get_capacity());
+	for (std::vector<decision_vector>::size_type j = miss.size() - n_cached; j < miss.size(); ++j) {
+		m_cache.set_f(x[miss[j]],f[miss[j]]);
+	}
+}
+
+// Thread pool job computing the fitnesses of a batch. Each worker thread lazily creates its own copy of the problem
+// on first use, so that the mutable state of the problem (caches, temporaries, etc.) is never shared among threads.
+struct base::batch_objfun_task: util::thread_pool::task
+{
+	batch_objfun_task(const base &prob, std::vector<fitness_vector> &f, const std::vector<decision_vector> &x, unsigned int n_threads):
+		m_prob(prob),m_f(f),m_x(x),m_clones(n_threads) {}
+	void operator()(unsigned int thread_idx, std::size_t i)
+	{
+		if (!m_clones[thread_idx]) {
+			m_clones[thread_idx] = m_prob.clone();
+		}
+		m_clones[thread_idx]->objfun_impl(m_f[i],m_x[i]);
+	}
+	const base				&m_prob;
+	std::vector<fitness_vector>		&m_f;
+	const std::vector<decision_vector>	&m_x;
+	std::vector<base_ptr>			m_clones;
+};
+
+/// Batch objective function implementation.
+/**
+ * Takes a vector of pagmo::decision_vector as input and writes their pagmo::fitness_vector into f. This function is not to be called directly,
+ * it is invoked by objfun_batch() after the safety checks have been performed on x and f has been properly sized.
+ *
+ * Default implementation will call objfun_impl() on each decision vector, either serially or, if a thread pool was set via set_thread_pool(),
+ * in parallel on per-thread copies of the problem. Problems that can evaluate many decision vectors more efficiently than one at a time
+ * (e.g., by vectorisation) can reimplement this method.
+ *
+ * @param[out] f fitness vectors into which the fitnesses of x will be written.
+ * @param[in] x decision vectors whose fitnesses will be calculated.
+ */
+void base::objfun_batch_impl(std::vector<fitness_vector> &f, const std::vector<decision_vector> &x) const
+{
+	pagmo_assert(f.size() == x.size());
+	if (m_thread_pool && x.size() > 1u) {
+		batch_objfun_task task(*this,f,x,m_thread_pool->get_n_threads());
+		m_thread_pool->run(task,x.size());
+		return;
+	}
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		objfun_impl(f[i],x[i]);
 	}
 }
 
@@ -839,6 +951,31 @@ bool base::compare_fc_impl(const fitness_vector &f1, const constraint_vector &c1
 	}
 }
 
+/// Check whether the comparison methods follow the default rules.
+/**
+ * The default rules are those of the default implementations of compare_fitness_impl(), compare_constraints_impl() and compare_fc_impl():
+ * feasible vectors are better than infeasible ones, feasible vectors are compared by Pareto dominance of their fitness vectors and
+ * infeasible ones by number of satisfied constraints and constraint violation. These rules allow populations to rank their individuals
+ * with a fast non-dominated sorting algorithm (see population::update_pareto_information()).
+ *
+ * @return result of has_default_comparison_impl().
+ */
+bool base::has_default_comparison() const
+{
+	return has_default_comparison_impl();
+}
+
+/// Implementation of the check of the comparison rules.
+/**
+ * Problems reimplementing compare_fitness_impl(), compare_constraints_impl() or compare_fc_impl() must reimplement this method to return false.
+ *
+ * @return true.
+ */
+bool base::has_default_comparison_impl() const
+{
+	return true;
+}
+
 /** @name Constraints-related methods.
  * Methods used to calculate and compare constraints.
  */
@@ -881,10 +1018,7 @@ void base::compute_constraints(constraint_vector &c, const decision_vector &x) c
 		return;
 	}
 	// Look into the cache.
-	typedef decision_vector_cache_type::iterator x_iterator;
-	typedef constraint_vector_cache_type::iterator c_iterator;
-	const x_iterator x_it = std::find(m_decision_vector_cache_c.begin(),m_decision_vector_cache_c.end(),x);
-	if (x_it == m_decision_vector_cache_c.end()) {
+	if (!m_cache.get_c(c,x)) {
 		// Constraint vector is not into memory. Calculate it.
 		compute_constraints_impl(c,x);
 		m_cevals++;
@@ -892,27 +1026,115 @@ void base::compute_constraints(constraint_vector &c, const decision_vector &x) c
 		if (c.size() != get_c_dimension()) {
 			pagmo_throw(value_error,"constraints dimension was changed inside compute_constraints_impl()");
 		}
-		// Store the decision vector and the newly-calculated constraint vector in the front of the buffers.
-		m_decision_vector_cache_c.push_front(x);
-		m_constraint_vector_cache.push_front(c);
-	} else {
-		// Compute the corresponding iterator in the constraint vector cache.
-		c_iterator c_it = m_constraint_vector_cache.begin();
-		std::advance(c_it,std::distance(m_decision_vector_cache_c.begin(),x_it));
-		pagmo_assert(c_it != m_constraint_vector_cache.end());
-		// Assign to the fitness vector the value in the cache.
-		c = *c_it;
-		// Move the content of the current positions to the front of the buffers, and shift everything else down
-		// by one position.
-		x_iterator tmp_x_it = m_decision_vector_cache_c.begin();
-		c_iterator tmp_c_it = m_constraint_vector_cache.begin();
-		while (x_it != tmp_x_it) {
-			x_it->swap(*tmp_x_it);
-			c_it->swap(*tmp_c_it);
-			++tmp_x_it;
-			++tmp_c_it;
+		// Store the decision vector and the newly-calculated constraint vector in the cache.
+		m_cache.set_c(x,c);
+	}
+}
+
+/// Compute the constraints of a batch of pagmo::decision_vector.
+/**
+ * This function will perform sanity checks on x, resize c and its elements as needed and will then call compute_constraints_batch_impl().
+ *
+ * As in objfun_batch(), only the decision vectors not found in the cache are passed to compute_constraints_batch_impl(), and the last computed
+ * quantities are stored in the cache.
+ *
+ * @param[out] c vector of pagmo::constraint_vector into which the constraints will be written.
+ * @param[in] x decision vectors whose constraints will be computed.
+ *
+ * @throws value_error if the dimension of any of the decision vectors is different from the dimension of the problem.
+ */
+void base::compute_constraints_batch(std::vector<constraint_vector> &c, const std::vector<decision_vector> &x) const
+{
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (x[i].size() != get_dimension()) {
+			pagmo_throw(value_error,"invalid decision vector size during batch constraint computation");
+		}
+	}
+	c.resize(x.size());
+	for (std::vector<constraint_vector>::size_type i = 0; i < c.size(); ++i) {
+		c[i].resize(m_c_dimension);
+	}
+	// Do not do anything if constraints size is 0.
+	if (!m_c_dimension) {
+		return;
+	}
+	std::vector<std::vector<decision_vector>::size_type> miss;
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (!m_cache.get_c(c[i],x[i])) {
+			miss.push_back(i);
+		}
+	}
+	if (miss.empty()) {
+		return;
+	}
+	const bool all_miss = (miss.size() == x.size());
+	std::vector<decision_vector> x_miss;
+	std::vector<constraint_vector> c_miss;
+	if (!all_miss) {
+		x_miss.resize(miss.size());
+		c_miss.resize(miss.size(),constraint_vector(m_c_dimension));
+		for (std::vector<decision_vector>::size_type j = 0; j < miss.size(); ++j) {
+			x_miss[j] = x[miss[j]];
+		}
+	}
+	std::vector<constraint_vector> &c_eval = all_miss ? c : c_miss;
+	compute_constraints_batch_impl(c_eval,all_miss ? x : x_miss);
+	m_cevals += boost::numeric_cast<unsigned int>(miss.size());
+	if (c_eval.size() != miss.size()) {
+		pagmo_throw(value_error,"number of constraint vectors was changed inside compute_constraints_batch_impl()");
+	}
+	for (std::vector<constraint_vector>::size_type j = 0; j < c_eval.size(); ++j) {
+		if (c_eval[j].size() != m_c_dimension) {
+			pagmo_throw(value_error,"constraints dimension was changed inside compute_constraints_batch_impl()");
 		}
-		pagmo_assert(tmp_c_it == c_it);
+	}
+	if (!all_miss) {
+		for (std::vector<decision_vector>::size_type j = 0; j < miss.size(); ++j) {
+			c[miss[j]].swap(c_miss[j]);
+		}
+	}
+	const std::vector<decision_vector>::size_type n_cached = std::min<std::vector<decision_vector>::size_type>(miss.size(),m_cache.get_capacity());
+	for (std::vector<decision_vector>::size_type j = miss.size() - n_cached; j < miss.size(); ++j) {
+		m_cache.set_c(x[miss[j]],c[miss[j]]);
+	}
+}
+
+// Thread pool job computing the constraints of a batch, with per-thread copies of the problem.
+struct base::batch_constraints_task: util::thread_pool::task
+{
+	batch_constraints_task(const base &prob, std::vector<constraint_vector> &c, const std::vector<decision_vector> &x, unsigned int n_threads):
+		m_prob(prob),m_c(c),m_x(x),m_clones(n_threads) {}
+	void operator()(unsigned int thread_idx, std::size_t i)
+	{
+		if (!m_clones[thread_idx]) {
+			m_clones[thread_idx] = m_prob.clone();
+		}
+		m_clones[thread_idx]->compute_constraints_impl(m_c[i],m_x[i]);
+	}
+	const base				&m_prob;
+	std::vector<constraint_vector>		&m_c;
+	const std::vector<decision_vector>	&m_x;
+	std::vector<base_ptr>			m_clones;
+};
+
+/// Batch constraints computation implementation.
+/**
+ * Invoked by compute_constraints_batch() after the safety checks have been performed. Default implementation will call
+ * compute_constraints_impl() on each decision vector, in parallel on per-thread copies of the problem if a thread pool was set via set_thread_pool().
+ *
+ * @param[out] c constraint vectors into which the constraints of x will be written.
+ * @param[in] x decision vectors whose constraints will be computed.
+ */
+void base::compute_constraints_batch_impl(std::vector<constraint_vector> &c, const std::vector<decision_vector> &x) const
+{
+	pagmo_assert(c.size() == x.size());
+	if (m_thread_pool && x.size() > 1u) {
+		batch_constraints_task task(*this,c,x,m_thread_pool->get_n_threads());
+		m_thread_pool->run(task,x.size());
+		return;
+	}
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		compute_constraints_impl(c[i],x[i]);
 	}
 }
 
@@ -1349,6 +1571,29 @@ void base::set_best_x(const std::vector<decision_vector>& best_x)
 	}
 }
 
+/// Set the thread pool used for batch evaluations.
+/**
+ * After this call, the default implementations of objfun_batch_impl() and compute_constraints_batch_impl() will distribute
+ * the evaluations among the worker threads of pool, each one operating on its own copy of the problem. Passing a null pointer
+ * restores the serial evaluation. The pool is shared among all the copies of the problem created afterwards (e.g., the copies held
+ * by populations and islands).
+ *
+ * @param[in] pool thread pool to be used for batch evaluations.
+ */
+void base::set_thread_pool(const util::thread_pool_ptr &pool)
+{
+	m_thread_pool = pool;
+}
+
+/// Get the thread pool used for batch evaluations.
+/**
+ * @return const reference to the thread pool used for batch evaluations (null if batches are evaluated serially).
+ */
+const util::thread_pool_ptr &base::get_thread_pool() const
+{
+	return m_thread_pool;
+}
+
 /// Get the best known constraint vector.
 /**
  * @return the best known constraint vector for the problem.
@@ -1412,10 +1657,82 @@ void base::post_evolution(population &pop) const
  */
 void base::reset_caches() const
 {
-	m_decision_vector_cache_f = decision_vector_cache_type(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity));
-	m_fitness_vector_cache = fitness_vector_cache_type(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity));
-	m_decision_vector_cache_c = decision_vector_cache_type(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity));
-	m_constraint_vector_cache = constraint_vector_cache_type(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity));
+	m_cache.clear();
+}
+
+/// Get the capacity of the cache.
+/**
+ * @return the maximum number of decision vectors whose fitness and constraint vectors are stored in the cache.
+ */
+std::size_t base::get_cache_capacity() const
+{
+	return m_cache.get_capacity();
+}
+
+/// Set the capacity of the cache.
+/**
+ * Workloads which evaluate the same decision vectors many times (e.g., racing, local searches and numerical differentiation) can
+ * benefit from a capacity larger than the default base::cache_capacity. A capacity of zero disables the cache.
+ *
+ * @param[in] n maximum number of decision vectors whose fitness and constraint vectors are stored in the cache.
+ */
+void base::set_cache_capacity(std::size_t n)
+{
+	m_cache.set_capacity(n);
+}
+
+/// Get the number of cache hits.
+/**
+ * @return the number of fitness and constraint vectors retrieved from the cache instead of being computed.
+ */
+unsigned long base::get_cache_hits() const
+{
+	return m_cache.get_hits();
+}
+
+/// Get the number of cache misses.
+/**
+ * @return the number of fitness and constraint vectors that were looked up in the cache without success.
+ */
+unsigned long base::get_cache_misses() const
+{
+	return m_cache.get_misses();
+}
+
+/// Enable or disable the timing of the objective function.
+/**
+ * If enabled, the wall-clock time spent in objfun_impl() and objfun_batch_impl() will be accumulated and made available
+ * via get_objfun_time(). Timing is disabled by default, as its overhead is not negligible for cheap objective functions.
+ * The setting is preserved by copies of the problem: hence, it can be enabled on a problem before using it to construct
+ * islands in order to obtain the objective function time in the islands' telemetry.
+ *
+ * @param[in] flag true to enable timing, false to disable it.
+ */
+void base::set_objfun_timing(bool flag)
+{
+	m_objfun_timing = flag;
+}
+
+/// Query the timing of the objective function.
+/**
+ * @return true if the timing of the objective function is enabled, false otherwise.
+ *
+ * @see set_objfun_timing().
+ */
+bool base::get_objfun_timing() const
+{
+	return m_objfun_timing;
+}
+
+/// Get the time spent in the objective function.
+/**
+ * @return the total wall-clock time (in milliseconds) spent in the objective function while timing was enabled.
+ *
+ * @see set_objfun_timing().
+ */
+double base::get_objfun_time() const
+{
+	return m_objfun_time;
 }
 
 }} //namespaces
@@ -32,18 +32,20 @@
 // #define BOOST_CB_DISABLE_DEBUG 
 
 #include <algorithm>
-#include <boost/circular_buffer.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/shared_ptr.hpp>
 #include <cstddef>
 #include <iostream>
 #include <iterator>
 #include <string>
+#include <vector>
 
 #include "../config.h"
 #include "../exceptions.h"
 #include "../serialization.h"
 #include "../types.h"
+#include "../util/eval_cache.h"
+#include "../util/thread_pool.h"
 //#include "base_meta.h"
 
 namespace pagmo
@@ -108,14 +110,37 @@ typedef boost::shared_ptr<base> base_ptr;
  *   than the second one, false otherwise),
  * - compute_constraints_impl(), to calculate the constraint vector associated to a decision vector,
  * - compare_constraints_impl(), to compare two constraint vectors,
- * - compare_fc_impl(), to perform a simultaneous fitness/constraint vector pairs comparison.
+ * - compare_fc_impl(), to perform a simultaneous fitness/constraint vector pairs comparison,
+ * - has_default_comparison_impl(), which must return false if any of the three methods above is reimplemented.
  *
  * Please note that while a problem is intended to provide methods for ranking decision and constraint vectors, such methods are not to be used
  * mandatorily by an algorithm: each algorithm can decide to use its own ranking schemes during an optimisation. The ranking methods provided
  * by the problem are always used instead during the migration of decision vectors from one island to the other.
  *
  * \section Caching
- * A caching mechanism is implemented to make sure the objective function is never evaluated twice on the very same chromosome
+ * A caching mechanism is implemented to make sure the objective function is never evaluated twice on the very same chromosome.
+ * Fitness and constraint vectors of the most recently evaluated decision vectors are stored in a least-recently-used cache indexed by a hash
+ * of the decision vector, so that look-ups take constant time. The cache holds by default base::cache_capacity decision vectors, and its capacity
+ * can be changed for each problem with set_cache_capacity() (e.g., to a large value for workloads re-evaluating the same points many times,
+ * or to zero to disable caching). The number of cache hits and misses can be queried with get_cache_hits() and get_cache_misses().
+ *
+ * \section Batching
+ * Algorithms generating a whole generation of decision vectors at once can evaluate them with objfun_batch() and compute_constraints_batch().
+ * These methods perform the safety checks once per call and then invoke objfun_batch_impl() and compute_constraints_batch_impl(), whose
+ * default implementations simply loop over objfun_impl() and compute_constraints_impl(). Problems able to vectorise or parallelise their
+ * evaluation can reimplement the batch methods.
+ *
+ * The default batch implementations can also run in parallel on a util::thread_pool set with set_thread_pool(). In this case each
+ * worker thread evaluates its share of the batch on a private copy of the problem obtained via clone(), so that the objective function
+ * and the internal mutable state of the problem are never accessed concurrently. The thread pool is shared among the copies of the problem
+ * and it is not serialized: a deserialized problem will evaluate its batches serially.
+ *
+ * \section Shared data
+ * Copies of a problem are made often (each population and island holds its own copy, and the parallel batch evaluation makes one per
+ * worker thread). Problems holding large data which never change after construction (e.g., weight matrices, rotation matrices or
+ * data read from files) should keep them in a boost::shared_ptr<const T>, so that clone() copies only a pointer and the mutable part
+ * of the problem (temporaries, caches, rngs). Such members can be serialized with pagmo::serialize_shared_data(), which keeps the
+ * same archive format as a plain member of type T.
  *
  * \section Serialization
  * The problem classes are serialized for the purpose of transmitting their corresponding objects over a distributed environment, as being part of the population class.
@@ -149,12 +174,8 @@ class __PAGMO_VISIBLE base
 {
 		// Meta problems need to be able to access protected virtual functions
 		friend class base_meta;
-		// Underlying containers used for caching decision and fitness vectors.
-		typedef boost::circular_buffer<decision_vector> decision_vector_cache_type;
-		typedef boost::circular_buffer<fitness_vector> fitness_vector_cache_type;
-		typedef boost::circular_buffer<constraint_vector> constraint_vector_cache_type;
 	public:
-		/// Capacity of the internal caches.
+		/// Default capacity of the internal cache.
 		static const std::size_t cache_capacity = 5;
 		/// Problem's size type: the same as pagmo::decision_vector's size type.
 		typedef decision_vector::size_type size_type;
@@ -187,10 +208,7 @@ class __PAGMO_VISIBLE base
 			m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 			m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 			m_c_tol(nc,c_tol),
-			m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-			m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-			m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-			m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity))
+			m_cache(cache_capacity)
 		{
 			if (c_tol < 0) {
 				pagmo_throw(value_error,"constraints tolerance must be non-negative");
@@ -236,10 +254,7 @@ class __PAGMO_VISIBLE base
 			m_i_dimension(boost::numeric_cast<size_type>(ni)),m_f_dimension(boost::numeric_cast<f_size_type>(nf)),
 			m_c_dimension(boost::numeric_cast<c_size_type>(nc)),m_ic_dimension(boost::numeric_cast<c_size_type>(nic)),
 			m_c_tol(nc,c_tol),
-			m_decision_vector_cache_f(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-			m_fitness_vector_cache(boost::numeric_cast<fitness_vector_cache_type::size_type>(cache_capacity)),
-			m_decision_vector_cache_c(boost::numeric_cast<decision_vector_cache_type::size_type>(cache_capacity)),
-			m_constraint_vector_cache(boost::numeric_cast<constraint_vector_cache_type::size_type>(cache_capacity))
+			m_cache(cache_capacity)
 		{
 			if (c_tol < 0) {
 				pagmo_throw(value_error,"constraints tolerance must be non-negative");
@@ -414,6 +429,7 @@ class __PAGMO_VISIBLE base
 		//@}
 		constraint_vector compute_constraints(const decision_vector &) const;
 		void compute_constraints(constraint_vector &, const decision_vector &) const;
+		void compute_constraints_batch(std::vector<constraint_vector> &, const std::vector<decision_vector> &) const;
 		bool compare_constraints(const constraint_vector &, const constraint_vector &) const;
 		bool test_constraint(const constraint_vector &, const c_size_type &) const;
 		bool feasibility_x(const decision_vector &) const;
@@ -437,13 +453,16 @@ return base_ptr(new derived_problem(*this));
 		bool compare_x(const decision_vector &, const decision_vector &) const;
 		bool verify_x(const decision_vector &) const;
 		bool compare_fc(const fitness_vector &, const constraint_vector &, const fitness_vector &, const constraint_vector &) const;
+		bool has_default_comparison() const;
 		virtual void pre_evolution(population &) const;
 		virtual void post_evolution(population &) const;
 	protected:
 		virtual bool equality_operator_extra(const base &) const;
 		virtual void compute_constraints_impl(constraint_vector &, const decision_vector &) const;
+		virtual void compute_constraints_batch_impl(std::vector<constraint_vector> &, const std::vector<decision_vector> &) const;
 		virtual bool compare_constraints_impl(const constraint_vector &, const constraint_vector &) const;
 		virtual bool compare_fc_impl(const fitness_vector &, const constraint_vector &, const fitness_vector &, const constraint_vector &) const;
+		virtual bool has_default_comparison_impl() const;
 		void estimate_sparsity(const decision_vector &, int& lenG, std::vector<int>& iGfun, std::vector<int>& jGvar) const;
 		void estimate_sparsity(int& lenG, std::vector<int>& iGfun, std::vector<int>& jGvar) const;
 	public:
@@ -454,13 +473,23 @@ return base_ptr(new derived_problem(*this));
 		//@{
 		fitness_vector objfun(const decision_vector &) const;
 		void objfun(fitness_vector &, const decision_vector &) const;
+		void objfun_batch(std::vector<fitness_vector> &, const std::vector<decision_vector> &) const;
 		bool compare_fitness(const fitness_vector &, const fitness_vector &) const;
 		void reset_caches() const;
+		std::size_t get_cache_capacity() const;
+		void set_cache_capacity(std::size_t);
+		unsigned long get_cache_hits() const;
+		unsigned long get_cache_misses() const;
+		void set_objfun_timing(bool);
+		bool get_objfun_timing() const;
+		double get_objfun_time() const;
 	public:
 		const std::vector<constraint_vector>& get_best_c(void) const;
 		const std::vector<decision_vector>& get_best_x(void) const;
 		const std::vector<fitness_vector>& get_best_f(void) const;
 		void set_best_x(const std::vector<decision_vector>&);
+		void set_thread_pool(const util::thread_pool_ptr &);
+		const util::thread_pool_ptr &get_thread_pool() const;
 	protected:
 		virtual bool compare_fitness_impl(const fitness_vector &, const fitness_vector &) const;
 		/// Objective function implementation.
@@ -472,8 +501,11 @@ return base_ptr(new derived_problem(*this));
 		 * @param[in] x decision vector whose fitness will be calculated.
 		 */
 		virtual void objfun_impl(fitness_vector &f, const decision_vector &x) const = 0;
+		virtual void objfun_batch_impl(std::vector<fitness_vector> &, const std::vector<decision_vector> &) const;
 		//@}
 	private:
+		struct batch_objfun_task;
+		struct batch_constraints_task;
 		void normalise_bounds();
 		// Construct from iterators.
 		template <class Iterator1, class Iterator2>
@@ -498,9 +530,11 @@ return base_ptr(new derived_problem(*this));
 			}
 		}
 	private:
+		// RAII helper for the timing of the objective function.
+		struct objfun_timer;
 		friend class boost::serialization::access;
 		template <class Archive>
-		void serialize(Archive &ar, const unsigned int)
+		void serialize(Archive &ar, const unsigned int version)
 		{
 			ar & const_cast<size_type &>(m_i_dimension);
 			ar & const_cast<f_size_type &>(m_f_dimension);
@@ -509,10 +543,25 @@ return base_ptr(new derived_problem(*this));
 			ar & m_lb;
 			ar & m_ub;
 			ar & const_cast<std::vector<double> &>(m_c_tol);
-			ar & m_decision_vector_cache_f;
-			ar & m_fitness_vector_cache;
-			ar & m_decision_vector_cache_c;
-			ar & m_constraint_vector_cache;
+			if (version >= 1) {
+				ar & m_cache;
+			} else {
+				// Version 0 stored separate circular buffers for fitness and constraints: their content is moved into the cache.
+				boost::circular_buffer<decision_vector> x_f, x_c;
+				boost::circular_buffer<fitness_vector> f;
+				boost::circular_buffer<constraint_vector> c;
+				ar & x_f;
+				ar & f;
+				ar & x_c;
+				ar & c;
+				m_cache = util::eval_cache(cache_capacity);
+				for (std::size_t i = x_f.size(); i > 0u; --i) {
+					m_cache.set_f(x_f[i - 1u],f[i - 1u]);
+				}
+				for (std::size_t i = x_c.size(); i > 0u; --i) {
+					m_cache.set_c(x_c[i - 1u],c[i - 1u]);
+				}
+			}
 			ar & m_tmp_f1;
 			ar & m_tmp_f2;
 			ar & m_tmp_c1;
@@ -522,6 +571,10 @@ return base_ptr(new derived_problem(*this));
 			ar & m_best_c;
 			ar & m_fevals;
 			ar & m_cevals;
+			if (version >= 2) {
+				ar & m_objfun_timing;
+				ar & m_objfun_time;
+			}
 		}
 
 		// Data members.
@@ -539,14 +592,8 @@ return base_ptr(new derived_problem(*this));
 		decision_vector				m_ub;
 		// Tolerance for constraints analysis.
 		const std::vector<double>   m_c_tol;
-		// Decision vector cache for fitness.
-		mutable decision_vector_cache_type	m_decision_vector_cache_f;
-		// Fitness vector cache.
-		mutable fitness_vector_cache_type	m_fitness_vector_cache;
-		// Decision vector cache for constraints.
-		mutable decision_vector_cache_type	m_decision_vector_cache_c;
-		// Constraint vector cache.
-		mutable constraint_vector_cache_type	m_constraint_vector_cache;
+		// Cache of fitness and constraint vectors.
+		mutable util::eval_cache		m_cache;
 		// Temporary storage used during decision_vector comparisons.
 		mutable fitness_vector			m_tmp_f1;
 		mutable fitness_vector			m_tmp_f2;
@@ -562,6 +609,11 @@ return base_ptr(new derived_problem(*this));
 		// Number of function and constraints evaluations
 		mutable unsigned int                    m_fevals;
 		mutable unsigned int                    m_cevals;
+		// Thread pool used for the parallel evaluation of batches (null for serial evaluation).
+		util::thread_pool_ptr			m_thread_pool;
+		// Timing of the objective function.
+		bool					m_objfun_timing;
+		mutable double				m_objfun_time;
 };
 
 std::ostream __PAGMO_VISIBLE_FUNC &operator<<(std::ostream &, const base &);
@@ -570,5 +622,6 @@ std::ostream __PAGMO_VISIBLE_FUNC &operator<<(std::ostream &, const base &);
 }
 
 BOOST_SERIALIZATION_ASSUME_ABSTRACT(pagmo::problem::base)
+BOOST_CLASS_VERSION(pagmo::problem::base,2)
 
 #endif
@@ -67,6 +67,8 @@ class __PAGMO_VISIBLE base_meta : public base
 			{return m_original_problem->compare_constraints_impl(c1,c2);}
 		bool compare_fc_impl(const fitness_vector &f1, const constraint_vector &c1, const fitness_vector &f2, const constraint_vector &c2) const
 			{return m_original_problem->compare_fc_impl(f1,c1,f2,c2);}
+		bool has_default_comparison_impl() const
+			{return m_original_problem->has_default_comparison_impl();}
 	private:
 		friend class boost::serialization::access;
 		template <class Archive>
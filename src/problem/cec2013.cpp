@@ -74,7 +74,7 @@ cec2013::cec2013(unsigned int fun_id, problem::base::size_type d, const std::str
 		pagmo_throw(io_error, std::string("Error: file not found. I was looking for (") + data_file_name.c_str() + ")");
 	}
 	std::istream_iterator<double> start(data_file), end;
-	m_rotation_matrix = std::vector<double>(start,end);
+	m_rotation_matrix.reset(new std::vector<double>(start,end));
 	data_file.close();
 	}
 
@@ -88,7 +88,7 @@ cec2013::cec2013(unsigned int fun_id, problem::base::size_type d, const std::str
 		pagmo_throw(io_error, std::string("Error: file not found. I was looking for ").append(data_file_name.c_str()));
 	}
 	std::istream_iterator<double> start(data_file), end;
-	m_origin_shift = std::vector<double>(start,end);
+	m_origin_shift.reset(new std::vector<double>(start,end));
 	data_file.close();
 	}
 	// Set bounds. All CEC2013 problems have the same bounds
@@ -105,118 +105,120 @@ base_ptr cec2013::clone() const
 void cec2013::objfun_impl(fitness_vector &f, const decision_vector &x) const
 {
 	size_type nx = get_dimension();
+	const double *shift = &(*m_origin_shift)[0];
+	const double *rotation = &(*m_rotation_matrix)[0];
 	switch(m_problem_number)
 	{
 	case 1:
-		sphere_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		sphere_func(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=-1400.0;
 		break;
 	case 2:
-		ellips_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		ellips_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-1300.0;
 		break;
 	case 3:
-		bent_cigar_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		bent_cigar_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-1200.0;
 		break;
 	case 4:
-		discus_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		discus_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-1100.0;
 		break;
 	case 5:
-		dif_powers_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		dif_powers_func(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=-1000.0;
 		break;
 	case 6:
-		rosenbrock_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		rosenbrock_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-900.0;
 		break;
 	case 7:
-		schaffer_F7_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		schaffer_F7_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-800.0;
 		break;
 	case 8:
-		ackley_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		ackley_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-700.0;
 		break;
 	case 9:
-		weierstrass_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		weierstrass_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-600.0;
 		break;
 	case 10:
-		griewank_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		griewank_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-500.0;
 		break;
 	case 11:
-		rastrigin_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		rastrigin_func(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=-400.0;
 		break;
 	case 12:
-		rastrigin_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		rastrigin_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-300.0;
 		break;
 	case 13:
-		step_rastrigin_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		step_rastrigin_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=-200.0;
 		break;
 	case 14:
-		schwefel_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		schwefel_func(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=-100.0;
 		break;
 	case 15:
-		schwefel_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		schwefel_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=100.0;
 		break;
 	case 16:
-		katsuura_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		katsuura_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=200.0;
 		break;
 	case 17:
-		bi_rastrigin_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		bi_rastrigin_func(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=300.0;
 		break;
 	case 18:
-		bi_rastrigin_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		bi_rastrigin_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=400.0;
 		break;
 	case 19:
-		grie_rosen_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		grie_rosen_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=500.0;
 		break;
 	case 20:
-		escaffer6_func(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		escaffer6_func(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=600.0;
 		break;
 	case 21:
-		cf01(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf01(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=700.0;
 		break;
 	case 22:
-		cf02(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],0);
+		cf02(&x[0],&f[0],nx,shift,rotation,0);
 		f[0]+=800.0;
 		break;
 	case 23:
-		cf03(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf03(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=900.0;
 		break;
 	case 24:
-		cf04(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf04(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=1000.0;
 		break;
 	case 25:
-		cf05(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf05(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=1100.0;
 		break;
 	case 26:
-		cf06(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf06(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=1200.0;
 		break;
 	case 27:
-		cf07(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf07(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=1300.0;
 		break;
 	case 28:
-		cf08(&x[0],&f[0],nx,&m_origin_shift[0],&m_rotation_matrix[0],1);
+		cf08(&x[0],&f[0],nx,shift,rotation,1);
 		f[0]+=1400.0;
 		break;
 	default:
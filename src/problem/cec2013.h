@@ -25,7 +25,9 @@
 #ifndef PAGMO_PROBLEM_CEC2013_H
 #define PAGMO_PROBLEM_CEC2013_H
 
+#include <boost/shared_ptr.hpp>
 #include <string>
+#include <vector>
 
 #include "../serialization.h"
 #include "../types.h"
@@ -46,6 +48,8 @@ namespace pagmo{ namespace problem {
  *
  * NOTE 2: all problems are unconstrained continuous single objective problems.
  *
+ * NOTE 3: the rotation matrices and shift vectors are read only once, and they are shared (not copied) by the clones of the problem.
+ *
  * @see http://www.ntu.edu.sg/home/EPNSugan/index_files/CEC2013/CEC2013.htm
  *
  * @author Dario Izzo (dario.izzo@gmail.com)
@@ -65,7 +69,7 @@ class __PAGMO_VISIBLE cec2013 : public base
 		 * @returns the origin shift
 		 *
 		 */
-		std::vector<double> origin_shift() const {return m_origin_shift;}
+		std::vector<double> origin_shift() const {return *m_origin_shift;}
 		//@}
 	protected:
 		void objfun_impl(fitness_vector &, const decision_vector &) const;
@@ -107,12 +111,13 @@ class __PAGMO_VISIBLE cec2013 : public base
 		{
 			ar & boost::serialization::base_object<base>(*this);
 			ar & const_cast<unsigned int&>(m_problem_number);
-			ar & m_rotation_matrix;
-			ar & m_origin_shift;
+			serialize_shared_data(ar, m_rotation_matrix);
+			serialize_shared_data(ar, m_origin_shift);
 		}
 	const unsigned int m_problem_number;
-	std::vector<double> m_rotation_matrix;
-	std::vector<double> m_origin_shift;
+	// Data read from the files, shared among the copies of the problem
+	boost::shared_ptr<const std::vector<double> > m_rotation_matrix;
+	boost::shared_ptr<const std::vector<double> > m_origin_shift;
 
 	// These are pre-allocated for speed, need not to be serialized
 	mutable std::vector<double> m_y;
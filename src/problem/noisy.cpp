@@ -22,6 +22,7 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <boost/functional/hash.hpp>
@@ -65,7 +66,8 @@ noisy::noisy(const base & p, unsigned int trials, const double param_first, cons
 	m_decision_vector_hash(),
 	m_param_first(param_first),
 	m_param_second(param_second),
-	m_noise_type(distribution)
+	m_noise_type(distribution),
+	m_noise()
 {
 	if(distribution == UNIFORM && param_first > param_second){
 		pagmo_throw(value_error, "Bounds specified for the uniform noise are not valid.");
@@ -83,7 +85,8 @@ noisy::noisy(const noisy &prob):
 	m_decision_vector_hash(),
 	m_param_first(prob.m_param_first),
 	m_param_second(prob.m_param_second),
-	m_noise_type(prob.m_noise_type) {}
+	m_noise_type(prob.m_noise_type),
+	m_noise() {}
 
 /// Clone method.
 base_ptr noisy::clone() const
@@ -129,64 +132,90 @@ double noisy::get_param_second() const
 /// Add noises to the computed fitness vector.
 void noisy::objfun_impl(fitness_vector &f, const decision_vector &x) const
 {
-	//1 - Initialize a temporary fitness vector storing one trial result
-	//and we use it also to init the return value 
-	fitness_vector tmp(f.size(),0.0);
-	f=tmp;
-	//2 - We set the seed
-	m_drng.seed(m_seed+m_decision_vector_hash(x));
-	//3 - We average upon multiple runs
-	for (unsigned int j=0; j< m_trials; ++j) {
-		m_original_problem->objfun(tmp, x);
-		inject_noise_f(tmp);
-		for (fitness_vector::size_type i=0; i<f.size();++i) {
-			f[i] = f[i] + tmp[i] / (double)m_trials;
-		}
-	}
+	fitness_vector f_original(f.size());
+	m_original_problem->objfun(f_original, x);
+	average_trials(f, f_original, x);
 }
 
 /// Implementation of the constraints computation.
 /// Add noises to the computed constraint vector.
 void noisy::compute_constraints_impl(constraint_vector &c, const decision_vector &x) const
 {
-	//1 - Initialize a temporary constraint vector storing one trial result
-	//and we use it also to init the return value 
-	constraint_vector tmp(c.size(),0.0);
-	c=tmp;
-	//2 - We set the seed
-	m_drng.seed(m_seed+m_decision_vector_hash(x));
-	//3 - We average upon multiple runs
-	for (unsigned int j=0; j< m_trials; ++j) {
-		m_original_problem->compute_constraints(tmp, x);
-		inject_noise_c(tmp);
-		for (constraint_vector::size_type i=0; i<c.size();++i) {
-			c[i] = c[i] + tmp[i] / (double)m_trials;
-		}
+	constraint_vector c_original(c.size());
+	m_original_problem->compute_constraints(c_original, x);
+	average_trials(c, c_original, x);
+}
+
+/// Batch implementation of the objective function.
+/**
+ * The whole batch is evaluated at once on the original problem, then the
+ * noise is added to each fitness vector as in objfun_impl().
+ */
+void noisy::objfun_batch_impl(std::vector<fitness_vector> &f, const std::vector<decision_vector> &x) const
+{
+	if(get_thread_pool()){
+		base::objfun_batch_impl(f, x);
+		return;
+	}
+	std::vector<fitness_vector> f_original;
+	m_original_problem->objfun_batch(f_original, x);
+	for(std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i){
+		average_trials(f[i], f_original[i], x[i]);
 	}
 }
 
-/// Apply noise on a fitness vector
-void noisy::inject_noise_f(fitness_vector& f) const
+/// Batch implementation of the constraints computation.
+/**
+ * The whole batch is evaluated at once on the original problem, then the
+ * noise is added to each constraint vector as in compute_constraints_impl().
+ */
+void noisy::compute_constraints_batch_impl(std::vector<constraint_vector> &c, const std::vector<decision_vector> &x) const
 {
-	for(f_size_type i = 0; i < f.size(); i++){
-		if(m_noise_type == NORMAL){
-			f[i] += m_normal_dist(m_drng)*m_param_second+m_param_first;
-		}
-		else if(m_noise_type == UNIFORM){
-			f[i] += m_uniform_dist(m_drng)*(m_param_second-m_param_first)+m_param_first;
-		}
+	if(get_thread_pool()){
+		base::compute_constraints_batch_impl(c, x);
+		return;
+	}
+	std::vector<constraint_vector> c_original;
+	m_original_problem->compute_constraints_batch(c_original, x);
+	for(std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i){
+		average_trials(c[i], c_original[i], x[i]);
 	}
 }
 
-/// Apply noise on a constraint vector
-void noisy::inject_noise_c(constraint_vector& c) const
+/// Average the noisy trials of a fitness or constraint vector
+/**
+ * The noise samples of all the trials are drawn in one block, after having
+ * seeded the rng from the seed of the problem and x. They are drawn and
+ * accumulated in the same order as evaluating and perturbing v_original
+ * m_trials times would, so that the result is the same.
+ *
+ * @param[out] v averaged noisy vector.
+ * @param[in] v_original vector computed by the original problem.
+ * @param[in] x decision vector.
+ */
+void noisy::average_trials(std::vector<double> &v, const std::vector<double> &v_original, const decision_vector &x) const
 {
-	for(c_size_type i = 0; i < c.size(); i++){
-		if(m_noise_type == NORMAL){
-			c[i] += m_normal_dist(m_drng)*m_param_second+m_param_first;
+	const std::vector<double>::size_type n = v_original.size();
+	m_drng.seed(m_seed+m_decision_vector_hash(x));
+	m_noise.resize(m_trials * n);
+	if(m_noise_type == NORMAL){
+		for(std::vector<double>::size_type k = 0; k < m_noise.size(); ++k){
+			m_noise[k] = m_normal_dist(m_drng)*m_param_second+m_param_first;
 		}
-		else if(m_noise_type == UNIFORM){
-			c[i] += m_uniform_dist(m_drng)*(m_param_second-m_param_first)+m_param_first;
+	}
+	else if(m_noise_type == UNIFORM){
+		for(std::vector<double>::size_type k = 0; k < m_noise.size(); ++k){
+			m_noise[k] = m_uniform_dist(m_drng)*(m_param_second-m_param_first)+m_param_first;
+		}
+	}
+	else{
+		std::fill(m_noise.begin(), m_noise.end(), 0.0);
+	}
+	v.assign(n, 0.0);
+	for(unsigned int j = 0; j < m_trials; ++j){
+		const double *noise = &m_noise[0] + j * n;
+		for(std::vector<double>::size_type i = 0; i < n; ++i){
+			v[i] = v[i] + (v_original[i] + noise[i]) / (double)m_trials;
 		}
 	}
 }
@@ -26,6 +26,7 @@
 #define PAGMO_PROBLEM_NOISY_H
 
 #include <string>
+#include <vector>
 #include <boost/functional/hash.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
@@ -49,6 +50,11 @@ namespace pagmo{ namespace problem {
  * NOTE: for m_trials->infinity one recovers a deterministic problem, but the objective function computation
  * soon becomes very expensive. The trade-off is to keep m_trials small, while being able to get good convergence. 
  *
+ * As the noise is additive, the original problem is evaluated only once per decision vector, and the noise samples of all
+ * the trials are then drawn in one block. The batch methods evaluate a whole batch on the original problem with
+ * base::objfun_batch() and base::compute_constraints_batch() before adding the noise, unless a thread pool was set on the
+ * noisy problem itself, in which case the default parallel batch evaluation is used.
+ *
  * @author Yung-Siang Liau (liauys@gmail.com)
  * @author Dario Izzo (dario.izzo@gmail.com)
  */
@@ -82,10 +88,11 @@ class __PAGMO_VISIBLE noisy : public base_stochastic
 		std::string human_readable_extra() const;
 		void objfun_impl(fitness_vector &, const decision_vector &) const;
 		void compute_constraints_impl(constraint_vector &, const decision_vector &) const;
+		void objfun_batch_impl(std::vector<fitness_vector> &, const std::vector<decision_vector> &) const;
+		void compute_constraints_batch_impl(std::vector<constraint_vector> &, const std::vector<decision_vector> &) const;
 
 	private:
-		void inject_noise_f(fitness_vector&) const;
-		void inject_noise_c(constraint_vector&) const;
+		void average_trials(std::vector<double> &, const std::vector<double> &, const decision_vector &) const;
 
 		friend class boost::serialization::access;
 		template <class Archive>
@@ -109,6 +116,8 @@ class __PAGMO_VISIBLE noisy : public base_stochastic
 		double m_param_first;
 		double m_param_second;
 		noise_type m_noise_type;
+		// Noise samples of all the trials (not serialized)
+		mutable std::vector<double> m_noise;
 };
 
 }} //namespaces
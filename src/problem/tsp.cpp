@@ -35,13 +35,14 @@ namespace pagmo { namespace problem {
     tsp::tsp() : base_tsp(3, 0, 0 , base_tsp::RANDOMKEYS), m_weights()
     {
         std::vector<double> dumb(3,0);
-        m_weights = std::vector<std::vector<double> > (3,dumb);
-        m_weights[0][1] = 1;
-        m_weights[0][2] = 1;
-        m_weights[2][1] = 1;
-        m_weights[1][0] = 1;
-        m_weights[2][0] = 1;
-        m_weights[1][2] = 1;
+        std::vector<std::vector<double> > weights(3,dumb);
+        weights[0][1] = 1;
+        weights[0][2] = 1;
+        weights[2][1] = 1;
+        weights[1][0] = 1;
+        weights[2][0] = 1;
+        weights[1][2] = 1;
+        m_weights.reset(new std::vector<std::vector<double> >(weights));
     }
 
     /// Constructor from weight matrix and encoding
@@ -55,9 +56,9 @@ namespace pagmo { namespace problem {
             compute_dimensions(weights.size(), encoding)[0],
             compute_dimensions(weights.size(), encoding)[1],
             encoding
-        ),  m_weights(weights)
+        ),  m_weights(new std::vector<std::vector<double> >(weights))
     {
-        check_weights(m_weights);
+        check_weights(*m_weights);
     }
 
     /// Clone method.
@@ -125,26 +126,26 @@ namespace pagmo { namespace problem {
             {
                 tour = full2cities(x);
                 for (decision_vector::size_type i=0; i<n_cities-1; ++i) {
-                    f[0] += m_weights[tour[i]][tour[i+1]];
+                    f[0] += (*m_weights)[tour[i]][tour[i+1]];
                 }
-                f[0]+= m_weights[tour[n_cities-1]][tour[0]];
+                f[0]+= (*m_weights)[tour[n_cities-1]][tour[0]];
                 break;
             }
             case RANDOMKEYS:
             {
                 tour = randomkeys2cities(x);
                 for (decision_vector::size_type i=0; i<n_cities-1; ++i) {
-                        f[0] += m_weights[tour[i]][tour[i+1]];
+                        f[0] += (*m_weights)[tour[i]][tour[i+1]];
                 }
-        	   f[0]+= m_weights[tour[n_cities-1]][tour[0]];
+        	   f[0]+= (*m_weights)[tour[n_cities-1]][tour[0]];
                 break;
 	       }
             case CITIES:
 	       {
     	        for (decision_vector::size_type i=0; i<n_cities-1; ++i) {
-                		f[0] += m_weights[x[i]][x[i+1]];
+                		f[0] += (*m_weights)[x[i]][x[i+1]];
             	}
-            	f[0]+= m_weights[x[n_cities-1]][x[0]];
+            	f[0]+= (*m_weights)[x[n_cities-1]][x[0]];
                 break;
 	       }
         }
@@ -228,7 +229,7 @@ namespace pagmo { namespace problem {
     /// Definition of distance function
     double tsp::distance(decision_vector::size_type i, decision_vector::size_type j) const
     {
-        return m_weights[i][j];
+        return (*m_weights)[i][j];
     }
 
     /// Getter for m_weights
@@ -237,7 +238,7 @@ namespace pagmo { namespace problem {
      */
     const std::vector<std::vector<double> >&  tsp::get_weights() const
     { 
-        return m_weights; 
+        return *m_weights; 
     }
 
     /// Returns the problem name
@@ -269,7 +270,7 @@ namespace pagmo { namespace problem {
         oss << "\tWeight Matrix: \n";
         for (decision_vector::size_type i=0; i<get_n_cities() ; ++i)
         {
-            oss << "\t\t" << m_weights[i] << '\n';
+            oss << "\t\t" << (*m_weights)[i] << '\n';
             if (i>5)
             {
                 oss << "\t\t..." << '\n';
@@ -26,6 +26,7 @@
 #define PAGMO_PROBLEM_TSP_H
 
 #include <boost/array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <vector>
 #include <string>
 
@@ -78,11 +79,12 @@ class __PAGMO_VISIBLE tsp: public base_tsp
         void serialize(Archive &ar, const unsigned int)
         {
             ar & boost::serialization::base_object<base_tsp>(*this);
-            ar & m_weights;
+            serialize_shared_data(ar, m_weights);
         }
 
     private:
-        std::vector<std::vector<double> > m_weights;
+        // Weight matrix, shared among the copies of the problem
+        boost::shared_ptr<const std::vector<std::vector<double> > > m_weights;
 };
 
 }}  //namespaces
@@ -36,13 +36,14 @@ namespace pagmo { namespace problem {
     tsp_cs::tsp_cs() : base_tsp(3, 0, 0 , base_tsp::RANDOMKEYS), m_weights(), m_values(), m_max_path_length(1.0)
     {
         std::vector<double> dumb(3,0);
-        m_weights = std::vector<std::vector<double> > (3,dumb);
-        m_weights[0][1] = 1;
-        m_weights[0][2] = 1;
-        m_weights[2][1] = 1;
-        m_weights[1][0] = 1;
-        m_weights[2][0] = 1;
-        m_weights[1][2] = 1;
+        std::vector<std::vector<double> > weights(3,dumb);
+        weights[0][1] = 1;
+        weights[0][2] = 1;
+        weights[2][1] = 1;
+        weights[1][0] = 1;
+        weights[2][0] = 1;
+        weights[1][2] = 1;
+        m_weights.reset(new std::vector<std::vector<double> >(weights));
 
         m_values = std::vector<double>(3,1.0);
         m_max_edge_length = 1;
@@ -63,9 +64,9 @@ namespace pagmo { namespace problem {
             compute_dimensions(weights.size(), encoding)[0],
             compute_dimensions(weights.size(), encoding)[1],
             encoding
-        ),  m_weights(weights), m_values(values), m_max_path_length(max_path_length)
+        ),  m_weights(new std::vector<std::vector<double> >(weights)), m_values(values), m_max_path_length(max_path_length)
     {
-        check_weights(m_weights);
+        check_weights(*m_weights);
         if (weights.size() != values.size()) 
         {
             pagmo_throw(value_error,"Size of weight matrix and values vector must be equal");
@@ -168,7 +169,7 @@ namespace pagmo { namespace problem {
 	    double ham_path_len = 0;
 	    for (decision_vector::size_type i=0; i<n_cities-1; ++i) 
         {
-            ham_path_len += m_weights[tour[i]][tour[i+1]];
+            ham_path_len += (*m_weights)[tour[i]][tour[i+1]];
         }
 
         f[0] = -(cum_p) - (1 - ham_path_len / (n_cities * m_max_edge_length));
@@ -223,7 +224,7 @@ namespace pagmo { namespace problem {
             while(cond_r) 
             {
                 // We increment the right "pointer" updating the value and length of the path
-                saved_length -= m_weights[tour[it_r % n_cities]][tour[(it_r + 1) % n_cities]];
+                saved_length -= (*m_weights)[tour[it_r % n_cities]][tour[(it_r + 1) % n_cities]];
                 cum_p += m_values[tour[(it_r + 1) % n_cities]];
                 it_r += 1;
 
@@ -258,7 +259,7 @@ namespace pagmo { namespace problem {
             else
             {
                 // We increment the left "pointer" updating the value and length of the path
-                saved_length += m_weights[tour[it_l % n_cities]][tour[(it_l + 1) % n_cities]];
+                saved_length += (*m_weights)[tour[it_l % n_cities]][tour[(it_l + 1) % n_cities]];
                 cum_p -= m_values[tour[it_l]];
                 it_l += 1;
                 // We update the various retvals only if the new subpath is valid
@@ -362,7 +363,7 @@ namespace pagmo { namespace problem {
     /// Definition of distance function
     double tsp_cs::distance(decision_vector::size_type i, decision_vector::size_type j) const
     {
-        return m_weights[i][j];
+        return (*m_weights)[i][j];
     }
 
     /// Getter for m_weights
@@ -371,7 +372,7 @@ namespace pagmo { namespace problem {
      */
     const std::vector<std::vector<double> >&  tsp_cs::get_weights() const
     { 
-        return m_weights; 
+        return *m_weights; 
     }
 
     /// Getter for m_values
@@ -423,7 +424,7 @@ namespace pagmo { namespace problem {
         oss << "\tWeight Matrix: \n";
         for (decision_vector::size_type i=0; i<get_n_cities() ; ++i)
         {
-            oss << "\t\t" << m_weights.at(i) << '\n';
+            oss << "\t\t" << m_weights->at(i) << '\n';
             if (i>5)
             {
                 oss << "\t\t..." << '\n';
@@ -26,6 +26,7 @@
 #define PAGMO_PROBLEM_TSP_CS_H
 
 #include <boost/array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <vector>
 #include <string>
 
@@ -94,14 +95,15 @@ class __PAGMO_VISIBLE tsp_cs: public base_tsp
         void serialize(Archive &ar, const unsigned int)
         {
             ar & boost::serialization::base_object<base_tsp>(*this);
-            ar & m_weights;
+            serialize_shared_data(ar, m_weights);
             ar & m_values;
             ar & const_cast<double &>(m_max_path_length);
 	        ar & m_max_edge_length;
         }
 
     private:
-        std::vector<std::vector<double> > m_weights;
+        // Weight matrix, shared among the copies of the problem
+        boost::shared_ptr<const std::vector<std::vector<double> > > m_weights;
         std::vector<double> m_values ;
         const double m_max_path_length;
         double m_max_edge_length;
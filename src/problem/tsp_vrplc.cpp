@@ -35,13 +35,14 @@ namespace pagmo { namespace problem {
     tsp_vrplc::tsp_vrplc() : base_tsp(3, 0, 0 , base_tsp::RANDOMKEYS), m_weights(), m_capacity(1.1)
     {
         std::vector<double> dumb(3,0);
-        m_weights = std::vector<std::vector<double> > (3,dumb);
-        m_weights[0][1] = 1;
-        m_weights[0][2] = 1;
-        m_weights[2][1] = 1;
-        m_weights[1][0] = 1;
-        m_weights[2][0] = 1;
-        m_weights[1][2] = 1;
+        std::vector<std::vector<double> > weights(3,dumb);
+        weights[0][1] = 1;
+        weights[0][2] = 1;
+        weights[2][1] = 1;
+        weights[1][0] = 1;
+        weights[2][0] = 1;
+        weights[1][2] = 1;
+        m_weights.reset(new std::vector<std::vector<double> >(weights));
     }
 
     /// Constructor from weight matrix, encoding and capacity
@@ -56,13 +57,13 @@ namespace pagmo { namespace problem {
             compute_dimensions(weights.size(), encoding)[0],
             compute_dimensions(weights.size(), encoding)[1],
             encoding
-        ),  m_weights(weights), m_capacity(capacity)
+        ),  m_weights(new std::vector<std::vector<double> >(weights)), m_capacity(capacity)
     {
         if (m_capacity <= 0)
         {
             pagmo_throw(value_error, "Maximum vehicle capacity needs to be strictly positive");
         }
-        check_weights(m_weights);
+        check_weights(*m_weights);
     }
 
     /// Clone method.
@@ -145,7 +146,7 @@ namespace pagmo { namespace problem {
             }
         }
         for (decision_vector::size_type i=0; i<n_cities-1; ++i) {
-            stl += m_weights[tour[i]][tour[i+1]];
+            stl += (*m_weights)[tour[i]][tour[i+1]];
             if(stl > m_capacity)
             {
                 stl = 0;
@@ -153,7 +154,7 @@ namespace pagmo { namespace problem {
             }
             else
             {
-                f[0] += (m_weights[tour[i]][tour[i+1]])/(n_cities*m_capacity);
+                f[0] += ((*m_weights)[tour[i]][tour[i+1]])/(n_cities*m_capacity);
             }
         }
         return;
@@ -175,7 +176,7 @@ namespace pagmo { namespace problem {
         for (decision_vector::size_type i=0; i<n_cities-1; ++i) 
         {
             cur_tour.push_back(x[i]);
-            stl += m_weights[x[i]][x[i+1]];
+            stl += (*m_weights)[x[i]][x[i+1]];
             if(stl > m_capacity)
             {
                     stl = 0;
@@ -268,7 +269,7 @@ namespace pagmo { namespace problem {
     /// Definition of the distance function
     double tsp_vrplc::distance(decision_vector::size_type i, decision_vector::size_type j) const
     {
-        return m_weights[i][j];
+        return (*m_weights)[i][j];
     }
 
     /// Getter for m_weights
@@ -277,7 +278,7 @@ namespace pagmo { namespace problem {
      */
     const std::vector<std::vector<double> >&  tsp_vrplc::get_weights() const
     { 
-        return m_weights; 
+        return *m_weights; 
     }
 
     /// Getter for m_capacity
@@ -319,7 +320,7 @@ namespace pagmo { namespace problem {
         oss << "\tWeight Matrix: \n";
         for (decision_vector::size_type i=0; i<get_n_cities() ; ++i)
         {
-            oss << "\t\t" << m_weights.at(i) << '\n';
+            oss << "\t\t" << m_weights->at(i) << '\n';
             if (i>5)
             {
                 oss << "\t\t..." << '\n';
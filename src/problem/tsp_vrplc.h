@@ -26,6 +26,7 @@
 #define PAGMO_PROBLEM_tsp_vrplc_H
 
 #include <boost/array.hpp>
+#include <boost/shared_ptr.hpp>
 #include <vector>
 #include <string>
 
@@ -78,12 +79,13 @@ class __PAGMO_VISIBLE tsp_vrplc: public base_tsp
         void serialize(Archive &ar, const unsigned int)
         {
             ar & boost::serialization::base_object<base_tsp>(*this);
-            ar & m_weights;
+            serialize_shared_data(ar, m_weights);
             ar & const_cast<double&>(m_capacity);
         }
 
     private:
-        std::vector<std::vector<double> > m_weights;
+        // Weight matrix, shared among the copies of the problem
+        boost::shared_ptr<const std::vector<std::vector<double> > > m_weights;
         const double m_capacity;
 };
 
@@ -22,43 +22,87 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
-#include <boost/thread/locks.hpp>
-#include <boost/thread/mutex.hpp>
 
 #include "rng.h"
 
 namespace pagmo
 {
 
-boost::mutex rng_generator::m_mutex;
-
 // Use as initial seed the number of microseconds elapsed since 01/01/1970, cast to uint32_t.
-rng_uint32 rng_generator::m_seeder(boost::uint32_t((boost::posix_time::microsec_clock::local_time() -
-	boost::posix_time::ptime(boost::gregorian::date(1970,1,1))).total_microseconds()));
+boost::atomic<boost::uint64_t> rng_generator::m_state(boost::uint64_t(boost::uint32_t((boost::posix_time::microsec_clock::local_time() -
+	boost::posix_time::ptime(boost::gregorian::date(1970,1,1))).total_microseconds())) << 32);
 
 /// Set seed.
 /**
- * Set the seed of the internal generator to n. Thread-safe. Note that input integer n will be
+ * Set the key of the sequence of seeds to n, and reset its counter. Thread-safe. Note that input integer n will be
  * cast to uint32_t.
  *
  * @param[in] n seed for the generator of pseudo-random number generators.
  */
 void rng_generator::set_seed(int n)
 {
-	boost::lock_guard<boost::mutex> lock(m_mutex);
-	m_seeder.seed(n);
+	m_state.store(boost::uint64_t(boost::uint32_t(n)) << 32);
 }
 
+/// Jump ahead.
+/**
+ * Skip the next n seeds of the sequence. Thread-safe.
+ *
+ * @param[in] n number of seeds to skip.
+ */
+void rng_generator::discard(const boost::uint32_t n)
+{
+	m_state.fetch_add(n, boost::memory_order_relaxed);
+}
 
-template <class Rng> 
+/// Philox-2x32-10 bijection.
+/**
+ * @param[in] key key of the bijection.
+ * @param[in] c0 first word of the counter.
+ * @param[in] c1 second word of the counter.
+ *
+ * @return first word of the output block.
+ */
+boost::uint32_t rng_generator::philox(const boost::uint32_t key, const boost::uint32_t c0, const boost::uint32_t c1)
+{
+	boost::uint32_t k = key, x0 = c0, x1 = c1;
+	for (int round = 0; round < 10; ++round) {
+		const boost::uint64_t prod = boost::uint64_t(0xD256D193u) * x0;
+		x0 = boost::uint32_t(prod >> 32) ^ k ^ x1;
+		x1 = boost::uint32_t(prod);
+		k += 0x9E3779B9u;
+	}
+	return x0;
+}
+
+template <class Rng>
 Rng rng_generator::get()
 {
-	boost::lock_guard<boost::mutex> lock(m_mutex);
-	return Rng(m_seeder());
+	const boost::uint64_t state = m_state.fetch_add(1, boost::memory_order_relaxed);
+	return Rng(philox(boost::uint32_t(state >> 32), boost::uint32_t(state), 0));
+}
+
+/// Return pseudo-random number generator of a given stream.
+/**
+ * The generator is seeded from the key of the sequence and the stream number, and the counter of the sequence is left untouched:
+ * for a given seed of the sequence, the generator of a stream is always the same.
+ *
+ * @param[in] stream number of the stream.
+ *
+ * @return pseudo-random number generator of the stream.
+ */
+template <class Rng>
+Rng rng_generator::get(const boost::uint32_t stream)
+{
+	return Rng(philox(boost::uint32_t(m_state.load(boost::memory_order_relaxed) >> 32), stream, 1));
 }
 
 template __PAGMO_VISIBLE rng_double rng_generator::get<rng_double>();
 template __PAGMO_VISIBLE rng_uint32 rng_generator::get<rng_uint32>();
+template __PAGMO_VISIBLE rng_double rng_generator::get<rng_double>(const boost::uint32_t);
+template __PAGMO_VISIBLE rng_uint32 rng_generator::get<rng_uint32>(const boost::uint32_t);
 
 }
@@ -27,13 +27,13 @@
 #ifndef PAGMO_RNG_H
 #define PAGMO_RNG_H
 
+#include <boost/atomic.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/random/lagged_fibonacci.hpp>
 #include <boost/random/mersenne_twister.hpp>
-#include <boost/thread/locks.hpp>
-#include <boost/thread/mutex.hpp>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "serialization.h"
 #include "config.h"
@@ -61,22 +61,35 @@ class __PAGMO_VISIBLE rng_uint32: public boost::mt19937 {
 		rng_uint32(const result_type &n):boost::mt19937(n) {}
 		// Default generated copy ctor and assignment are fine.
 	private:
-		// Serialization exploits the fact that the state of Boost RNGs
-		// can be sent/received to/from standard streams.
+		// The state of Boost RNGs is accessible only through standard streams: it is extracted from them
+		// and archived as an array of integers (the 624 words of the state), which binary archives store
+		// as raw data. Version 0 archived the textual representation of the state.
 		template <class Archive>
 		void save(Archive &ar, const unsigned int) const
 		{
 			std::stringstream ss;
 			ss << *static_cast<boost::mt19937 const *>(this);
-			std::string tmp(ss.str());
-			ar << tmp;
+			std::vector<boost::uint32_t> state(boost::mt19937::state_size);
+			for (std::vector<boost::uint32_t>::size_type i = 0; i < state.size(); ++i) {
+				ss >> state[i];
+			}
+			ar << state;
 		}
 		template <class Archive>
-		void load(Archive &ar, const unsigned int)
+		void load(Archive &ar, const unsigned int version)
 		{
-			std::string tmp;
-			ar >> tmp;
-			std::stringstream ss(tmp);
+			std::stringstream ss;
+			if (version == 0) {
+				std::string tmp;
+				ar >> tmp;
+				ss.str(tmp);
+			} else {
+				std::vector<boost::uint32_t> state;
+				ar >> state;
+				for (std::vector<boost::uint32_t>::size_type i = 0; i < state.size(); ++i) {
+					ss << state[i] << ' ';
+				}
+			}
 			ss >> *static_cast<boost::mt19937 *>(this);
 		}
 		BOOST_SERIALIZATION_SPLIT_MEMBER()
@@ -101,20 +114,37 @@ class __PAGMO_VISIBLE rng_double: public boost::lagged_fibonacci607 {
 		rng_double(const boost::uint32_t &n):boost::lagged_fibonacci607(n) {}
 		// Default generated copy ctor and assignment are fine.
 	private:
+		// As for rng_uint32, the state is archived as integers: the position in the lag table,
+		// followed by the 607 entries of the table as multiples of 2^-48.
 		template <class Archive>
 		void save(Archive &ar, const unsigned int) const
 		{
 			std::stringstream ss;
 			ss << *static_cast<boost::lagged_fibonacci607 const *>(this);
-			std::string tmp(ss.str());
-			ar << tmp;
+			std::vector<boost::uint64_t> state(boost::lagged_fibonacci607::long_lag + 1);
+			ss >> state[0];
+			for (std::vector<boost::uint64_t>::size_type i = 1; i < state.size(); ++i) {
+				double tmp;
+				ss >> tmp;
+				state[i] = static_cast<boost::uint64_t>(tmp);
+			}
+			ar << state;
 		}
 		template <class Archive>
-		void load(Archive &ar, const unsigned int)
+		void load(Archive &ar, const unsigned int version)
 		{
-			std::string tmp;
-			ar >> tmp;
-			std::stringstream ss(tmp);
+			std::stringstream ss;
+			if (version == 0) {
+				std::string tmp;
+				ar >> tmp;
+				ss.str(tmp);
+			} else {
+				std::vector<boost::uint64_t> state;
+				ar >> state;
+				for (std::vector<boost::uint64_t>::size_type i = 0; i < state.size(); ++i) {
+					ss << state[i] << ' ';
+				}
+			}
 			ss >> *static_cast<boost::lagged_fibonacci607 *>(this);
 		}
 		BOOST_SERIALIZATION_SPLIT_MEMBER()
@@ -124,37 +154,47 @@ class __PAGMO_VISIBLE rng_double: public boost::lagged_fibonacci607 {
 /**
  * To use, call the static member get() to get a pseudo-random number generator seeded with an initial pseudo-random value.
  *
- * Implementation internally uses a mutex, so that this generator can
- * be safely called concurrently from multiple threads. The initial seed used
- * is the number of microseconds elapsed since 01/01/1970, cast to uint32_t.
+ * The seeds are drawn from a counter-based sequence: the n-th call to get() seeds the generator with the output of the
+ * Philox-2x32-10 bijection keyed by the seed of the sequence and applied to the counter n. Handing out a generator is a
+ * single atomic increment of the counter, so that no lock is taken and concurrent calls do not serialise on a mutex.
+ * The sequence of seeds is reproducible after set_seed(), and discard() jumps ahead in it without computing the skipped seeds.
+ * get(stream) returns the generator of an explicitly numbered stream, independent of the counter, e.g., to give a reproducible
+ * generator to each island of a parameter sweep regardless of the order in which they are built.
  *
+ * The initial seed of the sequence is the number of microseconds elapsed since 01/01/1970, cast to uint32_t.
+ * The key and the counter share a single atomic 64-bit word: after 2^32 generators the counter overflows into the key, and
+ * the sequence continues with the one of the next seed.
+ *
+ * @see John K. Salmon, Mark A. Moraes, Ron O. Dror, David E. Shaw, "Parallel random numbers: as easy as 1, 2, 3", SC 2011.
  * @see http://www.boost.org/doc/libs/release/libs/random/index.html
  *
  * @author Francesco Biscani (bluescarni@gmail.com)
  */
-
-
-
 class __PAGMO_VISIBLE rng_generator {
 	public:
 		/// Return pseudo-random number generator.
 		/**
 		 * Type Rng must be a Boost-like pseudo-random number generator initialisable
-		 * with a boost::uint32_t. Return value is seeded with an internal
-		 * static pagmo::rng_uint32.
+		 * with a boost::uint32_t. Return value is seeded with the next seed of the sequence.
 		 *
 		 * @return pseudo-random number generator seeded with pseudo-random value.
 		 */
-
-		template <class Rng> 
+		template <class Rng>
 		static Rng get();
+		template <class Rng>
+		static Rng get(const boost::uint32_t);
 		static void set_seed(int);
+		static void discard(const boost::uint32_t);
+		static boost::uint32_t philox(const boost::uint32_t, const boost::uint32_t, const boost::uint32_t);
 
 	private:
-		static  boost::mutex  m_mutex;
-		static  rng_uint32  m_seeder;
+		// Key (upper 32 bits) and counter (lower 32 bits) of the sequence of seeds.
+		static boost::atomic<boost::uint64_t> m_state;
 };
 
 }
 
+BOOST_CLASS_VERSION(pagmo::rng_uint32,1)
+BOOST_CLASS_VERSION(pagmo::rng_double,1)
+
 #endif
@@ -35,6 +35,8 @@
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/serialization/assume_abstract.hpp>
 #include <boost/serialization/base_object.hpp>
 #include <boost/serialization/export.hpp>
@@ -46,6 +48,7 @@
 #include <boost/serialization/utility.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/serialization/version.hpp>
+#include <boost/type_traits/integral_constant.hpp>
 #include <limits>
 
 // Serialization of circular buffer, unordered map.
@@ -62,9 +65,30 @@
 
 namespace pagmo {
 
-/// Custom save function for the serialization of vector of doubles that handle also inf and NaN.
+/// Type trait to detect binary archives.
+/**
+ * The value member is true if Archive is one of the binary archives of Boost.Serialization, false otherwise.
+ */
+template <class Archive>
+struct is_binary_archive: boost::false_type {};
+
+template <>
+struct is_binary_archive<boost::archive::binary_oarchive>: boost::true_type {};
+
+template <>
+struct is_binary_archive<boost::archive::binary_iarchive>: boost::true_type {};
+
+/// First class version storing vectors of doubles in raw binary form in binary archives.
+/**
+ * Classes saving their vectors of doubles via custom_vector_double_save() must set their version
+ * (via BOOST_CLASS_VERSION) to at least this value in order to use the binary representation. Archives written
+ * with older class versions are still loaded through the textual representation.
+ */
+static const unsigned int binary_vector_double_version = 1;
+
+// Textual representation of a vector of doubles, handling also inf and NaN.
 template <class Archive>
-void custom_vector_double_save(Archive &ar, const std::vector<double> &v, const unsigned int)
+void custom_vector_double_save_impl(Archive &ar, const std::vector<double> &v, const boost::false_type &)
 {
 	const std::vector<double>::size_type size = v.size();
 	// Save size.
@@ -87,9 +111,19 @@ void custom_vector_double_save(Archive &ar, const std::vector<double> &v, const
 	}
 }
 
-/// Custom load function for the serialization of vector of doubles that handle also inf and NaN.
+// Raw binary representation of a vector of doubles: inf and NaN (including their payload) are preserved bit-exactly.
+template <class Archive>
+void custom_vector_double_save_impl(Archive &ar, const std::vector<double> &v, const boost::true_type &)
+{
+	const std::vector<double>::size_type size = v.size();
+	ar << size;
+	if (size) {
+		ar.save_binary(&v[0],size * sizeof(double));
+	}
+}
+
 template <class Archive>
-void custom_vector_double_load(Archive &ar, std::vector<double> &v, const unsigned int)
+void custom_vector_double_load_impl(Archive &ar, std::vector<double> &v, const boost::false_type &)
 {
 	std::vector<double>::size_type size = 0;
 	// Load size.
@@ -110,6 +144,72 @@ void custom_vector_double_load(Archive &ar, std::vector<double> &v, const unsign
 	}
 }
 
+template <class Archive>
+void custom_vector_double_load_impl(Archive &ar, std::vector<double> &v, const boost::true_type &)
+{
+	std::vector<double>::size_type size = 0;
+	ar >> size;
+	v.resize(size);
+	if (size) {
+		ar.load_binary(&v[0],size * sizeof(double));
+	}
+}
+
+/// Custom save function for the serialization of vector of doubles that handle also inf and NaN.
+/**
+ * In binary archives, if version is not less than pagmo::binary_vector_double_version, the doubles are written
+ * in raw binary form. Otherwise, each double is converted to a string.
+ */
+template <class Archive>
+void custom_vector_double_save(Archive &ar, const std::vector<double> &v, const unsigned int version)
+{
+	if (version >= binary_vector_double_version) {
+		custom_vector_double_save_impl(ar,v,is_binary_archive<Archive>());
+	} else {
+		custom_vector_double_save_impl(ar,v,boost::false_type());
+	}
+}
+
+/// Custom load function for the serialization of vector of doubles that handle also inf and NaN.
+/**
+ * Counterpart of custom_vector_double_save(): version must be the class version read from the archive.
+ */
+template <class Archive>
+void custom_vector_double_load(Archive &ar, std::vector<double> &v, const unsigned int version)
+{
+	if (version >= binary_vector_double_version) {
+		custom_vector_double_load_impl(ar,v,is_binary_archive<Archive>());
+	} else {
+		custom_vector_double_load_impl(ar,v,boost::false_type());
+	}
+}
+
+
+template <class Archive, class T>
+void serialize_shared_data_impl(Archive &ar, boost::shared_ptr<const T> &p, const boost::mpl::true_ &)
+{
+	ar << *p;
+}
+
+template <class Archive, class T>
+void serialize_shared_data_impl(Archive &ar, boost::shared_ptr<const T> &p, const boost::mpl::false_ &)
+{
+	boost::shared_ptr<T> tmp(new T());
+	ar >> *tmp;
+	p = tmp;
+}
+
+/// Serialization of immutable data shared among the copies of an object.
+/**
+ * The data pointed to by p is saved by value, in the same format as a plain data member of type T would be, so that
+ * switching a member to a shared block does not change the archive format. On loading, p is reset to a newly allocated block.
+ */
+template <class Archive, class T>
+void serialize_shared_data(Archive &ar, boost::shared_ptr<const T> &p)
+{
+	serialize_shared_data_impl(ar,p,typename Archive::is_saving());
+}
+
 }
 
 namespace boost { namespace serialization {
@@ -0,0 +1,271 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#include <boost/cstdint.hpp>
+#include <boost/functional/hash.hpp>
+#include <cstddef>
+#include <cstring>
+#include <list>
+#include <utility>
+
+#include "../types.h"
+#include "eval_cache.h"
+
+namespace pagmo { namespace util {
+
+/// Constructor from capacity.
+/**
+ * @param[in] capacity maximum number of entries stored in the cache.
+ */
+eval_cache::eval_cache(size_type capacity):m_capacity(capacity),m_hits(0),m_misses(0) {}
+
+/// Copy constructor.
+eval_cache::eval_cache(const eval_cache &other):m_capacity(other.m_capacity),m_list(other.m_list),m_hits(other.m_hits),m_misses(other.m_misses)
+{
+	rebuild_index();
+}
+
+/// Assignment operator.
+eval_cache &eval_cache::operator=(const eval_cache &other)
+{
+	if (this != &other) {
+		m_capacity = other.m_capacity;
+		m_list = other.m_list;
+		m_hits = other.m_hits;
+		m_misses = other.m_misses;
+		rebuild_index();
+	}
+	return *this;
+}
+
+/// Get capacity.
+/**
+ * @return the maximum number of entries stored in the cache.
+ */
+eval_cache::size_type eval_cache::get_capacity() const
+{
+	return m_capacity;
+}
+
+/// Set capacity.
+/**
+ * If the new capacity is smaller than the current number of entries, the least recently used entries will be discarded.
+ *
+ * @param[in] capacity new maximum number of entries stored in the cache.
+ */
+void eval_cache::set_capacity(size_type capacity)
+{
+	m_capacity = capacity;
+	evict(m_capacity);
+}
+
+/// Get size.
+/**
+ * @return the number of entries currently stored in the cache.
+ */
+eval_cache::size_type eval_cache::size() const
+{
+	return m_list.size();
+}
+
+/// Remove all entries.
+/**
+ * Capacity and hit/miss counters are not modified.
+ */
+void eval_cache::clear()
+{
+	m_index.clear();
+	m_list.clear();
+}
+
+/// Look up a fitness vector.
+/**
+ * If a fitness vector associated to x is stored in the cache, it will be copied into f and the corresponding entry will become the most recently used.
+ *
+ * @param[out] f fitness vector into which the cached value will be written.
+ * @param[in] x decision vector to be looked up.
+ *
+ * @return true in case of a hit, false otherwise.
+ */
+bool eval_cache::get_f(fitness_vector &f, const decision_vector &x)
+{
+	const list_type::iterator it = find(x,hash(x));
+	if (it == m_list.end() || !it->m_has_f) {
+		++m_misses;
+		return false;
+	}
+	++m_hits;
+	f = it->m_f;
+	m_list.splice(m_list.begin(),m_list,it);
+	return true;
+}
+
+/// Look up a constraint vector.
+/**
+ * If a constraint vector associated to x is stored in the cache, it will be copied into c and the corresponding entry will become the most recently used.
+ *
+ * @param[out] c constraint vector into which the cached value will be written.
+ * @param[in] x decision vector to be looked up.
+ *
+ * @return true in case of a hit, false otherwise.
+ */
+bool eval_cache::get_c(constraint_vector &c, const decision_vector &x)
+{
+	const list_type::iterator it = find(x,hash(x));
+	if (it == m_list.end() || !it->m_has_c) {
+		++m_misses;
+		return false;
+	}
+	++m_hits;
+	c = it->m_c;
+	m_list.splice(m_list.begin(),m_list,it);
+	return true;
+}
+
+/// Store a fitness vector.
+/**
+ * Associate f to x, making the corresponding entry the most recently used one.
+ *
+ * @param[in] x decision vector.
+ * @param[in] f fitness vector of x.
+ */
+void eval_cache::set_f(const decision_vector &x, const fitness_vector &f)
+{
+	if (!m_capacity) {
+		return;
+	}
+	const list_type::iterator it = insert(x,hash(x));
+	it->m_f = f;
+	it->m_has_f = true;
+}
+
+/// Store a constraint vector.
+/**
+ * Associate c to x, making the corresponding entry the most recently used one.
+ *
+ * @param[in] x decision vector.
+ * @param[in] c constraint vector of x.
+ */
+void eval_cache::set_c(const decision_vector &x, const constraint_vector &c)
+{
+	if (!m_capacity) {
+		return;
+	}
+	const list_type::iterator it = insert(x,hash(x));
+	it->m_c = c;
+	it->m_has_c = true;
+}
+
+/// Get the number of hits.
+/**
+ * @return the number of successful look-ups performed since construction.
+ */
+unsigned long eval_cache::get_hits() const
+{
+	return m_hits;
+}
+
+/// Get the number of misses.
+/**
+ * @return the number of unsuccessful look-ups performed since construction.
+ */
+unsigned long eval_cache::get_misses() const
+{
+	return m_misses;
+}
+
+// Hash of the bit pattern of a decision vector.
+std::size_t eval_cache::hash(const decision_vector &x)
+{
+	std::size_t retval = 0;
+	for (decision_vector::size_type i = 0; i < x.size(); ++i) {
+		boost::uint64_t tmp;
+		std::memcpy(&tmp,&x[i],sizeof(tmp));
+		boost::hash_combine(retval,tmp);
+	}
+	return retval;
+}
+
+// Bitwise equality of decision vectors.
+bool eval_cache::equal(const decision_vector &x1, const decision_vector &x2)
+{
+	return x1.size() == x2.size() && (x1.empty() || std::memcmp(&x1[0],&x2[0],sizeof(double) * x1.size()) == 0);
+}
+
+// Locate the entry of x, whose hash is h. Return m_list.end() if not found.
+eval_cache::list_type::iterator eval_cache::find(const decision_vector &x, std::size_t h)
+{
+	std::pair<index_type::iterator,index_type::iterator> range = m_index.equal_range(h);
+	for (; range.first != range.second; ++range.first) {
+		if (equal(range.first->second->m_x,x)) {
+			return range.first->second;
+		}
+	}
+	return m_list.end();
+}
+
+// Locate or create the entry of x, whose hash is h, and move it to the front of the list.
+eval_cache::list_type::iterator eval_cache::insert(const decision_vector &x, std::size_t h)
+{
+	list_type::iterator it = find(x,h);
+	if (it != m_list.end()) {
+		m_list.splice(m_list.begin(),m_list,it);
+		return it;
+	}
+	evict(m_capacity - 1u);
+	m_list.push_front(entry());
+	it = m_list.begin();
+	it->m_hash = h;
+	it->m_x = x;
+	m_index.insert(std::make_pair(h,it));
+	return it;
+}
+
+// Discard the least recently used entries until at most n are left.
+void eval_cache::evict(size_type n)
+{
+	while (m_list.size() > n) {
+		list_type::iterator last = m_list.end();
+		--last;
+		std::pair<index_type::iterator,index_type::iterator> range = m_index.equal_range(last->m_hash);
+		for (; range.first != range.second; ++range.first) {
+			if (range.first->second == last) {
+				m_index.erase(range.first);
+				break;
+			}
+		}
+		m_list.erase(last);
+	}
+}
+
+// Rebuild the hash index from the list of entries.
+void eval_cache::rebuild_index()
+{
+	m_index.clear();
+	for (list_type::iterator it = m_list.begin(); it != m_list.end(); ++it) {
+		m_index.insert(std::make_pair(it->m_hash,it));
+	}
+}
+
+}}
@@ -0,0 +1,139 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#ifndef PAGMO_UTIL_EVAL_CACHE_H
+#define PAGMO_UTIL_EVAL_CACHE_H
+
+#include <boost/unordered_map.hpp>
+#include <cstddef>
+#include <list>
+
+#include "../config.h"
+#include "../serialization.h"
+#include "../types.h"
+
+namespace pagmo { namespace util {
+
+/// Least-recently-used cache of fitness and constraint vectors.
+/**
+ * This class associates decision vectors to their fitness and constraint vectors. It is used by problem::base
+ * to avoid re-evaluating the objective function and the constraints on recently-seen decision vectors.
+ *
+ * Entries are indexed by a hash of the bit pattern of the decision vector, so that look-ups and insertions
+ * take constant time on average irrespective of the capacity. Two decision vectors are considered equal if they have
+ * the same bit pattern. Fitness and constraint vectors of the same decision vector are stored in the same entry.
+ * When the number of entries reaches the capacity, the least recently used entry is discarded. A capacity of zero disables the cache.
+ *
+ * The cache keeps track of the number of successful (hits) and unsuccessful (misses) look-ups.
+ */
+class __PAGMO_VISIBLE eval_cache
+{
+	public:
+		/// Size type.
+		typedef std::size_t size_type;
+		explicit eval_cache(size_type capacity = 0);
+		eval_cache(const eval_cache &);
+		eval_cache &operator=(const eval_cache &);
+		size_type get_capacity() const;
+		void set_capacity(size_type);
+		size_type size() const;
+		void clear();
+		bool get_f(fitness_vector &, const decision_vector &);
+		bool get_c(constraint_vector &, const decision_vector &);
+		void set_f(const decision_vector &, const fitness_vector &);
+		void set_c(const decision_vector &, const constraint_vector &);
+		unsigned long get_hits() const;
+		unsigned long get_misses() const;
+	private:
+		struct entry
+		{
+			entry():m_hash(0),m_has_f(false),m_has_c(false) {}
+			std::size_t		m_hash;
+			decision_vector		m_x;
+			fitness_vector		m_f;
+			constraint_vector	m_c;
+			bool			m_has_f;
+			bool			m_has_c;
+		};
+		// Entries are kept in a list ordered from the most to the least recently used.
+		typedef std::list<entry> list_type;
+		typedef boost::unordered_multimap<std::size_t,list_type::iterator> index_type;
+		static std::size_t hash(const decision_vector &);
+		static bool equal(const decision_vector &, const decision_vector &);
+		list_type::iterator find(const decision_vector &, std::size_t);
+		list_type::iterator insert(const decision_vector &, std::size_t);
+		void evict(size_type);
+		void rebuild_index();
+		friend class boost::serialization::access;
+		template <class Archive>
+		void save(Archive &ar, const unsigned int version) const
+		{
+			ar << m_capacity;
+			ar << m_hits;
+			ar << m_misses;
+			const size_type size = m_list.size();
+			ar << size;
+			for (list_type::const_iterator it = m_list.begin(); it != m_list.end(); ++it) {
+				custom_vector_double_save(ar,it->m_x,version);
+				custom_vector_double_save(ar,it->m_f,version);
+				custom_vector_double_save(ar,it->m_c,version);
+				ar << it->m_has_f;
+				ar << it->m_has_c;
+			}
+		}
+		template <class Archive>
+		void load(Archive &ar, const unsigned int version)
+		{
+			ar >> m_capacity;
+			ar >> m_hits;
+			ar >> m_misses;
+			size_type size;
+			ar >> size;
+			m_list.clear();
+			for (size_type i = 0; i < size; ++i) {
+				entry e;
+				custom_vector_double_load(ar,e.m_x,version);
+				custom_vector_double_load(ar,e.m_f,version);
+				custom_vector_double_load(ar,e.m_c,version);
+				ar >> e.m_has_f;
+				ar >> e.m_has_c;
+				e.m_hash = hash(e.m_x);
+				m_list.push_back(e);
+			}
+			rebuild_index();
+		}
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
+	private:
+		size_type	m_capacity;
+		list_type	m_list;
+		index_type	m_index;
+		unsigned long	m_hits;
+		unsigned long	m_misses;
+};
+
+}}
+
+BOOST_CLASS_VERSION(pagmo::util::eval_cache,pagmo::binary_vector_double_version)
+
+#endif
@@ -29,33 +29,78 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 /// Destructor required for pure virtual methods
 base::~base() {}
 
+/// Set the thread pool.
+/**
+ * Algorithms which can run on multiple threads will run their parallel sections on pool, which can be shared with other algorithms
+ * and problems. Passing a null pointer makes the computations serial. The pool is shared among all the copies of the algorithm
+ * created afterwards.
+ *
+ * @param[in] pool thread pool to be used by the computations.
+ */
+void base::set_thread_pool(const thread_pool_ptr &pool)
+{
+	m_thread_pool = pool;
+}
+
+/// Get the thread pool.
+/**
+ * @return const reference to the thread pool used by the computations (null if they run serially).
+ */
+const thread_pool_ptr &base::get_thread_pool() const
+{
+	return m_thread_pool;
+}
+
+/// Create the thread pool of the algorithm.
+/**
+ * Invoked by the constructors (and by deserialization) of the algorithms taking a number of threads: the pool is created once,
+ * and it is shared by the copies of the algorithm.
+ *
+ * @param[in] n_threads number of threads of the pool. If zero, the number of hardware threads available on the system will be used.
+ * If one, no pool is created and the computations run serially.
+ */
+void base::init_thread_pool(const unsigned int n_threads)
+{
+	if (n_threads == 1) {
+		m_thread_pool.reset();
+	} else {
+		m_thread_pool.reset(new thread_pool(n_threads));
+	}
+}
+
 /// Assert that reference point dominates every other point from the set.
 /**
  * This is a method that can be referenced from verify_before_compute method.
  * The method checks whether the provided reference point fits the minimisation assumption, e.g.,
  * reference point must be "no worse" and in at least one objective and "better" for each of the points from the set.
  *
- * @param[in] points - vector of fitness_vectors for which the hypervolume is computed
+ * The coordinates of each point are scanned without branching, so that the inner loop can be vectorised,
+ * and the error message is built only for the first offending point.
+ *
+ * @param[in] points - matrix of the points for which the hypervolume is computed
  * @param[in] r_point - distinguished "reference point".
-*/
-void base::assert_minimisation(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+ */
+void base::assert_minimisation(const point_matrix &points, const fitness_vector &r_point) const
 {
-	for(std::vector<fitness_vector>::size_type idx = 0 ; idx < points.size() ; ++idx) {
-		bool outside_bounds = false;
-		bool all_equal = true;
+	const point_matrix::size_type f_dim = points.cols();
+	const double *r = &r_point[0];
+	for(point_matrix::size_type idx = 0 ; idx < points.rows() ; ++idx) {
+		const double *p = points[idx];
+		unsigned int n_outside = 0;
+		unsigned int n_equal = 0;
 
-		for(fitness_vector::size_type f_idx = 0 ; f_idx < points[idx].size() ; ++f_idx) {
-			outside_bounds |= (r_point[f_idx] < points[idx][f_idx]);
-			all_equal &= (r_point[f_idx] == points[idx][f_idx]);
+		for(point_matrix::size_type f_idx = 0 ; f_idx < f_dim ; ++f_idx) {
+			n_outside += (r[f_idx] < p[f_idx]);
+			n_equal += (r[f_idx] == p[f_idx]);
 		}
-		if (all_equal || outside_bounds) {
+		if (n_equal == f_dim || n_outside > 0) {
 			// Prepare error message.
 			std::stringstream ss;
 			std::string str_p("("), str_r("(");
-			for(fitness_vector::size_type f_idx = 0 ; f_idx < points[idx].size() ; ++f_idx) {
-					str_p += boost::lexical_cast<std::string>(points[idx][f_idx]);
-					str_r += boost::lexical_cast<std::string>(r_point[f_idx]);
-				if (f_idx < points[idx].size() - 1) {
+			for(point_matrix::size_type f_idx = 0 ; f_idx < f_dim ; ++f_idx) {
+					str_p += boost::lexical_cast<std::string>(p[f_idx]);
+					str_r += boost::lexical_cast<std::string>(r[f_idx]);
+				if (f_idx < f_dim - 1) {
 					str_p += ", ";
 					str_r += ", ";
 				} else {
@@ -232,6 +277,82 @@ std::vector<double> base::contributions(std::vector<fitness_vector> &points, con
 	return c;
 }
 
+/// Compute method for a point matrix
+/**
+ * Default implementation converts the matrix into a vector of fitness_vectors and calls the 'compute' method.
+ *
+ * @param[in] points matrix of the points for which the hypervolume is computed
+ * @param[in] r_point distinguished "reference point".
+ *
+ * @return hypervolume of the set of points
+ */
+double base::compute(point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<fitness_vector> points_v = points.to_vectors();
+	return compute(points_v, r_point);
+}
+
+/// Exclusive hypervolume method for a point matrix
+/**
+ * Default implementation converts the matrix into a vector of fitness_vectors and calls the 'exclusive' method.
+ *
+ * @param[in] p_idx index of the individual
+ * @param[in] points matrix of the points for which the hypervolume is computed
+ * @param[in] r_point distinguished "reference point".
+ *
+ * @return exlusive hypervolume contributed by the individual at index p_idx
+ */
+double base::exclusive(const unsigned int p_idx, point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<fitness_vector> points_v = points.to_vectors();
+	return exclusive(p_idx, points_v, r_point);
+}
+
+/// Least contributor method for a point matrix
+/**
+ * Default implementation converts the matrix into a vector of fitness_vectors and calls the 'least_contributor' method.
+ *
+ * @param[in] points matrix of the points for which the hypervolume is computed
+ * @param[in] r_point distinguished "reference point".
+ *
+ * @return index of the least contributor
+ */
+unsigned int base::least_contributor(point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<fitness_vector> points_v = points.to_vectors();
+	return least_contributor(points_v, r_point);
+}
+
+/// Greatest contributor method for a point matrix
+/**
+ * Default implementation converts the matrix into a vector of fitness_vectors and calls the 'greatest_contributor' method.
+ *
+ * @param[in] points matrix of the points for which the hypervolume is computed
+ * @param[in] r_point distinguished "reference point".
+ *
+ * @return index of the greatest contributor
+ */
+unsigned int base::greatest_contributor(point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<fitness_vector> points_v = points.to_vectors();
+	return greatest_contributor(points_v, r_point);
+}
+
+/// Contributions method for a point matrix
+/**
+ * Default implementation converts the matrix into a vector of fitness_vectors and calls the 'contributions' method.
+ *
+ * @param[in] points matrix of the points for which the contributions are computed
+ * @param[in] r_point distinguished "reference point".
+ *
+ * @return vector of exclusive contributions by every point
+ */
+std::vector<double> base::contributions(point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<fitness_vector> points_v = points.to_vectors();
+	return contributions(points_v, r_point);
+}
+
 /// Compute volume between two points
 /**
  * Calculates the volume between points a and b (as defined for n-dimensional Euclidean spaces).
@@ -264,7 +385,7 @@ double base::volume_between(const fitness_vector &a, const fitness_vector &b, un
  *
  * @return volume of hypercube defined by points a and b
  */
-double base::volume_between(double* a, double* b, unsigned int size)
+double base::volume_between(const double* a, const double* b, unsigned int size)
 {
 	double volume = 1.0;
 	while(size--) {
@@ -312,32 +433,46 @@ int base::dom_cmp(const fitness_vector &a, const fitness_vector &b, unsigned int
 /**
  * Establishes the domination relationship between two points (overloaded for double*);
  *
+ * The coordinates are compared without early exits, so that the loop can be vectorised:
+ * for the small dimensions typical of multi-objective problems this is faster than the branching version.
+ *
  * returns DOM_CMP_B_DOMINATES_A if point 'b' DOMINATES point 'a'
  * returns DOM_CMP_A_DOMINATES_B if point 'a' DOMINATES point 'b'
  * returns DOM_CMP_A_B_EQUAL if point 'a' IS EQUAL TO 'b'
  * returns DOM_CMP_INCOMPARABLE otherwise
  */
-int base::dom_cmp(double* a, double* b, unsigned int size)
+int base::dom_cmp(const double* a, const double* b, unsigned int size)
 {
-	for(fitness_vector::size_type i = 0; i < size ; ++i) {
-		if (a[i] > b[i]) {
-			for(fitness_vector::size_type j = i + 1; j < size ; ++j) {
-				if (a[j] < b[j]) {
-					return DOM_CMP_INCOMPARABLE;
-				}
-			}
-			return DOM_CMP_B_DOMINATES_A;
-		}
-		else if (a[i] < b[i]) {
-			for(fitness_vector::size_type j = i + 1 ; j < size ; ++j) {
-				if (a[j] > b[j]) {
-					return DOM_CMP_INCOMPARABLE;
-				}
-			}
-			return DOM_CMP_A_DOMINATES_B;
-		}
+	unsigned int a_better = 0;
+	unsigned int b_better = 0;
+	for(unsigned int i = 0; i < size ; ++i) {
+		a_better += (a[i] < b[i]);
+		b_better += (a[i] > b[i]);
 	}
-	return DOM_CMP_A_B_EQUAL;
+	if (a_better > 0) {
+		return (b_better > 0) ? DOM_CMP_INCOMPARABLE : DOM_CMP_A_DOMINATES_B;
+	}
+	return (b_better > 0) ? DOM_CMP_B_DOMINATES_A : DOM_CMP_A_B_EQUAL;
+}
+
+/// Seed of a sampling stream
+/**
+ * Used by the Monte Carlo algorithms in order to give each independent block of samples its own random stream.
+ * The seed of the stream is obtained by mixing the seed of the computation with the index of the stream (SplitMix64 finalizer),
+ * so that the samples, and hence the result, depend only on the seed and not on the order or on the thread in which the blocks are processed.
+ *
+ * @param[in] seed seed of the computation
+ * @param[in] stream index of the stream
+ *
+ * @return seed for the random number generator of the stream
+ */
+boost::uint32_t base::sampling_seed(const boost::uint32_t seed, const boost::uint64_t stream)
+{
+	boost::uint64_t z = (static_cast<boost::uint64_t>(seed) << 32) ^ ((stream + 1) * 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	z ^= (z >> 31);
+	return static_cast<boost::uint32_t>(z >> 32);
 }
 
 ///Constructor of the comparator object
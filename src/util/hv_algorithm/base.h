@@ -28,12 +28,15 @@
 #include <iostream>
 #include <string>
 #include <typeinfo>
+#include <boost/cstdint.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "../../config.h"
 #include "../../exceptions.h"
 #include "../../serialization.h"
 #include "../../types.h"
+#include "../point_matrix.h"
+#include "../thread_pool.h"
 
 namespace pagmo { namespace util {
 /// Hypervolume algorithm namespace.
@@ -85,6 +88,14 @@ typedef boost::shared_ptr<base> base_ptr;
  * Additionally, any newly implemented hypervolume algorithm should overload the 'base::verify_before_compute' method in order to prevent
  * the computation for the incompatible data.
  *
+ * Algorithms which can run on multiple threads use the util::thread_pool returned by get_thread_pool(), and run serially when it is null.
+ * The pool can be shared by several algorithms (and problems, see problem::base::set_thread_pool()) via set_thread_pool(), so that
+ * repeated computations do not create and join threads each time.
+ *
+ * Each of the public methods above is available also for a point set stored as a pagmo::util::point_matrix, which is the representation
+ * used by the pagmo::util::hypervolume class. The default implementations convert the matrix into a vector of fitness_vectors and forward
+ * the call, algorithms working on contiguous blocks of coordinates (e.g. WFG) can overload them in order to avoid the conversion.
+ *
  * @author Krzysztof Nowak (kn@kiryx.net)
  */
 class __PAGMO_VISIBLE base
@@ -105,15 +116,21 @@ public:
 	virtual unsigned int greatest_contributor(std::vector<fitness_vector> &, const fitness_vector &) const;
 	virtual std::vector<double> contributions(std::vector<fitness_vector> &, const fitness_vector &) const;
 
+	virtual double compute(point_matrix &, const fitness_vector &) const;
+	virtual double exclusive(const unsigned int, point_matrix &, const fitness_vector &) const;
+	virtual unsigned int least_contributor(point_matrix &, const fitness_vector &) const;
+	virtual unsigned int greatest_contributor(point_matrix &, const fitness_vector &) const;
+	virtual std::vector<double> contributions(point_matrix &, const fitness_vector &) const;
+
 	/// Verification of input
 	/**
 	 * This method serves as a verification method.
 	 * Not every algorithm is suited of every type of problem.
 	 *
-	 * @param[in] points - vector of fitness_vectors for which the hypervolume is computed
+	 * @param[in] points - matrix of the points for which the hypervolume is computed
 	 * @param[in] r_point - distinguished "reference point".
 	 */
-	virtual void verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const = 0;
+	virtual void verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const = 0;
 
 	/// Clone method.
 	/**
@@ -124,8 +141,12 @@ public:
 	virtual std::string get_name() const;
 	virtual ~base();
 
+	void set_thread_pool(const thread_pool_ptr &);
+	const thread_pool_ptr &get_thread_pool() const;
+
 protected:
-	void assert_minimisation(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void assert_minimisation(const point_matrix &, const fitness_vector &) const;
+	void init_thread_pool(const unsigned int);
 
 	virtual unsigned int extreme_contributor(std::vector<fitness_vector> &, const fitness_vector &, bool (*)(double, double)) const;
 
@@ -145,10 +166,14 @@ protected:
 		DOM_CMP_INCOMPARABLE = 4 // points are incomparable
 	};
 
-	static double volume_between(double*, double*, unsigned int);
-	static int dom_cmp(double*, double*, unsigned int);
+	static double volume_between(const double*, const double*, unsigned int);
+	static boost::uint32_t sampling_seed(const boost::uint32_t, const boost::uint64_t);
+	static int dom_cmp(const double*, const double*, unsigned int);
 	static int dom_cmp(const fitness_vector &, const fitness_vector &, unsigned int = 0);
 
+	/// Thread pool used by the parallel algorithms (null if the computations run serially).
+	thread_pool_ptr m_thread_pool;
+
 private:
 	friend class boost::serialization::access;
 	template <class Archive>
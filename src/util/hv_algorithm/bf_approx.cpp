@@ -24,6 +24,9 @@
 
 
 #include "bf_approx.h"
+#include "../thread_pool.h"
+#include <cmath>
+#include <limits>
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
@@ -39,9 +42,36 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  * @param[in] delta_multiplier factor with which delta diminishes each round
  * @param[in] initial_delta_coeff initial coefficient multiplied by the delta at round 0
  * @param[in] alpha coefficicient stating how accurately current lowest contributor should be sampled
+ * @param[in] n_threads number of threads of the pool used for the sampling (see base::set_thread_pool()). If zero, the number of hardware threads
+ * available on the system will be used. If one, no pool is created.
  */
-bf_approx::bf_approx(const bool use_exact, const unsigned int trivial_subcase_size, const double eps, const double delta, const double delta_multiplier, const double alpha, const double initial_delta_coeff, const double gamma)
-	: m_use_exact(use_exact), m_trivial_subcase_size(trivial_subcase_size), m_eps(eps), m_delta(delta), m_delta_multiplier(delta_multiplier), m_alpha(alpha), m_initial_delta_coeff(initial_delta_coeff), m_gamma(gamma) { }
+bf_approx::bf_approx(const bool use_exact, const unsigned int trivial_subcase_size, const double eps, const double delta, const double delta_multiplier, const double alpha, const double initial_delta_coeff, const double gamma, const unsigned int n_threads)
+	: m_use_exact(use_exact), m_trivial_subcase_size(trivial_subcase_size), m_eps(eps), m_delta(delta), m_delta_multiplier(delta_multiplier), m_alpha(alpha), m_initial_delta_coeff(initial_delta_coeff), m_gamma(gamma), m_n_threads(n_threads), m_seed(0)
+{
+	init_thread_pool(n_threads);
+}
+
+const unsigned int bf_approx::sample_block;
+
+/// Sampling job of a round
+/**
+ * The i-th invocation performs the sampling round of the i-th point still in the race. Each point owns its own counters, so the invocations are independent.
+ */
+struct bf_approx::sampling_task : thread_pool::task
+{
+	sampling_task(const bf_approx &parent, const std::vector<fitness_vector> &points, const double delta, const unsigned int round, const double log_factor) :
+		m_parent(parent), m_points(points), m_delta(delta), m_round(round), m_log_factor(log_factor) { }
+	void operator()(unsigned int, std::size_t i)
+	{
+		const unsigned int idx = m_parent.m_point_set[i];
+		m_parent.sampling_round(m_points, m_delta, m_round, idx, m_log_factor, 2 * static_cast<boost::uint64_t>(m_round) * m_points.size() + idx);
+	}
+	const bf_approx				&m_parent;
+	const std::vector<fitness_vector>	&m_points;
+	const double				m_delta;
+	const unsigned int			m_round;
+	const double				m_log_factor;
+};
 
 double bf_approx::lc_end_condition(unsigned int idx, unsigned int LC, std::vector<double> &approx_volume, std::vector<double> &point_delta)
 {
@@ -122,6 +152,8 @@ unsigned int bf_approx::approx_extreme_contributor(std::vector<fitness_vector> &
 	m_point_delta = std::vector<double>(points.size(), 0.0);
 	m_boxes = std::vector<fitness_vector>(points.size());
 	m_box_points = std::vector<std::vector<unsigned int> >(points.size());
+	m_box_coords = std::vector<point_matrix>(points.size());
+	m_seed = static_cast<boost::uint32_t>(m_drng() * std::numeric_limits<boost::uint32_t>::max());
 
 	// precomputed log factor for the point delta computation
 	const double log_factor = log (2. * points.size() * (1. + m_gamma) / (m_delta * m_gamma) );
@@ -174,6 +206,14 @@ unsigned int bf_approx::approx_extreme_contributor(std::vector<fitness_vector> &
 		}
 	}
 
+	// pack the coordinates of the overlapping points
+	for(std::vector<fitness_vector>::size_type idx = 0 ; idx < points.size() ; ++idx) {
+		m_box_coords[idx] = point_matrix(m_box_points[idx].size(), points[idx].size());
+		for(unsigned int i = 0 ; i < m_box_points[idx].size() ; ++i) {
+			m_box_coords[idx].set_row(i, points[m_box_points[idx][i]]);
+		}
+	}
+
 	// decrease the initial maximum volume by a constant factor
 	r_delta *= m_initial_delta_coeff;
 
@@ -182,13 +222,17 @@ unsigned int bf_approx::approx_extreme_contributor(std::vector<fitness_vector> &
 		r_delta *= m_delta_multiplier;
 		++round_no;
 
-		for(unsigned int _i = 0 ; _i < m_point_set.size() ; ++_i) {
-			unsigned int idx = m_point_set[_i];
-			sampling_round(points, r_delta , round_no, idx, log_factor);
+		sampling_task task(*this, points, r_delta, round_no, log_factor);
+		if (m_thread_pool && m_point_set.size() > 1) {
+			m_thread_pool->run(task, m_point_set.size());
+		} else {
+			for(unsigned int _i = 0 ; _i < m_point_set.size() ; ++_i) {
+				task(0, _i);
+			}
 		}
 
 		// sample the extreme contributor
-		sampling_round(points, m_alpha * r_delta , round_no, EC, log_factor);
+		sampling_round(points, m_alpha * r_delta , round_no, EC, log_factor, (2 * static_cast<boost::uint64_t>(round_no) + 1) * points.size() + EC);
 
 		// find the new extreme contributor
 		for(unsigned int _i = 0 ; _i < m_point_set.size() ; ++_i) {
@@ -234,7 +278,10 @@ unsigned int bf_approx::approx_extreme_contributor(std::vector<fitness_vector> &
 }
 
 /// Performs a single round of sampling for given point at index 'idx'
-void bf_approx::sampling_round(const std::vector<fitness_vector> &points, const double delta, const unsigned int round, const unsigned int idx, const double log_factor) const
+/**
+ * The new samples are drawn from the random stream with the given index.
+ */
+void bf_approx::sampling_round(const std::vector<fitness_vector> &points, const double delta, const unsigned int round, const unsigned int idx, const double log_factor, const boost::uint64_t stream) const
 {
 	if (m_use_exact) {
 		// if the sampling for given point was already resolved using exact method
@@ -278,49 +325,69 @@ void bf_approx::sampling_round(const std::vector<fitness_vector> &points, const
 	double tmp = m_box_volume[idx] / delta;
 	double required_no_samples = 0.5 * ( (1. + m_gamma) * log( round ) + log_factor ) * tmp * tmp;
 
-	while(m_no_samples[idx] < required_no_samples) {
-		++m_no_samples[idx];
-		if (sample_successful(points, idx)) {
-			++m_no_succ_samples[idx];
-		}
+	if (m_no_samples[idx] < required_no_samples) {
+		const unsigned long long n_new = static_cast<unsigned long long>(std::ceil(required_no_samples)) - m_no_samples[idx];
+		rng_double drng(base::sampling_seed(m_seed, stream));
+		m_no_succ_samples[idx] += count_successful(points, idx, n_new, drng);
+		m_no_samples[idx] += n_new;
 	}
 
 	m_approx_volume[idx] = static_cast<double>(m_no_succ_samples[idx]) / static_cast<double>(m_no_samples[idx]) * m_box_volume[idx];
 	m_point_delta[idx] = compute_point_delta(round, idx, log_factor) * m_box_volume[idx];
 }
 
-/// samples the bounding box and returns true if it fell into the exclusive hypervolume
-bool bf_approx::sample_successful(const std::vector<fitness_vector> &points, const unsigned int idx) const
+/// samples the bounding box and returns the number of samples that fell into the exclusive hypervolume
+/**
+ * The samples are drawn in blocks of 'sample_block' points, stored coordinate by coordinate. Each point overlapping the bounding box
+ * is then checked against the whole block at once, with branch-free loops over the samples, and the check stops as soon as every sample
+ * of the block is known to be dominated.
+ */
+unsigned long long bf_approx::count_successful(const std::vector<fitness_vector> &points, const unsigned int idx, unsigned long long n_samples, rng_double &drng) const
 {
 	const fitness_vector &lb = points[idx];
 	const fitness_vector &ub = m_boxes[idx];
-	fitness_vector rnd_p(lb.size(), 0.0);
-	for(unsigned int i = 0 ; i < lb.size() ; ++ i) {
-		rnd_p[i] = lb[i] + m_drng()*(ub[i]-lb[i]);
-	}
-
-	for(unsigned int i = 0 ; i < m_box_points[idx].size() ; ++i) {
-
-		// box_p is a point overlapping the bounding box volume
-		const fitness_vector &box_p = points[m_box_points[idx][i]];
-
-		// assume that box_p DOMINATES the random point and try to prove it otherwise below
-		bool dominates = true;
-
-		// increase the number of operations by the dimension size
-		m_no_ops[idx] += box_p.size() + 1;
-		for(unsigned int d_idx = 0 ; d_idx < box_p.size() ; ++d_idx) {
-			if(rnd_p[d_idx] < box_p[d_idx]) { // box_p does not dominate rnd_p
-				dominates=false;
-				break;
+	const point_matrix &box_p = m_box_coords[idx];
+	const unsigned int f_dim = lb.size();
+
+	// samples[d_idx * sample_block + s] is the d_idx-th coordinate of the s-th sample of the block
+	std::vector<double> samples(f_dim * sample_block);
+	std::vector<unsigned char> alive(sample_block), dominated(sample_block);
+	unsigned long long n_successful = 0;
+
+	while(n_samples > 0) {
+		const unsigned int size = static_cast<unsigned int>(std::min<unsigned long long>(n_samples, sample_block));
+		for(unsigned int s = 0 ; s < size ; ++s) {
+			for(unsigned int d_idx = 0 ; d_idx < f_dim ; ++d_idx) {
+				samples[d_idx * sample_block + s] = lb[d_idx] + drng()*(ub[d_idx]-lb[d_idx]);
 			}
+			alive[s] = 1;
 		}
-		// if the box_p dominated the rnd_p return the sample as false
-		if (dominates) {
-			return false;
+
+		unsigned int n_alive = size;
+		for(point_matrix::size_type i = 0 ; i < box_p.rows() && n_alive > 0 ; ++i) {
+			// increase the number of operations by the dimension size for each sample still alive
+			m_no_ops[idx] += static_cast<unsigned long long>(n_alive) * (f_dim + 1);
+
+			// a sample is dominated by the point box_p[i] if it is not better in any coordinate
+			const double *q = box_p[i];
+			std::fill(dominated.begin(), dominated.begin() + size, 1);
+			for(unsigned int d_idx = 0 ; d_idx < f_dim ; ++d_idx) {
+				const double *col = &samples[d_idx * sample_block];
+				const double q_d = q[d_idx];
+				for(unsigned int s = 0 ; s < size ; ++s) {
+					dominated[s] &= (col[s] >= q_d);
+				}
+			}
+			n_alive = 0;
+			for(unsigned int s = 0 ; s < size ; ++s) {
+				alive[s] &= !dominated[s];
+				n_alive += alive[s];
+			}
 		}
+		n_successful += n_alive;
+		n_samples -= size;
 	}
-	return true;
+	return n_successful;
 }
 
 /// Compute delta for given point
@@ -404,12 +471,12 @@ fitness_vector bf_approx::compute_bounding_box(const std::vector<fitness_vector>
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the d dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the d dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void bf_approx::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void bf_approx::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	base::assert_minimisation(points, r_point);
 }
@@ -443,6 +510,15 @@ std::string bf_approx::get_name() const
 	return "Bringmann-Friedrich approximation method";
 }
 
+/// Get the number of threads
+/**
+ * @return the number of threads of the pool created at construction (zero meaning the number of hardware threads, one meaning no pool).
+ */
+unsigned int bf_approx::get_n_threads() const
+{
+	return m_n_threads;
+}
+
 } } }
 
 BOOST_CLASS_EXPORT_IMPLEMENT(pagmo::util::hv_algorithm::bf_approx)
@@ -43,6 +43,11 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  * This is the class containing the implementation of the Bringmann-Friedrich approximation method for the computation of the least contributor to the hypervolume.
  * Default values for the parameters of the algorithm were obtained from the shark implementation of the algorithm (http://image.diku.dk/shark/doxygen_pages/html/_least_contributor_approximator_8hpp_source.html)
  *
+ * In each round of the algorithm the points still in the race are sampled independently, and this can be done on multiple threads.
+ * The samples of a point in a given round are drawn from a dedicated random stream, seeded from a single draw of the generator of the algorithm,
+ * the index of the round and the index of the point, so that the result does not depend on the number of threads.
+ * Samples are drawn in blocks and each block is checked at once against the points overlapping the bounding box, one coordinate at a time.
+ *
  * @see "Approximating the least hypervolume contributor: NP-hard in general, but fast in practice", Karl Bringmann, Tobias Friedrich.
  *
  * @author Krzysztof Nowak (kn@kiryx.net)
@@ -50,20 +55,27 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 class __PAGMO_VISIBLE bf_approx : public base
 {
 public:
-	bf_approx(const bool use_exact = true, const unsigned int trivial_subcase_size = 1, const double eps = 1e-2, const double delta = 1e-6, const double delta_multiplier = 0.775, const double m_alpha = 0.2, const double initial_delta_coeff = 0.1, const double gamma = 0.25);
+	bf_approx(const bool use_exact = true, const unsigned int trivial_subcase_size = 1, const double eps = 1e-2, const double delta = 1e-6, const double delta_multiplier = 0.775, const double m_alpha = 0.2, const double initial_delta_coeff = 0.1, const double gamma = 0.25, const unsigned int n_threads = 1);
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
 	unsigned int least_contributor(std::vector<fitness_vector> &, const fitness_vector &) const;
 	unsigned int greatest_contributor(std::vector<fitness_vector> &, const fitness_vector &) const;
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
+	unsigned int get_n_threads() const;
 
 private:
+	struct sampling_task;
+	friend struct sampling_task;
+
+	// number of samples checked at once by 'count_successful'
+	static const unsigned int sample_block = 64;
+
 	inline double compute_point_delta(const unsigned int, const unsigned int, const double) const;
 	inline fitness_vector compute_bounding_box(const std::vector<fitness_vector> &, const fitness_vector &, const unsigned int) const;
 	inline int point_in_box(const fitness_vector &p, const fitness_vector &a, const fitness_vector &b) const;
-	inline void sampling_round(const std::vector<fitness_vector>&, const double, const unsigned int, const unsigned int, const double) const;
-	inline bool sample_successful(const std::vector<fitness_vector> &, const unsigned int) const;
+	void sampling_round(const std::vector<fitness_vector>&, const double, const unsigned int, const unsigned int, const double, const boost::uint64_t) const;
+	unsigned long long count_successful(const std::vector<fitness_vector> &, const unsigned int, unsigned long long, rng_double &) const;
 
 	enum extreme_contrib_type {
 		LEAST = 1,
@@ -103,6 +115,9 @@ private:
 	// constant used for the computation of point delta
 	const double m_gamma;
 
+	// number of threads of the pool created at construction
+	const unsigned int m_n_threads;
+
 	mutable rng_double	m_drng;
 
 	/**
@@ -138,13 +153,19 @@ private:
 	// list of indices of points that overlap the bounding box of each point
 	// during monte carlo sampling it suffices to check only these points when deciding whether the sampling was "successful"
 	mutable std::vector<std::vector<unsigned int> > m_box_points;
+
+	// coordinates of the points in m_box_points, packed for the batched dominance test
+	mutable std::vector<point_matrix> m_box_coords;
+
+	// seed of the sampling streams of the current computation
+	mutable boost::uint32_t m_seed;
 	/**
 	 * End of 'least_contributor' method variables section
 	 */
 
 	friend class boost::serialization::access;
 	template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void serialize(Archive &ar, const unsigned int version)
 	{
 		ar & boost::serialization::base_object<base>(*this);
 		ar & const_cast<bool &>(m_use_exact);
@@ -156,11 +177,18 @@ private:
 		ar & const_cast<double &>(m_initial_delta_coeff);
 		ar & const_cast<double &>(m_gamma);
 		ar & m_drng;
+		if (version >= 1) {
+			ar & const_cast<unsigned int &>(m_n_threads);
+		}
+		if (Archive::is_loading::value) {
+			init_thread_pool(m_n_threads);
+		}
 	}
 };
 
 } } }
 
 BOOST_CLASS_EXPORT_KEY(pagmo::util::hv_algorithm::bf_approx)
+BOOST_CLASS_VERSION(pagmo::util::hv_algorithm::bf_approx,1)
 
 #endif
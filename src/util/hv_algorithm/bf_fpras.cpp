@@ -25,6 +25,7 @@
 
 #include "bf_fpras.h"
 #include <algorithm>
+#include <limits>
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
@@ -34,27 +35,107 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  *
  * @param[in] eps accuracy of the approximation
  * @param[in] delta confidence of the approximation
+ * @param[in] n_threads number of threads of the pool used for the sampling (see base::set_thread_pool()). If zero, the number of hardware threads
+ * available on the system will be used. If one, no pool is created.
  */
-bf_fpras::bf_fpras(const double eps, const double delta) : m_eps(eps), m_delta(delta) { }
+bf_fpras::bf_fpras(const double eps, const double delta, const unsigned int n_threads) : m_eps(eps), m_delta(delta), m_n_threads(n_threads)
+{
+	init_thread_pool(n_threads);
+}
+
+const boost::uint_fast64_t bf_fpras::block_size;
 
 /// Verify before compute
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the d dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the d dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void bf_fpras::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void bf_fpras::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	base::assert_minimisation(points, r_point);
 }
 
+/// Sampling job of the 'compute' method
+/**
+ * The i-th invocation runs the FPRAS sampling for the i-th block of the budget of steps, using its own random stream.
+ * It records the number of rounds and the number of steps they took: the round in progress at the end of the block is completed,
+ * so that the rounds of consecutive blocks can be concatenated into a single sequence of rounds.
+ */
+struct bf_fpras::sampling_task : thread_pool::task
+{
+	sampling_task(const point_matrix &points, const fitness_vector &r_point, const std::vector<double> &sums, const boost::uint_fast64_t T,
+		const boost::uint32_t seed, std::vector<boost::uint_fast64_t> &rounds, std::vector<boost::uint_fast64_t> &steps) :
+		m_points(points), m_r_point(r_point), m_sums(sums), m_T(T), m_seed(seed), m_rounds(rounds), m_steps(steps) { }
+	void operator()(unsigned int, std::size_t b)
+	{
+		sample(b, std::min(block_size, m_T - b * block_size), true, m_rounds[b], m_steps[b]);
+	}
+	// Samples the rounds of the b-th block until budget steps are taken. If finish is true the last round is completed
+	// past the budget, otherwise it is interrupted and not counted. The random stream depends on b only, hence sampling the
+	// same block again with a smaller budget replays a prefix of its rounds.
+	void sample(const std::size_t b, const boost::uint_fast64_t budget, const bool finish, boost::uint_fast64_t &rounds, boost::uint_fast64_t &steps) const
+	{
+		rng_double drng(base::sampling_seed(m_seed, b));
+		const unsigned int n = m_points.rows();
+		const unsigned int dim = m_points.cols();
+		const double V = m_sums.back();
+		boost::uint_fast64_t n_rounds = 0, n_steps = 0;
+
+		// Container for the random point
+		std::vector<double> rnd_point(dim, 0.0);
+		while(n_steps < budget) {
+			// Get the random volume in-between [0, V] range, in order to choose the box with probability sums[i] / V
+			const double r = drng() * V;
+
+			// Find the contributor using binary search
+			const unsigned int i = std::distance(m_sums.begin(), std::lower_bound(m_sums.begin(), m_sums.end(), r));
+
+			// Sample a point inside the 'box' (r_point, points[i])
+			const double *p = m_points[i];
+			for(unsigned int d_idx = 0 ; d_idx < dim ; ++d_idx) {
+				rnd_point[d_idx] = (p[d_idx] + drng() * (m_r_point[d_idx] - p[d_idx]));
+			}
+
+			// Draw random points until one of them dominates the sample
+			boost::uint_fast64_t round_steps = 0;
+			const double *q;
+			do {
+				if (!finish && n_steps + round_steps >= budget) {
+					rounds = n_rounds;
+					steps = n_steps;
+					return;
+				}
+				q = m_points[static_cast<unsigned int>(n * drng())];
+				++round_steps;
+			} while (base::dom_cmp(&rnd_point[0], q, dim) != base::DOM_CMP_B_DOMINATES_A);
+			n_steps += round_steps;
+			++n_rounds;
+		}
+		rounds = n_rounds;
+		steps = n_steps;
+	}
+	const point_matrix			&m_points;
+	const fitness_vector			&m_r_point;
+	const std::vector<double>		&m_sums;
+	const boost::uint_fast64_t		m_T;
+	const boost::uint32_t			m_seed;
+	std::vector<boost::uint_fast64_t>	&m_rounds;
+	std::vector<boost::uint_fast64_t>	&m_steps;
+};
+
 /// Compute method
 /**
  * Compute the hypervolume using FPRAS.
  *
+ * The budget of T steps is split into blocks, sampled (possibly in parallel) with independent random streams.
+ * Each block completes its last round, so that the rounds of the blocks, concatenated in order, are a single sequence of independent rounds.
+ * As in the sequential algorithm, the volume is estimated as T * V / (n * M), M being the number of rounds of the sequence completed within
+ * the first T steps: the block in which the T-th step falls is sampled again, up to that step.
+ *
  * @see "Approximating the volume of unions and intersections of high-dimensional geometric objects", Karl Bringmann, Tobias Friedrich.
  *
  * @param[in] points vector of fitness_vectors for which the hypervolume is computed
@@ -65,55 +146,45 @@ void bf_fpras::verify_before_compute(const std::vector<fitness_vector> &points,
 double bf_fpras::compute(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
 {
 	unsigned int n = points.size();
-	unsigned int dim = r_point.size();
 	boost::uint_fast64_t T = static_cast<boost::uint_fast64_t>( 12. * std::log( 1. / m_delta ) / std::log( 2. ) * n / m_eps / m_eps );
 
 	// Partial sums of consecutive boxes
 	std::vector<double> sums(n, 0.0);
 
-	// points iterator
-	std::vector<fitness_vector>::iterator it_p;
-
-	// volume iterator - used for finding the contributor using std::lower_bound
-	std::vector<double>::iterator it_sums;
-
-	unsigned int i = 0;
-
 	// Total sum of every box
 	double V = 0.0;
-	for(it_p = points.begin() ; it_p != points.end() ; ++it_p) {
-		V = (sums[i++] = V + base::volume_between(*it_p, r_point));
+	for(unsigned int i = 0 ; i < n ; ++i) {
+		V = (sums[i] = V + base::volume_between(points[i], r_point));
 	}
 
-	unsigned long long M = 0; // Round counter
-	unsigned long long M_sum = 0; // Total number of samples over every round so far
-
-	// Container for the random point
-	fitness_vector rnd_point(dim, 0.0);
+	// Contiguous copy of the points, shared by the sampling blocks
+	const point_matrix points_m(points);
 
-	while(true) {
-		// Get the random volume in-between [0, V] range, in order to choose the box with probability sums[i] / V
-		double r = m_drng() * V;
-
-		// Find the contributor using binary search
-		it_sums = std::lower_bound(sums.begin(), sums.end(), r);
-		i = std::distance(sums.begin(), it_sums);
-
-		// Sample a point inside the 'box' (r_point, points[i])
-		for(unsigned int d_idx = 0 ; d_idx < dim ; ++d_idx) {
-			rnd_point[d_idx] = (points[i][d_idx] + m_drng() * (r_point[d_idx] - points[i][d_idx]));
+	const std::size_t n_blocks = static_cast<std::size_t>((T + block_size - 1) / block_size);
+	const boost::uint32_t seed = static_cast<boost::uint32_t>(m_drng() * std::numeric_limits<boost::uint32_t>::max());
+	std::vector<boost::uint_fast64_t> rounds(n_blocks, 0), steps(n_blocks, 0);
+	sampling_task task(points_m, r_point, sums, T, seed, rounds, steps);
+	if (!m_thread_pool || n_blocks == 1) {
+		for (std::size_t b = 0 ; b < n_blocks ; ++b) {
+			task(0, b);
 		}
+	} else {
+		m_thread_pool->run(task, n_blocks);
+	}
 
-		unsigned int j = 0;
-		do {
-			if ( M_sum >= T ) {
-				return (T * V) / static_cast<double>(n * M);
-			}
-			j = static_cast<unsigned int>(n * m_drng());
-			++M_sum;
-		} while (!(base::dom_cmp(rnd_point, points[j]) == base::DOM_CMP_B_DOMINATES_A));
-		++M;
+	unsigned long long M = 0; // Round counter
+	unsigned long long M_sum = 0; // Total number of samples over every round so far
+	std::size_t b = 0;
+	for ( ; b < n_blocks && M_sum + steps[b] <= T ; ++b) {
+		M += rounds[b];
+		M_sum += steps[b];
 	}
+	if (b < n_blocks) {
+		boost::uint_fast64_t b_rounds, b_steps;
+		task.sample(b, T - M_sum, false, b_rounds, b_steps);
+		M += b_rounds;
+	}
+	return (T * V) / static_cast<double>(n * M);
 }
 
 /// Exclusive method
@@ -173,6 +244,15 @@ std::string bf_fpras::get_name() const
 	return "Hypervolume algorithm based on FPRAS";
 }
 
+/// Get the number of threads
+/**
+ * @return the number of threads of the pool created at construction (zero meaning the number of hardware threads, one meaning no pool).
+ */
+unsigned int bf_fpras::get_n_threads() const
+{
+	return m_n_threads;
+}
+
 } } }
 
 BOOST_CLASS_EXPORT_IMPLEMENT(pagmo::util::hv_algorithm::bf_fpras)
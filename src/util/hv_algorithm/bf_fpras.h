@@ -34,6 +34,7 @@
 #include "base.h"
 
 #include "../hypervolume.h"
+#include "../thread_pool.h"
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
@@ -41,6 +42,10 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 /**
  * This class contains the implementation of the Bringmann-Friedrich approximation scheme (FPRAS), reduced to a special case of approximating the hypervolume indicator.
  *
+ * The sampling can run on multiple threads. The budget of samples is split into blocks of fixed size, each block drawing from its own
+ * random stream (seeded from a single draw of the generator of the algorithm and the index of the block), and the blocks are reduced in order.
+ * Hence, for a given state of the generator, the estimate does not depend on the number of threads.
+ *
  * @see "Approximating the volume of unions and intersections of high-dimensional geometric objects", Karl Bringmann, Tobias Friedrich.
  *
  * @author Krzysztof Nowak (kn@kiryx.net)
@@ -48,7 +53,7 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 class __PAGMO_VISIBLE bf_fpras : public base
 {
 public:
-	bf_fpras(const double eps = 1e-2, const double delta = 1e-2);
+	bf_fpras(const double eps = 1e-2, const double delta = 1e-2, const unsigned int n_threads = 1);
 
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
 
@@ -57,31 +62,47 @@ public:
 	unsigned int greatest_contributor(std::vector<fitness_vector> &, const fitness_vector &) const;
 	std::vector<double> contributions(std::vector<fitness_vector> &, const fitness_vector &) const;
 
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
+	unsigned int get_n_threads() const;
 
 private:
+	struct sampling_task;
+	friend struct sampling_task;
+
+	// number of steps of each block of samples
+	static const boost::uint_fast64_t block_size = 1 << 20;
+
 	// error of the approximation
 	const double m_eps;
 	// probabiltiy of error
 	const double m_delta;
+	// number of threads of the pool created at construction
+	const unsigned int m_n_threads;
 
 	mutable rng_double m_drng;
 
 	friend class boost::serialization::access;
 	template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void serialize(Archive &ar, const unsigned int version)
 	{
 		ar & boost::serialization::base_object<base>(*this);
 		ar & const_cast<double &>(m_eps);
 		ar & const_cast<double &>(m_delta);
 		ar & m_drng;
+		if (version >= 1) {
+			ar & const_cast<unsigned int &>(m_n_threads);
+		}
+		if (Archive::is_loading::value) {
+			init_thread_pool(m_n_threads);
+		}
 	}
 };
 
 } } }
 
 BOOST_CLASS_EXPORT_KEY(pagmo::util::hv_algorithm::bf_fpras)
+BOOST_CLASS_VERSION(pagmo::util::hv_algorithm::bf_fpras,1)
 
 #endif
@@ -54,12 +54,12 @@ double fpl::compute(std::vector<fitness_vector> &points, const fitness_vector &r
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the 4-dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the 4-dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void fpl::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void fpl::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	base::assert_minimisation(points, r_point);
 }
@@ -58,7 +58,7 @@ class __PAGMO_VISIBLE fpl : public base
 public:
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
 
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
 
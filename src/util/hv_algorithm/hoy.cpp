@@ -25,16 +25,90 @@
 
 #include "hoy.h"
 #include "base.h"
+#include "../thread_pool.h"
 #include <algorithm>
 #include <bitset>
 #include <cmath>
 #include <limits>
 #include <boost/numeric/conversion/cast.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
 /// Constructor
-hoy::hoy() { }
+/**
+ * @param[in] n_threads number of threads of the pool used for the computation (see base::set_thread_pool()). If zero, the number of hardware threads
+ * available on the system will be used. If one, no pool is created.
+ */
+hoy::hoy(const unsigned int n_threads) : m_subproblems(0), m_split_level(0), m_n_threads(n_threads)
+{
+	init_thread_pool(n_threads);
+}
+
+/// Thread pool job computing the volumes of the subproblems. Each worker thread lazily creates its own workspace.
+struct hoy::parallel_task : thread_pool::task
+{
+	parallel_task(const hoy &parent, const std::vector<subproblem> &subproblems, std::vector<double> &volumes, unsigned int n_threads) :
+		m_parent(parent), m_subproblems(subproblems), m_volumes(volumes), m_workers(n_threads) { }
+	~parallel_task()
+	{
+		for (std::vector<boost::shared_ptr<hoy> >::size_type i = 0; i < m_workers.size(); ++i) {
+			if (m_workers[i]) {
+				m_workers[i]->free_members();
+			}
+		}
+	}
+	void operator()(unsigned int thread_idx, std::size_t i)
+	{
+		if (!m_workers[thread_idx]) {
+			boost::shared_ptr<hoy> w(new hoy());
+			w->m_dimension = m_parent.m_dimension;
+			w->m_total_size = m_parent.m_total_size;
+			w->m_sqrt_size = m_parent.m_sqrt_size;
+			w->allocate_members();
+			m_workers[thread_idx] = w;
+		}
+		const hoy &w = *m_workers[thread_idx];
+		const subproblem &sp = m_subproblems[i];
+		std::copy(sp.region_low.begin(), sp.region_low.end(), w.m_region_low);
+		std::copy(sp.region_up.begin(), sp.region_up.end(), w.m_region_up);
+		w.m_volume = 0.0;
+		w.stream(w.m_region_low, w.m_region_up, const_cast<double**>(&sp.points[0]), sp.points.size(), sp.split, sp.cover, 0);
+		m_volumes[i] = w.m_volume;
+	}
+	const hoy				&m_parent;
+	const std::vector<subproblem>		&m_subproblems;
+	std::vector<double>			&m_volumes;
+	std::vector<boost::shared_ptr<hoy> >	m_workers;
+};
+
+/// Allocate the workspace of the 'compute' method
+void hoy::allocate_members() const
+{
+	m_region_low = new double[m_dimension - 1];
+	m_region_up = new double[m_dimension - 1];
+	m_boundaries = new double[m_total_size];
+	m_no_boundaries = new double[m_total_size];
+	m_piles = new int[m_total_size];
+	m_trellis = new double[m_dimension - 1];
+}
+
+/// Free the workspace of the 'compute' method
+void hoy::free_members() const
+{
+	// free the memory for child node points
+	for (unsigned int n = 0; n < m_child_points.size() ; ++n) {
+		delete[] m_child_points[n];
+	}
+	m_child_points.clear();
+
+	delete[] m_region_low;
+	delete[] m_region_up;
+	delete[] m_boundaries;
+	delete[] m_no_boundaries;
+	delete[] m_piles;
+	delete[] m_trellis;
+}
 
 /// Compute hypervolume
 /**
@@ -52,12 +126,7 @@ double hoy::compute(std::vector<fitness_vector> &points, const fitness_vector &r
 
 	sort(points.begin(), points.end(), fitness_vector_cmp(m_dimension - 1, '<'));
 
-	m_region_low = new double[m_dimension - 1];
-	m_region_up = new double[m_dimension - 1];
-	m_boundaries = new double[m_total_size];
-	m_no_boundaries = new double[m_total_size];
-	m_piles = new int[m_total_size];
-	m_trellis = new double[m_dimension - 1];
+	allocate_members();
 
 	// initialize the D-1 dimensional region vectors and D-dimensional reference point
 	for (int i = 0 ; i < m_dimension - 1 ; ++i) {
@@ -78,14 +147,39 @@ double hoy::compute(std::vector<fitness_vector> &points, const fitness_vector &r
 		}
 	}
 
-	// call stream initially
-	stream(m_region_low, m_region_up, initial_points, m_total_size, 0, r_point[m_dimension - 1], 0);
-
-	// free the memory for child node points
-	for (unsigned int n = 0; n < m_child_points.size() ; ++n) {
-		delete[] m_child_points[n];
+	try {
+		if (!m_thread_pool) {
+			// call stream initially
+			stream(m_region_low, m_region_up, initial_points, m_total_size, 0, r_point[m_dimension - 1], 0);
+		} else {
+			const unsigned int n_threads = m_thread_pool->get_n_threads();
+			// Expand the partition tree until there are a few subproblems per thread.
+			std::vector<subproblem> subproblems;
+			m_subproblems = &subproblems;
+			m_split_level = 1;
+			while ((1u << m_split_level) < 4 * n_threads) {
+				++m_split_level;
+			}
+			stream(m_region_low, m_region_up, initial_points, m_total_size, 0, r_point[m_dimension - 1], 0);
+			m_subproblems = 0;
+			std::vector<double> volumes(subproblems.size());
+			{
+				parallel_task task(*this, subproblems, volumes, n_threads);
+				m_thread_pool->run(task, subproblems.size());
+			}
+			for (std::vector<double>::size_type i = 0 ; i < volumes.size() ; ++i) {
+				m_volume += volumes[i];
+			}
+		}
+	} catch (...) {
+		m_subproblems = 0;
+		for (int n = 0; n < m_total_size ; ++n) {
+			delete[] initial_points[n];
+		}
+		delete[] initial_points;
+		free_members();
+		throw;
 	}
-	m_child_points.clear();
 
 	// free the memory of the initial points
 	for (int n = 0; n < m_total_size ; ++n) {
@@ -94,12 +188,7 @@ double hoy::compute(std::vector<fitness_vector> &points, const fitness_vector &r
 	delete[] initial_points;
 
 	// free the member variables
-	delete[] m_region_low;
-	delete[] m_region_up;
-	delete[] m_boundaries;
-	delete[] m_no_boundaries;
-	delete[] m_piles;
-	delete[] m_trellis;
+	free_members();
 
 	return m_volume;
 }
@@ -201,6 +290,25 @@ double hoy::get_median(double* bounds, unsigned int n) const
 	return bounds[n2];
 }
 
+/// Process a child node of the partition tree.
+/**
+ * The child node is either processed recursively, or stored as a subproblem when running on multiple threads and the splitting depth was reached.
+ */
+void hoy::child_stream(double m_region_low[], double m_region_up[], double** points, const unsigned int n_points, int split, double cover, unsigned int rec_level) const
+{
+	if (m_subproblems && rec_level == m_split_level) {
+		m_subproblems->push_back(subproblem());
+		subproblem &sp = m_subproblems->back();
+		sp.region_low.assign(m_region_low, m_region_low + m_dimension - 1);
+		sp.region_up.assign(m_region_up, m_region_up + m_dimension - 1);
+		sp.points.assign(points, points + n_points);
+		sp.split = split;
+		sp.cover = cover;
+	} else {
+		stream(m_region_low, m_region_up, points, n_points, split, cover, rec_level);
+	}
+}
+
 /// Recursive calculation of the hypervolume.
 void hoy::stream(double m_region_low[], double m_region_up[], double** points, const unsigned int n_points, int split, double cover, unsigned int rec_level) const
 {
@@ -331,7 +439,7 @@ void hoy::stream(double m_region_low[], double m_region_up[], double** points, c
 			}
 		}
 		if (n_cp > 0) {
-			stream(m_region_low, m_region_up, m_child_points[rec_level], n_cp, split, cover, rec_level + 1);
+			child_stream(m_region_low, m_region_up, m_child_points[rec_level], n_cp, split, cover, rec_level + 1);
 		}
 
 		// Right child
@@ -345,7 +453,7 @@ void hoy::stream(double m_region_low[], double m_region_up[], double** points, c
 			}
 		}
 		if (n_cp > 0) {
-			stream(m_region_low, m_region_up, m_child_points[rec_level], n_cp, split, cover, rec_level + 1);
+			child_stream(m_region_low, m_region_up, m_child_points[rec_level], n_cp, split, cover, rec_level + 1);
 		}
 		m_region_low[split] = d_last;
 	}
@@ -355,12 +463,12 @@ void hoy::stream(double m_region_low[], double m_region_up[], double** points, c
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the D-dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the D-dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void hoy::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void hoy::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	base::assert_minimisation(points, r_point);
 }
@@ -377,6 +485,15 @@ std::string hoy::get_name() const
 	return "HOY algorithm";
 }
 
+/// Get the number of threads
+/**
+ * @return the number of threads of the pool created at construction (zero meaning the number of hardware threads, one meaning no pool).
+ */
+unsigned int hoy::get_n_threads() const
+{
+	return m_n_threads;
+}
+
 } } }
 
 BOOST_CLASS_EXPORT_IMPLEMENT(pagmo::util::hv_algorithm::hoy)
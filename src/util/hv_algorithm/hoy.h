@@ -49,6 +49,10 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  *  - Making it work for the negative values of the objectives
  *  - Optimization for memory allocation
  *
+ * The algorithm can run on multiple threads: the partition tree is expanded serially down to a depth providing a few subproblems per thread,
+ * and the volumes of the subproblems (i.e., of disjoint regions) are then computed in parallel, each thread using its own workspace.
+ * The partial volumes are summed in a fixed order, so that the result is reproducible for a given number of threads.
+ *
  * @see Nicola Beume and Guenter Rudolph, "Faster S-Metric Calculation by Considering Dominated Hypervolume as Klee's Measure Problem.", In: B. Kovalerchuk (ed.): Proceedings of the Second IASTED Conference on Computational Intelligence (CI 2006), pp. 231-236.  ACTA Press: Anaheim, 2006. 
  *
  * @author (original implementation) Nicola Beume
@@ -56,13 +60,29 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  */
 class __PAGMO_VISIBLE hoy : public base {
 public:
-	hoy();
+	hoy(const unsigned int n_threads = 1);
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
+	unsigned int get_n_threads() const;
 
 private:
+	// Node of the partition tree whose volume is computed by a separate task.
+	struct subproblem
+	{
+		std::vector<double>	region_low;
+		std::vector<double>	region_up;
+		std::vector<double*>	points;
+		int			split;
+		double			cover;
+	};
+	struct parallel_task;
+	friend struct parallel_task;
+
+	void allocate_members() const;
+	void free_members() const;
+	inline void child_stream(double m_region_low[], double m_region_up[], double** points, const unsigned int n_points, int split, double cover, unsigned int rec_level) const;
 	inline bool covers(const double cub[], const double reg_low[]) const;
 	inline bool part_covers(const double cub[], const double reg_up[]) const;
 	inline int contains_boundary(const double cub[], const double reg_low[], const int split) const;
@@ -87,17 +107,30 @@ private:
 	mutable double	*m_boundaries;
 	mutable double	*m_no_boundaries;
 	mutable std::vector<double**> m_child_points;
+	// Subproblems collected at depth m_split_level of the partition tree, when running on multiple threads.
+	mutable std::vector<subproblem> *m_subproblems;
+	mutable unsigned int	m_split_level;
+
+	// Number of threads of the pool created at construction
+	const unsigned int m_n_threads;
 
 	friend class boost::serialization::access;
 	template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void serialize(Archive &ar, const unsigned int version)
 	{
 		ar & boost::serialization::base_object<base>(*this);
+		if (version >= 1) {
+			ar & const_cast<unsigned int &>(m_n_threads);
+		}
+		if (Archive::is_loading::value) {
+			init_thread_pool(m_n_threads);
+		}
 	}
 };
 
 } } }
 
 BOOST_CLASS_EXPORT_KEY(pagmo::util::hv_algorithm::hoy)
+BOOST_CLASS_VERSION(pagmo::util::hv_algorithm::hoy,1)
 
 #endif
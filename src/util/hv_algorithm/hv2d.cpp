@@ -164,12 +164,12 @@ std::string hv2d::get_name() const
 /**
  * Verifies whether the requested data suits the hv2d algorithm.
  *
- * @param[in] points vector of points containing the d dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the d dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the dimension other than 3 or non-maximal reference point
  */
-void hv2d::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void hv2d::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	if (r_point.size() != 2) {
 		pagmo_throw(value_error, "Algorithm hv2d works only for 2-dimensional cases.");
@@ -49,7 +49,7 @@ public:
 	double compute(double**, unsigned int n_points, double*) const;
 	std::vector<double> contributions(std::vector<fitness_vector> &, const fitness_vector &) const;
 
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
 
@@ -276,12 +276,12 @@ std::vector<double> hv3d::contributions(std::vector<fitness_vector> &points, con
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the d dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the d dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the dimension other than 3 or non-maximal reference point
  */
-void hv3d::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void hv3d::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	if (r_point.size() != 3) {
 		pagmo_throw(value_error, "Algorithm hv3d works only for 3-dimensional cases");
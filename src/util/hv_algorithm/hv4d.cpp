@@ -23,10 +23,219 @@
  *****************************************************************************/
 
 
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include <boost/next_prior.hpp>
+
 #include "hv4d.h"
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
+// Orders the positions of points by one of their coordinates.
+struct hvc4d_coordinate_comp {
+	hvc4d_coordinate_comp(const point_matrix &points, const unsigned int d_idx) : m_points(points), m_d_idx(d_idx) { }
+	bool operator()(const unsigned int a, const unsigned int b) const
+	{
+		return m_points[a][m_d_idx] < m_points[b][m_d_idx];
+	}
+	const point_matrix	&m_points;
+	const unsigned int	m_d_idx;
+};
+
+// Sweep along the third coordinate computing the exclusive contributions of a set of 3-dimensional points, which may contain
+// dominated and duplicate points. The cross-section of the dominated region at the height of the sweep is the union of the
+// 2-dimensional boxes (quadrants) of the points inserted so far, whose exclusive areas are kept up to date:
+// - the non-dominated points of the cross-section form a staircase, sorted by x (and by decreasing y). Each of them owns the cell
+//   between itself, the next point of the staircase in x and the previous one in y, which is the region dominated by it only;
+// - a dominated point affects the exclusive areas only while a single point of the staircase dominates it: it then lies in the cell of
+//   that point, and it is kept in the staircase of the points of the cell, whose area within the cell is subtracted from the cell.
+//   A point dominated by two points when it is reached is dominated by them in three dimensions, and it is marked as discarded unless
+//   it is a duplicate of one of them, as removing it would expose the other copy.
+// Each point enters the staircase and a cell at most once, so that each insertion costs O(log n) amortised time. The volume of a point
+// is accumulated as its exclusive area times the length of the interval along which the area stayed the same.
+class hvc4d_sweep3d
+{
+	public:
+		hvc4d_sweep3d(const double rx, const double ry, std::vector<double> &c, std::vector<char> &discarded) :
+			m_rx(rx), m_ry(ry), m_c(c), m_discarded(discarded), m_area(c.size(), 0.0), m_since(c.size(), 0.0) { }
+		void insert(const unsigned int, const double, const double, const double);
+		void finish(const double);
+	private:
+		struct cell_point {
+			cell_point(const double y, const unsigned int idx) : y(y), idx(idx) { }
+			double		y;
+			unsigned int	idx;
+		};
+		// Staircase of the points dominated only by a point of the cross-section, by x.
+		typedef std::map<double, cell_point> cell_staircase;
+		struct node {
+			double		y;
+			unsigned int	idx;
+			cell_staircase	cell;
+			// Area of the union of the quadrants of the points of the cell, within the cell
+			double		covered;
+		};
+		typedef std::map<double, node> staircase;
+		double right(const staircase::iterator it) const
+		{
+			const staircase::iterator next = boost::next(it);
+			return (next == m_staircase.end()) ? m_rx : next->first;
+		}
+		double top(const staircase::iterator it) const
+		{
+			return (it == m_staircase.begin()) ? m_ry : boost::prior(it)->second.y;
+		}
+		double exclusive_area(const staircase::iterator it) const
+		{
+			return (right(it) - it->first) * (top(it) - it->second.y) - it->second.covered;
+		}
+		void set_area(const unsigned int idx, const double area, const double z)
+		{
+			m_c[idx] += m_area[idx] * (z - m_since[idx]);
+			m_area[idx] = area;
+			m_since[idx] = z;
+		}
+		bool insert_in_cell(const staircase::iterator, const unsigned int, const double, const double);
+		void clip_right(const staircase::iterator, const double, const double);
+		void clip_top(const staircase::iterator, const double, const double);
+
+		const double		m_rx;
+		const double		m_ry;
+		std::vector<double>	&m_c;
+		std::vector<char>	&m_discarded;
+		std::vector<double>	m_area;
+		std::vector<double>	m_since;
+		staircase		m_staircase;
+};
+
+// Inserts the point idx = (x, y) reached by the sweep at height z.
+void hvc4d_sweep3d::insert(const unsigned int idx, const double x, const double y, const double z)
+{
+	m_since[idx] = z;
+	const staircase::iterator after = m_staircase.upper_bound(x);
+	if (after != m_staircase.begin()) {
+		const staircase::iterator a = boost::prior(after);
+		if (a->second.y <= y) {
+			// The point is dominated by a, and it matters only if a is the only point dominating it.
+			if (a != m_staircase.begin() && boost::prior(a)->second.y <= y) {
+				m_discarded[idx] = 1;
+			} else if (insert_in_cell(a, idx, x, y)) {
+				set_area(a->second.idx, exclusive_area(a), z);
+			}
+			return;
+		}
+	}
+	// The point joins the staircase, and the points it dominates move to its cell.
+	const staircase::iterator first = m_staircase.lower_bound(x);
+	staircase::iterator last = first;
+	const double old_right = (first == m_staircase.end()) ? m_rx : first->first;
+	node n;
+	n.y = y;
+	n.idx = idx;
+	n.covered = 0.0;
+	for ( ; last != m_staircase.end() && last->second.y >= y ; ++last) {
+		set_area(last->second.idx, 0.0, z);
+		n.cell.insert(n.cell.end(), std::make_pair(last->first, cell_point(last->second.y, last->second.idx)));
+	}
+	const double old_top = (last == m_staircase.begin()) ? m_ry : boost::prior(last)->second.y;
+	m_staircase.erase(first, last);
+	const staircase::iterator it = m_staircase.insert(last, std::make_pair(x, n));
+	const double r = right(it), t = top(it);
+	for (cell_staircase::iterator c_it = it->second.cell.begin() ; c_it != it->second.cell.end() ; ++c_it) {
+		const cell_staircase::iterator c_next = boost::next(c_it);
+		it->second.covered += (((c_next == it->second.cell.end()) ? r : c_next->first) - c_it->first) * (t - c_it->second.y);
+	}
+	set_area(idx, exclusive_area(it), z);
+	// The cells of the neighbours shrink.
+	if (it != m_staircase.begin()) {
+		const staircase::iterator left = boost::prior(it);
+		clip_right(left, old_right, x);
+		set_area(left->second.idx, exclusive_area(left), z);
+	}
+	const staircase::iterator next = boost::next(it);
+	if (next != m_staircase.end()) {
+		clip_top(next, old_top, y);
+		set_area(next->second.idx, exclusive_area(next), z);
+	}
+}
+
+// Accumulates the volumes up to the height z of the reference point.
+void hvc4d_sweep3d::finish(const double z)
+{
+	for (staircase::iterator it = m_staircase.begin() ; it != m_staircase.end() ; ++it) {
+		set_area(it->second.idx, 0.0, z);
+	}
+}
+
+// Inserts the point idx = (x, y), dominated only by a, in the cell of a. Returns false if the point is dominated within the cell.
+bool hvc4d_sweep3d::insert_in_cell(const staircase::iterator a, const unsigned int idx, const double x, const double y)
+{
+	cell_staircase &cell = a->second.cell;
+	const cell_staircase::iterator after = cell.upper_bound(x);
+	if (after != cell.begin() && boost::prior(after)->second.y <= y) {
+		// A duplicate is kept, as removing it would expose the other copy.
+		const cell_staircase::iterator c = boost::prior(after);
+		m_discarded[idx] = (c->first != x || c->second.y != y);
+		return false;
+	}
+	const double r = right(a), t = top(a);
+	const cell_staircase::iterator first = cell.lower_bound(x);
+	cell_staircase::iterator last = first;
+	double covered = a->second.covered;
+	for ( ; last != cell.end() && last->second.y >= y ; ++last) {
+		const cell_staircase::iterator c_next = boost::next(last);
+		covered -= (((c_next == cell.end()) ? r : c_next->first) - last->first) * (t - last->second.y);
+	}
+	const double next_x = (last == cell.end()) ? r : last->first;
+	if (first != cell.begin()) {
+		// The left neighbour now ends at x.
+		const double old_next_x = (first == cell.end()) ? r : first->first;
+		covered -= (old_next_x - x) * (t - boost::prior(first)->second.y);
+	}
+	covered += (next_x - x) * (t - y);
+	cell.erase(first, last);
+	cell.insert(last, std::make_pair(x, cell_point(y, idx)));
+	a->second.covered = covered;
+	return true;
+}
+
+// Shrinks the cell of a from the right, from old_right to new_right.
+void hvc4d_sweep3d::clip_right(const staircase::iterator a, const double old_right, const double new_right)
+{
+	node &n = a->second;
+	cell_staircase &cell = n.cell;
+	const double t = top(a);
+	const cell_staircase::iterator first = cell.lower_bound(new_right);
+	for (cell_staircase::iterator c_it = first ; c_it != cell.end() ; ++c_it) {
+		const cell_staircase::iterator c_next = boost::next(c_it);
+		n.covered -= (((c_next == cell.end()) ? old_right : c_next->first) - c_it->first) * (t - c_it->second.y);
+	}
+	if (first != cell.begin()) {
+		const double old_next_x = (first == cell.end()) ? old_right : first->first;
+		n.covered -= (old_next_x - new_right) * (t - boost::prior(first)->second.y);
+	}
+	cell.erase(first, cell.end());
+}
+
+// Shrinks the cell of a from the top, from old_top to new_top.
+void hvc4d_sweep3d::clip_top(const staircase::iterator a, const double old_top, const double new_top)
+{
+	node &n = a->second;
+	cell_staircase &cell = n.cell;
+	const double r = right(a);
+	cell_staircase::iterator last = cell.begin();
+	for ( ; last != cell.end() && last->second.y >= new_top ; ++last) {
+		const cell_staircase::iterator c_next = boost::next(last);
+		n.covered -= (((c_next == cell.end()) ? r : c_next->first) - last->first) * (old_top - last->second.y);
+	}
+	cell.erase(cell.begin(), last);
+	if (!cell.empty()) {
+		n.covered -= (r - cell.begin()->first) * (old_top - new_top);
+	}
+}
+
 /// Compute hypervolume
 /**
  * @param[in] points vector of points containing the D-dimensional points for which we compute the hypervolume
@@ -36,34 +245,109 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  */
 double hv4d::compute(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
 {
-	// Prepare the initial data to suit the original code
-	double* data = new double[points.size() * 4];
-	double refpoint[4];
-	for (unsigned int d_idx = 0 ; d_idx < 4 ; ++d_idx) {
-		refpoint[d_idx] = r_point[d_idx];
-	}
-	unsigned int data_idx = 0;
-	for (unsigned int p_idx = 0 ; p_idx < points.size() ; ++p_idx) {
-		for (unsigned int d_idx = 0 ; d_idx < 4 ; ++d_idx) {
-			data[data_idx++] = points[p_idx][d_idx];
-		}
+	point_matrix m(points);
+	return compute(m, r_point);
+}
+
+/// Compute hypervolume
+/**
+ * The matrix has the row-major layout expected by the original code, and it is passed to it without copies.
+ *
+ * @param[in] points matrix of the 4-dimensional points for which we compute the hypervolume
+ * @param[in] r_point reference point for the points
+ *
+ * @return hypervolume.
+ */
+double hv4d::compute(point_matrix &points, const fitness_vector &r_point) const
+{
+	return guerreiro_hv4d(points.data(), points.rows(), &r_point[0]);
+}
+
+/// Contributions method
+/**
+ * Computes the exclusive contributions of all the points with a sweep along the fourth coordinate. Between two consecutive values
+ * of the fourth coordinate, the section of the exclusive region of a point is its exclusive region in three dimensions among the points
+ * reached by the sweep, hence the contribution of a point sums the exclusive volumes of its 3-dimensional projection over the slabs of the sweep.
+ * The exclusive volumes of each slab are computed exactly, dominated and duplicate points included, by a sweep along the third coordinate,
+ * in O(n log n) time, so that all the contributions are computed in O(n^2 log n) time. A point weakly dominated by another point (e.g., a duplicate)
+ * contributes nothing.
+ *
+ * @param[in] points vector of points containing the 4-dimensional points for which we compute the contributions
+ * @param[in] r_point reference point for the points
+ *
+ * @return vector of exclusive contributions by every point
+ */
+std::vector<double> hv4d::contributions(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+{
+	point_matrix m(points);
+	return contributions(m, r_point);
+}
+
+/// Contributions method
+/**
+ * @see hv4d::contributions(std::vector<fitness_vector> &, const fitness_vector &)
+ *
+ * @param[in] points matrix of the 4-dimensional points for which we compute the contributions
+ * @param[in] r_point reference point for the points
+ *
+ * @return vector of exclusive contributions by every point
+ */
+std::vector<double> hv4d::contributions(point_matrix &points, const fitness_vector &r_point) const
+{
+	const unsigned int n = points.rows();
+	std::vector<double> c(n, 0.0);
+
+	// Positions of the points along the fourth and the third coordinate
+	std::vector<unsigned int> by_w(n), by_z(n);
+	for (unsigned int i = 0 ; i < n ; ++i) {
+		by_w[i] = by_z[i] = i;
 	}
+	std::stable_sort(by_w.begin(), by_w.end(), hvc4d_coordinate_comp(points, 3));
+	std::stable_sort(by_z.begin(), by_z.end(), hvc4d_coordinate_comp(points, 2));
 
-	double hv = guerreiro_hv4d(data, points.size(), refpoint);
-	delete[] data;
-	return hv;
+	// rank[i] is the position of the point i along the fourth coordinate: the slab k contains the points of rank up to k
+	std::vector<unsigned int> rank(n);
+	for (unsigned int k = 0 ; k < n ; ++k) {
+		rank[by_w[k]] = k;
+	}
+	// The points discarded by a slab are dominated by two other points in the following slabs as well: they contribute nothing
+	// and do not change the contributions of the other points, hence they are skipped.
+	std::vector<char> discarded(n, 0);
+	std::vector<double> c3(n);
+	for (unsigned int k = 0 ; k < n ; ++k) {
+		const double width = ((k + 1 == n) ? r_point[3] : points[by_w[k + 1]][3]) - points[by_w[k]][3];
+		if (width <= 0.0) {
+			continue;
+		}
+		std::fill(c3.begin(), c3.end(), 0.0);
+		hvc4d_sweep3d sweep(r_point[0], r_point[1], c3, discarded);
+		for (unsigned int i = 0 ; i < n ; ++i) {
+			const unsigned int idx = by_z[i];
+			if (rank[idx] <= k && !discarded[idx]) {
+				sweep.insert(idx, points[idx][0], points[idx][1], points[idx][2]);
+			}
+		}
+		sweep.finish(r_point[2]);
+		for (unsigned int j = 0 ; j <= k ; ++j) {
+			c[by_w[j]] += width * c3[by_w[j]];
+		}
+	}
+	for (unsigned int i = 0 ; i < n ; ++i) {
+		c[i] = std::max(0.0, c[i]);
+	}
+	return c;
 }
 
 /// Verify before compute
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the 4-dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the 4-dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void hv4d::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void hv4d::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	if (r_point.size() != 4) {
 		pagmo_throw(value_error, "Algorithm HV4D works only for 4-dimensional cases");
@@ -47,10 +47,11 @@ namespace pagmo { namespace util { namespace hv_algorithm {
  * - name of the main method was changed from "hv4d" to "guerreiro_hv4d" in order to distinguish it from the name of this class.
  * - main method was altered to return 0 hypervolume BEFORE allocating any memory in case of an empty set of points.
  *
- * Note: As of yet, only the compute method is available.
- * This is due to the fact that the original implementation assumes certain property about the input, namely that the available set of points is a non-dominated one.
- * In order to provide accurate answers to any of the hypervolume features involving exclusive contribution by given point, we need to allow for the input to have dominated points.
- * Since this is not possible, we cannot rely on the hv4d algorithm in those cases - remaining methods, which perform "naive" implementation of said features using the "compute" method, were overloaded to raise an exception.
+ * The exclusive contributions are computed by slicing the dominated region along the fourth coordinate: between two consecutive values of it,
+ * the cross-section is the 3-dimensional region dominated by the points reached so far, and the contribution of each point in the slab is its
+ * exclusive volume within the cross-section times the width of the slab. The exclusive volumes of a slab are computed at once by a sweep along
+ * the third coordinate, which keeps the exclusive areas of the points up to date in O(log n) amortised time per point, dominated and duplicate
+ * points included. All the contributions thus cost O(n^2 log n) time, and the least and greatest contributors are found from them.
  *
  * @see Andreia P. Guerreiro, Carlos M. Fonseca, Michael T. Emmerich, "A Fast Dimension-Sweep Algorithm for the Hypervolume Indicator in Four Dimensions", CCCG 2012, Charlottetown, P.E.I., August 8–10, 2012.
  *
@@ -61,8 +62,11 @@ class __PAGMO_VISIBLE hv4d : public base
 {
 public:
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
+	double compute(point_matrix &, const fitness_vector &) const;
+	std::vector<double> contributions(std::vector<fitness_vector> &, const fitness_vector &) const;
+	std::vector<double> contributions(point_matrix &, const fitness_vector &) const;
 
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
 
@@ -25,8 +25,10 @@
 
 #include "wfg.h"
 #include "base.h"
+#include "../thread_pool.h"
 #include <algorithm>
 #include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace pagmo { namespace util { namespace hv_algorithm {
 
@@ -47,11 +49,19 @@ bool wfg::cmp_points(double* a, double* b) const
 }
 
 /// Constructor
-wfg::wfg(const unsigned int stop_dimension) : m_current_slice(0), m_stop_dimension(stop_dimension)
+/**
+ * @param[in] stop_dimension dimension at which WFG stops the slicing and switches to a dedicated algorithm.
+ * @param[in] n_threads number of threads of the pool used for the computation (see base::set_thread_pool()). If zero, the number of hardware threads
+ * available on the system will be used. If one, no pool is created.
+ *
+ * @throws value_error if stop_dimension is smaller than 2.
+ */
+wfg::wfg(const unsigned int stop_dimension, const unsigned int n_threads) : m_current_slice(0), m_stop_dimension(stop_dimension), m_n_threads(n_threads)
 {
 	if (stop_dimension < 2 ) {
 		pagmo_throw(value_error, "Stop dimension for WFG must be greater than or equal to 2");
 	}
+	init_thread_pool(n_threads);
 }
 
 /// Compute hypervolume
@@ -64,9 +74,31 @@ wfg::wfg(const unsigned int stop_dimension) : m_current_slice(0), m_stop_dimensi
  * @return hypervolume.
  */
 double wfg::compute(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+{
+	point_matrix points_m(points);
+	return compute(points_m, r_point);
+}
+
+/// Compute hypervolume
+/**
+ * Computes the hypervolume using the WFG algorithm.
+ * The coordinates are copied into the first frame of the algorithm with a single block copy.
+ *
+ * @param[in] points matrix of the D-dimensional points for which we compute the hypervolume
+ * @param[in] r_point reference point for the points
+ *
+ * @return hypervolume.
+ */
+double wfg::compute(point_matrix &points, const fitness_vector &r_point) const
 {
 	allocate_wfg_members(points, r_point);
-	double hv = compute_hv(1);
+	double hv;
+	try {
+		hv = m_thread_pool ? compute_hv_parallel() : compute_hv(1);
+	} catch (...) {
+		free_wfg_members();
+		throw;
+	}
 	free_wfg_members();
 	return hv;
 }
@@ -86,20 +118,31 @@ double wfg::compute(std::vector<fitness_vector> &points, const fitness_vector &r
  */
 std::vector<double> wfg::contributions(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
 {
+	point_matrix points_m(points);
+	return contributions(points_m, r_point);
+}
+
+/// Contributions method
+/**
+ * Computes the exclusive contributions of the points stored in a point matrix. See the overload above for the details of the algorithm.
+ *
+ * @param[in] points matrix of the D-dimensional points for which we compute the contributions
+ * @param[in] r_point reference point for the points
+ */
+std::vector<double> wfg::contributions(point_matrix &points, const fitness_vector &r_point) const
+{
+	if (m_thread_pool && points.rows() > 1) {
+		return contributions_parallel(points, r_point);
+	}
+
 	std::vector<double> c;
-	c.reserve(points.size());
+	c.reserve(points.rows());
 
 	// Allocate the same members as for 'compute' method
 	allocate_wfg_members(points, r_point);
 
 	// Prepare the memory for first front
-	double** fr = new double*[m_max_points];
-	for(unsigned int i = 0 ; i < m_max_points ; ++i) {
-		fr[i]=new double[m_current_slice];
-	}
-	m_frames[m_n_frames] = fr;
-	m_frames_size[m_n_frames] = 0;
-	++m_n_frames;
+	allocate_frame();
 
 	for(unsigned int p_idx = 0 ; p_idx < m_max_points ; ++p_idx) {
 		limitset(0, p_idx, 1);
@@ -113,9 +156,12 @@ std::vector<double> wfg::contributions(std::vector<fitness_vector> &points, cons
 }
 
 /// Allocate the memory for the 'compute' method
-void wfg::allocate_wfg_members(std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+/**
+ * Each frame is a single contiguous block of coordinates, plus an array of pointers to its rows which is the one reordered by the sorting.
+ */
+void wfg::allocate_wfg_members(const point_matrix &points, const fitness_vector &r_point) const
 {
-	m_max_points = points.size();
+	m_max_points = points.rows();
 	m_max_dim = r_point.size();
 
 	m_refpoint = new double[m_max_dim];
@@ -126,24 +172,34 @@ void wfg::allocate_wfg_members(std::vector<fitness_vector> &points, const fitnes
 	// Reserve the space beforehand for each level or recursion.
 	// WFG with slicing feature will not go recursively deeper than the dimension size.
 	m_frames = new double**[m_max_dim];
+	m_frames_storage = new double*[m_max_dim];
 	m_frames_size = new unsigned int[m_max_dim];
+	m_n_frames = 0;
 
 	// Copy the initial set into the frame at index 0.
-	double** fr = new double*[m_max_points];
-	for(unsigned int p_idx = 0 ; p_idx < m_max_points ; ++p_idx) {
-		fr[p_idx] = new double[m_max_dim];
-		for(unsigned int d_idx = 0 ; d_idx < m_max_dim ; ++d_idx) {
-			fr[p_idx][d_idx] = points[p_idx][d_idx];
-		}
-	}
-	m_frames[0] = fr;
+	m_current_slice = m_max_dim;
+	allocate_frame();
+	std::copy(points.data(), points.data() + m_max_points * m_max_dim, m_frames_storage[0]);
 	m_frames_size[0] = m_max_points;
-	m_n_frames = 1;
 
 	// Variable holding the current "depth" of dimension slicing. We progress by slicing dimensions from the end.
 	m_current_slice = m_max_dim;
 }
 
+/// Allocate the frame for the next level of recursion, holding points of dimension m_current_slice
+void wfg::allocate_frame() const
+{
+	double** fr = new double*[m_max_points];
+	double* block = new double[m_max_points * m_current_slice];
+	for(unsigned int i = 0 ; i < m_max_points ; ++i) {
+		fr[i] = block + i * m_current_slice;
+	}
+	m_frames[m_n_frames] = fr;
+	m_frames_storage[m_n_frames] = block;
+	m_frames_size[m_n_frames] = 0;
+	++m_n_frames;
+}
+
 /// Free the previously allocated memory
 void wfg::free_wfg_members() const
 {
@@ -151,12 +207,11 @@ void wfg::free_wfg_members() const
 	delete[] m_refpoint;
 
 	for(unsigned int fr_idx = 0 ; fr_idx < m_n_frames ; ++fr_idx) {
-		for(unsigned int p_idx = 0; p_idx < m_max_points ; ++p_idx) {
-			delete[] m_frames[fr_idx][p_idx];
-		}
+		delete[] m_frames_storage[fr_idx];
 		delete[] m_frames[fr_idx];
 	}
 	delete[] m_frames;
+	delete[] m_frames_storage;
 	delete[] m_frames_size;
 }
 
@@ -250,10 +305,9 @@ double wfg::compute_hv(const unsigned int rec_level) const
 			return hv2d().compute(points, n_points, m_refpoint);
 		} else {
 			// Let hypervolume object pick the best method otherwise.
-			std::vector<fitness_vector> points_cpy;
-			points_cpy.reserve(n_points);
+			point_matrix points_cpy(n_points, m_current_slice);
 			for(unsigned int i = 0 ; i < n_points ; ++i) {
-				points_cpy.push_back(fitness_vector(points[i], points[i] + m_current_slice));
+				std::copy(points[i], points[i] + m_current_slice, points_cpy[i]);
 			}
 			fitness_vector r_cpy(m_refpoint, m_refpoint + m_current_slice);
 
@@ -272,13 +326,7 @@ double wfg::compute_hv(const unsigned int rec_level) const
 	--m_current_slice;
 
 	if(rec_level >= m_n_frames) {
-		double** fr = new double*[m_max_points];
-		for(unsigned int i = 0 ; i < m_max_points ; ++i) {
-			fr[i]=new double[m_current_slice];
-		}
-		m_frames[m_n_frames] = fr;
-		m_frames_size[m_n_frames] = 0;
-		++m_n_frames;
+		allocate_frame();
 	}
 
 	for(unsigned int p_idx = 0 ; p_idx < n_points ; ++p_idx) {
@@ -305,16 +353,105 @@ double wfg::exclusive_hv(const unsigned int p_idx, const unsigned int rec_level)
 	return H;
 }
 
+/// Thread pool job for the parallel methods
+/**
+ * Each worker thread lazily creates its own copy of the WFG workspace, holding the point set of the first frame, the first level of recursion
+ * being the one at which the tasks are split. The i-th task computes either the i-th term of the first level of the recursion of 'compute_hv'
+ * (the exclusive volume of the i-th point with respect to the following ones), or the exclusive contribution of the i-th point to the whole set.
+ */
+struct wfg::parallel_task : thread_pool::task
+{
+	parallel_task(const wfg &parent, const point_matrix &points, const fitness_vector &r_point, std::vector<double> &results,
+		bool contributions, unsigned int n_threads) :
+		m_parent(parent), m_points(points), m_r_point(r_point), m_results(results), m_contributions(contributions), m_workers(n_threads) { }
+	~parallel_task()
+	{
+		for (std::vector<boost::shared_ptr<wfg> >::size_type i = 0; i < m_workers.size(); ++i) {
+			if (m_workers[i]) {
+				m_workers[i]->free_wfg_members();
+			}
+		}
+	}
+	void operator()(unsigned int thread_idx, std::size_t i)
+	{
+		if (!m_workers[thread_idx]) {
+			boost::shared_ptr<wfg> w(new wfg(m_parent.m_stop_dimension));
+			w->allocate_wfg_members(m_points, m_r_point);
+			m_workers[thread_idx] = w;
+			if (!m_contributions) {
+				--w->m_current_slice;
+			}
+			w->allocate_frame();
+		}
+		const wfg &w = *m_workers[thread_idx];
+		const unsigned int p_idx = static_cast<unsigned int>(i);
+		if (m_contributions) {
+			w.limitset(0, p_idx, 1);
+			m_results[i] = w.exclusive_hv(p_idx, 1);
+		} else {
+			w.limitset(p_idx + 1, p_idx, 1);
+			m_results[i] = fabs((w.m_frames[0][p_idx][w.m_current_slice] - w.m_refpoint[w.m_current_slice]) * w.exclusive_hv(p_idx, 1));
+		}
+	}
+	const wfg				&m_parent;
+	const point_matrix			&m_points;
+	const fitness_vector			&m_r_point;
+	std::vector<double>			&m_results;
+	const bool				m_contributions;
+	std::vector<boost::shared_ptr<wfg> >	m_workers;
+};
+
+/// Compute the hypervolume in parallel
+/**
+ * Parallel version of compute_hv(1): the points of the first frame are sorted, and the terms of the first level of the recursion are computed by the thread pool.
+ */
+double wfg::compute_hv_parallel() const
+{
+	double **points = m_frames[0];
+	const unsigned int n_points = m_frames_size[0];
+
+	// Small sets, or sets handled directly by another algorithm, are computed serially.
+	if (n_points <= 2 || m_current_slice == m_stop_dimension) {
+		return compute_hv(1);
+	}
+	std::sort(points, points + n_points, boost::bind(&wfg::cmp_points, this, _1, _2));
+
+	point_matrix sorted(n_points, m_max_dim);
+	for(unsigned int i = 0 ; i < n_points ; ++i) {
+		std::copy(points[i], points[i] + m_max_dim, sorted[i]);
+	}
+	const fitness_vector r_point(m_refpoint, m_refpoint + m_max_dim);
+	std::vector<double> terms(n_points);
+	{
+		parallel_task task(*this, sorted, r_point, terms, false, m_thread_pool->get_n_threads());
+		m_thread_pool->run(task, n_points);
+	}
+	double H = 0.0;
+	for(unsigned int i = 0 ; i < n_points ; ++i) {
+		H += terms[i];
+	}
+	return H;
+}
+
+/// Compute the exclusive contributions in parallel
+std::vector<double> wfg::contributions_parallel(const point_matrix &points, const fitness_vector &r_point) const
+{
+	std::vector<double> c(points.rows());
+	parallel_task task(*this, points, r_point, c, true, m_thread_pool->get_n_threads());
+	m_thread_pool->run(task, points.rows());
+	return c;
+}
+
 /// Verify before compute method
 /**
  * Verifies whether given algorithm suits the requested data.
  *
- * @param[in] points vector of points containing the D-dimensional points for which we compute the hypervolume
+ * @param[in] points matrix of points containing the D-dimensional points for which we compute the hypervolume
  * @param[in] r_point reference point for the vector of points
  *
  * @throws value_error when trying to compute the hypervolume for the non-maximal reference point
  */
-void wfg::verify_before_compute(const std::vector<fitness_vector> &points, const fitness_vector &r_point) const
+void wfg::verify_before_compute(const point_matrix &points, const fitness_vector &r_point) const
 {
 	base::assert_minimisation(points, r_point);
 }
@@ -331,6 +468,15 @@ std::string wfg::get_name() const
 	return "WFG algorithm";
 }
 
+/// Get the number of threads
+/**
+ * @return the number of threads of the pool created at construction (zero meaning the number of hardware threads, one meaning no pool).
+ */
+unsigned int wfg::get_n_threads() const
+{
+	return m_n_threads;
+}
+
 } } }
 
 BOOST_CLASS_EXPORT_IMPLEMENT(pagmo::util::hv_algorithm::wfg)
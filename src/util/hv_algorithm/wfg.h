@@ -40,6 +40,11 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 /**
  * This is the class containing the implementation of the WFG algorithm for the computation of hypervolume indicator.
  *
+ * The algorithm can run on multiple threads. In the 'compute' method the exclusive volumes of the points at the first level of the recursion
+ * (each computed recursively on its own limited set) are independent tasks, and in the 'contributions' method the exclusive contribution
+ * of each point is an independent task. Each thread works on a private copy of the point set, and the partial volumes are summed in
+ * the same order as in the serial algorithm, so that the result does not depend on the number of threads.
+ *
  * @see "While, Lyndon, Lucas Bradstreet, and Luigi Barone. "A fast way of calculating exact hypervolumes." Evolutionary Computation, IEEE Transactions on 16.1 (2012): 86-95."
  * @see "Lyndon While and Lucas Bradstreet. Applying the WFG Algorithm To Calculate Incremental Hypervolumes. 2012 IEEE Congress on Evolutionary Computation. CEC 2012, pages 489-496. IEEE, June 2012."
  *
@@ -48,21 +53,30 @@ namespace pagmo { namespace util { namespace hv_algorithm {
 class __PAGMO_VISIBLE wfg : public base
 {
 public:
-	wfg(const unsigned int stop_dimension = 2);
+	wfg(const unsigned int stop_dimension = 2, const unsigned int n_threads = 1);
 	double compute(std::vector<fitness_vector> &, const fitness_vector &) const;
+	double compute(point_matrix &, const fitness_vector &) const;
 	std::vector<double> contributions(std::vector<fitness_vector> &, const fitness_vector &) const;
-	void verify_before_compute(const std::vector<fitness_vector> &, const fitness_vector &) const;
+	std::vector<double> contributions(point_matrix &, const fitness_vector &) const;
+	void verify_before_compute(const point_matrix &, const fitness_vector &) const;
 	base_ptr clone() const;
 	std::string get_name() const;
+	unsigned int get_n_threads() const;
 
 private:
+	struct parallel_task;
+	friend struct parallel_task;
+
 	void limitset(const unsigned int, const unsigned int, const unsigned int) const;
 	double exclusive_hv(const unsigned int, const unsigned int) const;
 	double compute_hv(const unsigned int) const;
+	double compute_hv_parallel() const;
+	std::vector<double> contributions_parallel(const point_matrix &, const fitness_vector &) const;
 
 	bool cmp_points(double* a, double* b) const;
 
-	void allocate_wfg_members(std::vector<fitness_vector> &, const fitness_vector &) const;
+	void allocate_wfg_members(const point_matrix &, const fitness_vector &) const;
+	void allocate_frame() const;
 	void free_wfg_members() const;
 
 	/**
@@ -79,6 +93,9 @@ private:
 	// Array of point sets for each recursive level.
 	mutable double*** m_frames;
 
+	// Contiguous block of coordinates backing each frame.
+	mutable double** m_frames_storage;
+
 	// Maintains the number of points at given recursion level.
 	mutable unsigned int* m_frames_size;
 
@@ -100,17 +117,27 @@ private:
 	// Dimension at which WFG stops the slicing
 	const unsigned int m_stop_dimension;
 
+	// Number of threads of the pool created at construction
+	const unsigned int m_n_threads;
+
 	friend class boost::serialization::access;
 	template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void serialize(Archive &ar, const unsigned int version)
 	{
 		ar & boost::serialization::base_object<base>(*this);
 		ar & const_cast<unsigned int &>(m_stop_dimension);
+		if (version >= 1) {
+			ar & const_cast<unsigned int &>(m_n_threads);
+		}
+		if (Archive::is_loading::value) {
+			init_thread_pool(m_n_threads);
+		}
 	}
 };
 
 } } }
 
 BOOST_CLASS_EXPORT_KEY(pagmo::util::hv_algorithm::wfg)
+BOOST_CLASS_VERSION(pagmo::util::hv_algorithm::wfg,1)
 
 #endif
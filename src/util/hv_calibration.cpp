@@ -0,0 +1,254 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../exceptions.h"
+#include "hv_calibration.h"
+#include "hv_algorithm/base.h"
+#include "hv_algorithm/hv2d.h"
+#include "hv_algorithm/hv3d.h"
+#include "hv_algorithm/hv4d.h"
+#include "hv_algorithm/wfg.h"
+#include "hv_algorithm/hoy.h"
+#include "hv_algorithm/fpl.h"
+
+namespace pagmo { namespace util {
+
+/// Add an entry.
+/**
+ * Adds an entry to the table, replacing the entry with the same method, dimension and maximum number of points if present.
+ *
+ * @param[in] method method the entry applies to
+ * @param[in] f_dim dimension of the front
+ * @param[in] n_max maximum number of points, zero for no upper bound
+ * @param[in] algorithm name of the algorithm, as accepted by hv_calibration::make_algorithm
+ *
+ * @throws value_error if the algorithm is unknown, approximate, or cannot handle fronts of the given dimension
+ */
+void hv_calibration::add(const method_type method, const unsigned int f_dim, const unsigned int n_max, const std::string &algorithm)
+{
+	if (method != COMPUTE && method != CONTRIBUTIONS) {
+		pagmo_throw(value_error, "unknown calibration method");
+	}
+	if (f_dim < 2) {
+		pagmo_throw(value_error, "the dimension of a calibration entry must be at least 2");
+	}
+	if ((algorithm == "hv2d" && f_dim != 2) || (algorithm == "hv3d" && f_dim != 3) || (algorithm == "hv4d" && f_dim != 4)) {
+		pagmo_throw(value_error, "algorithm " + algorithm + " cannot handle fronts of the given dimension");
+	}
+	// throws on unknown names
+	make_algorithm(algorithm);
+
+	entry e;
+	e.method = method;
+	e.f_dim = f_dim;
+	e.n_max = n_max;
+	e.algorithm = algorithm;
+	std::vector<entry>::iterator it = std::lower_bound(m_entries.begin(), m_entries.end(), e, entry_less);
+	if (it != m_entries.end() && !entry_less(e, *it)) {
+		it->algorithm = algorithm;
+	} else {
+		m_entries.insert(it, e);
+	}
+}
+
+/// Select an algorithm.
+/**
+ * @param[in] method method of the computation
+ * @param[in] f_dim dimension of the front
+ * @param[in] n number of points of the front
+ *
+ * @return name of the algorithm of the entry with the smallest maximum number of points not below n,
+ * or an empty string if no entry covers the given method, dimension and number of points
+ */
+std::string hv_calibration::select(const method_type method, const unsigned int f_dim, const unsigned int n) const
+{
+	for (std::vector<entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+		if (it->method == method && it->f_dim == f_dim && (it->n_max == 0 || n <= it->n_max)) {
+			return it->algorithm;
+		}
+	}
+	return std::string();
+}
+
+/// Get the entries of the table.
+/**
+ * @return entries sorted by method, dimension and maximum number of points (entries without upper bound last)
+ */
+const std::vector<hv_calibration::entry> &hv_calibration::get_entries() const
+{
+	return m_entries;
+}
+
+/// Check whether the table has no entries.
+bool hv_calibration::empty() const
+{
+	return m_entries.empty();
+}
+
+/// Remove all entries.
+void hv_calibration::clear()
+{
+	m_entries.clear();
+}
+
+/// Load entries from a stream.
+/**
+ * Reads the textual form of the table (see the description of the class) and adds its entries to the table.
+ * The table is left untouched if the input is not valid.
+ *
+ * @param[in] is input stream
+ *
+ * @throws value_error if a line cannot be parsed or contains an invalid entry
+ */
+void hv_calibration::load(std::istream &is)
+{
+	hv_calibration tmp(*this);
+	std::string line;
+	unsigned int line_no = 0;
+	while (std::getline(is, line)) {
+		++line_no;
+		std::istringstream ls(line);
+		std::string method;
+		if (!(ls >> method) || method[0] == '#') {
+			continue;
+		}
+		unsigned int f_dim, n_max;
+		std::string algorithm, rest;
+		if (!(ls >> f_dim >> n_max >> algorithm) || (ls >> rest)) {
+			std::ostringstream oss;
+			oss << "cannot parse line " << line_no << " of the calibration table";
+			pagmo_throw(value_error, oss.str());
+		}
+		if (method == method_name(COMPUTE)) {
+			tmp.add(COMPUTE, f_dim, n_max, algorithm);
+		} else if (method == method_name(CONTRIBUTIONS)) {
+			tmp.add(CONTRIBUTIONS, f_dim, n_max, algorithm);
+		} else {
+			pagmo_throw(value_error, "unknown calibration method " + method);
+		}
+	}
+	m_entries.swap(tmp.m_entries);
+}
+
+/// Load entries from a file.
+/**
+ * @param[in] filename name of the file
+ *
+ * @throws value_error if the file cannot be opened or is not valid
+ */
+void hv_calibration::load(const std::string &filename)
+{
+	std::ifstream ifs(filename.c_str());
+	if (!ifs) {
+		pagmo_throw(value_error, "cannot open calibration file " + filename);
+	}
+	load(ifs);
+}
+
+/// Save the table to a stream.
+/**
+ * @param[out] os output stream
+ */
+void hv_calibration::save(std::ostream &os) const
+{
+	os << "# method f_dim n_max algorithm\n";
+	for (std::vector<entry>::const_iterator it = m_entries.begin(); it != m_entries.end(); ++it) {
+		os << method_name(it->method) << ' ' << it->f_dim << ' ' << it->n_max << ' ' << it->algorithm << '\n';
+	}
+}
+
+/// Save the table to a file.
+/**
+ * @param[in] filename name of the file
+ *
+ * @throws value_error if the file cannot be written
+ */
+void hv_calibration::save(const std::string &filename) const
+{
+	std::ofstream ofs(filename.c_str());
+	if (!ofs) {
+		pagmo_throw(value_error, "cannot write calibration file " + filename);
+	}
+	save(ofs);
+}
+
+/// Build an algorithm from its name.
+/**
+ * Only the exact algorithms can be built: hv2d, hv3d, hv4d, fpl, wfg and hoy. Each is built with its default parameters.
+ *
+ * @param[in] name name of the algorithm
+ *
+ * @return pointer to a new instance of the algorithm
+ *
+ * @throws value_error if the name is not the one of an exact algorithm
+ */
+hv_algorithm::base_ptr hv_calibration::make_algorithm(const std::string &name)
+{
+	if (name == "hv2d") {
+		return hv_algorithm::hv2d().clone();
+	} else if (name == "hv3d") {
+		return hv_algorithm::hv3d().clone();
+	} else if (name == "hv4d") {
+		return hv_algorithm::hv4d().clone();
+	} else if (name == "fpl") {
+		return hv_algorithm::fpl().clone();
+	} else if (name == "wfg") {
+		return hv_algorithm::wfg().clone();
+	} else if (name == "hoy") {
+		return hv_algorithm::hoy().clone();
+	}
+	pagmo_throw(value_error, "unknown exact hypervolume algorithm " + name);
+}
+
+/// Name of a method.
+/**
+ * @param[in] method method
+ *
+ * @return name of the method as used in the textual form of the table
+ */
+std::string hv_calibration::method_name(const method_type method)
+{
+	return method == COMPUTE ? "compute" : "contributions";
+}
+
+// Order of the entries: by method, by dimension and by number of points, entries without upper bound last.
+bool hv_calibration::entry_less(const entry &a, const entry &b)
+{
+	if (a.method != b.method) {
+		return a.method < b.method;
+	}
+	if (a.f_dim != b.f_dim) {
+		return a.f_dim < b.f_dim;
+	}
+	// unsigned wrap-around puts n_max == 0 last
+	return a.n_max - 1u < b.n_max - 1u;
+}
+
+} }
@@ -0,0 +1,104 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#ifndef PAGMO_UTIL_HV_CALIBRATION_H
+#define PAGMO_UTIL_HV_CALIBRATION_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../config.h"
+#include "hv_algorithm/base.h"
+
+namespace pagmo { namespace util {
+
+/// Calibration table of the hypervolume algorithms.
+/**
+ * This class maps a problem size to the name of the exact hypervolume algorithm that should be used to solve it. It is used by
+ * pagmo::util::hypervolume to choose an algorithm when none is provided by the user (see hypervolume::set_calibration).
+ *
+ * Each entry of the table is a tuple (method, f_dim, n_max, algorithm), meaning that the given algorithm is to be used for
+ * the given method (hv_calibration::COMPUTE, or hv_calibration::CONTRIBUTIONS for the least, greatest and all contributions)
+ * on fronts of dimension f_dim with at most n_max points. An n_max of zero means no upper bound.
+ * For a given method and dimension, the entry with the smallest n_max not below the number of points is selected.
+ *
+ * The textual form of the table, as read by hv_calibration::load and written by hv_calibration::save, is one entry per line:
+ *
+ * @verbatim
+# method f_dim n_max algorithm
+compute 5 80 fpl
+compute 5 0 wfg
+contributions 4 0 wfg
+@endverbatim
+ *
+ * Empty lines and lines starting with '#' are ignored. Such a file can be generated by the hypervolume_benchmark program.
+ */
+class __PAGMO_VISIBLE hv_calibration
+{
+	public:
+		/// Method of the hypervolume computation an entry applies to.
+		enum method_type {
+			/// Computation of the hypervolume and of an exclusive contribution.
+			COMPUTE = 0,
+			/// Computation of the least, greatest and all contributions.
+			CONTRIBUTIONS = 1
+		};
+
+		/// Entry of the calibration table.
+		struct entry {
+			/// Method the entry applies to.
+			method_type method;
+			/// Dimension of the front.
+			unsigned int f_dim;
+			/// Maximum number of points (zero for no upper bound).
+			unsigned int n_max;
+			/// Name of the algorithm.
+			std::string algorithm;
+		};
+
+		void add(const method_type, const unsigned int, const unsigned int, const std::string &);
+		std::string select(const method_type, const unsigned int, const unsigned int) const;
+		const std::vector<entry> &get_entries() const;
+		bool empty() const;
+		void clear();
+
+		void load(std::istream &);
+		void load(const std::string &);
+		void save(std::ostream &) const;
+		void save(const std::string &) const;
+
+		static hv_algorithm::base_ptr make_algorithm(const std::string &);
+		static std::string method_name(const method_type);
+
+	private:
+		static bool entry_less(const entry &, const entry &);
+
+		// entries sorted by method, dimension and number of points
+		std::vector<entry> m_entries;
+};
+
+} }
+
+#endif
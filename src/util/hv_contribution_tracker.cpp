@@ -0,0 +1,590 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../exceptions.h"
+#include "../types.h"
+#include "hv_algorithm/base.h"
+#include "hv_algorithm/hv4d.h"
+#include "hv_algorithm/wfg.h"
+#include "hv_contribution_tracker.h"
+
+namespace pagmo { namespace util {
+
+// Check whether a weakly dominates b.
+static bool weakly_dominates(const fitness_vector &a, const fitness_vector &b)
+{
+	for (fitness_vector::size_type i = 0; i < a.size(); ++i) {
+		if (a[i] > b[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Algorithm used for the hypervolumes of the limited sets in more than 3 dimensions.
+static hv_algorithm::base_ptr nd_algorithm(const fitness_vector::size_type f_dim)
+{
+	if (f_dim == 4) {
+		return hv_algorithm::hv4d().clone();
+	}
+	return hv_algorithm::wfg().clone();
+}
+
+/// Constructor from reference point.
+/**
+ * Will build an empty tracker.
+ *
+ * @param[in] r_point reference point.
+ *
+ * @throws value_error if the dimension of the reference point is less than 2.
+ */
+hv_contribution_tracker::hv_contribution_tracker(const fitness_vector &r_point):m_r_point(r_point)
+{
+	if (r_point.size() < 2) {
+		pagmo_throw(value_error,"the dimension of the reference point must be at least 2");
+	}
+	if (r_point.size() > 3) {
+		m_hv_algorithm = nd_algorithm(r_point.size());
+	}
+}
+
+/// Constructor from points and reference point.
+/**
+ * Will build a tracker containing the input points. The id of each point will be its position in the input vector.
+ * In more than 3 dimensions the initial contributions are computed in a single pass with the contributions() method of hv_algorithm::hv4d
+ * (in 4 dimensions) or hv_algorithm::wfg.
+ *
+ * @param[in] points mutually non-dominated points.
+ * @param[in] r_point reference point.
+ *
+ * @throws value_error if the dimension of the reference point is less than 2, or if the points are not
+ * mutually non-dominated or do not dominate the reference point.
+ */
+hv_contribution_tracker::hv_contribution_tracker(const std::vector<fitness_vector> &points, const fitness_vector &r_point):m_r_point(r_point)
+{
+	if (r_point.size() < 2) {
+		pagmo_throw(value_error,"the dimension of the reference point must be at least 2");
+	}
+	if (r_point.size() <= 3) {
+		for (std::vector<fitness_vector>::size_type i = 0; i < points.size(); ++i) {
+			check_point(points[i]);
+			m_points.push_back(points[i]);
+			m_alive.push_back(1);
+			m_sweep_pos.push_back(m_sweep.insert(std::make_pair(points[i][(r_point.size() == 2) ? 0 : 2],i)));
+		}
+		m_contributions.resize(m_points.size());
+		if (r_point.size() == 2) {
+			check_sweep_2d();
+		}
+		for (id_type i = 0; i < m_points.size(); ++i) {
+			if (r_point.size() == 2) {
+				update_2d(m_sweep_pos[i]);
+			} else {
+				set_contribution(i,exclusive_3d(i));
+			}
+		}
+		return;
+	}
+	m_hv_algorithm = nd_algorithm(r_point.size());
+	for (std::vector<fitness_vector>::size_type i = 0; i < points.size(); ++i) {
+		check_point(points[i]);
+		m_points.push_back(points[i]);
+		m_alive.push_back(1);
+	}
+	m_contributions.resize(m_points.size());
+	// WFG does not cope with duplicate points in the computation of the contributions, HV4D does.
+	std::vector<fitness_vector> sorted(m_points);
+	std::sort(sorted.begin(),sorted.end());
+	if (m_points.size() > 1 && (r_point.size() == 4 || std::adjacent_find(sorted.begin(),sorted.end()) == sorted.end())) {
+		std::vector<fitness_vector> tmp(m_points);
+		m_contributions = m_hv_algorithm->contributions(tmp,m_r_point);
+	} else {
+		for (id_type i = 0; i < m_points.size(); ++i) {
+			m_contributions[i] = exclusive_nd(i);
+		}
+	}
+	for (id_type i = 0; i < m_points.size(); ++i) {
+		m_order.insert(std::make_pair(m_contributions[i],i));
+	}
+}
+
+/// Insert point.
+/**
+ * The contributions of the points affected by the insertion are updated.
+ *
+ * @param[in] point point to be inserted.
+ *
+ * @return the id of the inserted point.
+ *
+ * @throws value_error if the point does not dominate the reference point, or if it dominates or is dominated
+ * by a point of the set.
+ */
+hv_contribution_tracker::id_type hv_contribution_tracker::insert(const fitness_vector &point)
+{
+	check_point(point);
+	id_type id;
+	if (m_free.empty()) {
+		id = m_points.size();
+		m_points.push_back(point);
+		m_contributions.push_back(0.);
+		m_alive.push_back(1);
+		m_sweep_pos.push_back(m_sweep.end());
+	} else {
+		id = m_free.back();
+		m_free.pop_back();
+		m_points[id] = point;
+		m_alive[id] = 1;
+	}
+	if (m_r_point.size() == 2) {
+		insert_2d(id);
+	} else {
+		if (m_r_point.size() == 3) {
+			m_sweep_pos[id] = m_sweep.insert(std::make_pair(point[2],id));
+		}
+		set_contribution(id,update(id));
+	}
+	return id;
+}
+
+/// Remove point.
+/**
+ * The contributions of the points affected by the removal are updated.
+ *
+ * @param[in] id id of the point to be removed.
+ *
+ * @throws index_error if id does not refer to a point of the set.
+ */
+void hv_contribution_tracker::erase(id_type id)
+{
+	check_id(id);
+	m_order.erase(std::make_pair(m_contributions[id],id));
+	m_alive[id] = 0;
+	m_free.push_back(id);
+	if (m_r_point.size() == 2) {
+		erase_2d(id);
+	} else {
+		if (m_r_point.size() == 3) {
+			m_sweep.erase(m_sweep_pos[id]);
+			m_sweep_pos[id] = m_sweep.end();
+		}
+		update(id);
+	}
+}
+
+/// Number of points.
+/**
+ * @return the number of points in the set.
+ */
+hv_contribution_tracker::size_type hv_contribution_tracker::size() const
+{
+	return m_order.size();
+}
+
+/// Check whether the set is empty.
+/**
+ * @return true if the set contains no points, false otherwise.
+ */
+bool hv_contribution_tracker::empty() const
+{
+	return m_order.empty();
+}
+
+/// Get reference point.
+/**
+ * @return const reference to the reference point.
+ */
+const fitness_vector &hv_contribution_tracker::get_reference_point() const
+{
+	return m_r_point;
+}
+
+/// Get point.
+/**
+ * @param[in] id id of the point.
+ *
+ * @return const reference to the point.
+ *
+ * @throws index_error if id does not refer to a point of the set.
+ */
+const fitness_vector &hv_contribution_tracker::get_point(id_type id) const
+{
+	check_id(id);
+	return m_points[id];
+}
+
+/// Get exclusive contribution.
+/**
+ * @param[in] id id of the point.
+ *
+ * @return the exclusive hypervolume contribution of the point.
+ *
+ * @throws index_error if id does not refer to a point of the set.
+ */
+double hv_contribution_tracker::contribution(id_type id) const
+{
+	check_id(id);
+	return m_contributions[id];
+}
+
+/// Find the least contributor.
+/**
+ * Ties are broken in favour of the smallest id.
+ *
+ * @return the id of the point contributing the least to the hypervolume.
+ *
+ * @throws value_error if the set is empty.
+ */
+hv_contribution_tracker::id_type hv_contribution_tracker::least_contributor() const
+{
+	if (m_order.empty()) {
+		pagmo_throw(value_error,"the set of points is empty");
+	}
+	return m_order.begin()->second;
+}
+
+/// Find the greatest contributor.
+/**
+ * Ties are broken in favour of the greatest id.
+ *
+ * @return the id of the point contributing the most to the hypervolume.
+ *
+ * @throws value_error if the set is empty.
+ */
+hv_contribution_tracker::id_type hv_contribution_tracker::greatest_contributor() const
+{
+	if (m_order.empty()) {
+		pagmo_throw(value_error,"the set of points is empty");
+	}
+	return m_order.rbegin()->second;
+}
+
+void hv_contribution_tracker::check_id(id_type id) const
+{
+	if (id >= m_points.size() || !m_alive[id]) {
+		pagmo_throw(index_error,"invalid point id");
+	}
+}
+
+// Check that the point can be added to the set. In the 2-dimensional case domination is checked against the neighbours
+// in insert_2d().
+void hv_contribution_tracker::check_point(const fitness_vector &point) const
+{
+	if (point.size() != m_r_point.size()) {
+		pagmo_throw(value_error,"the dimension of the point must be equal to the dimension of the reference point");
+	}
+	if (!weakly_dominates(point,m_r_point)) {
+		pagmo_throw(value_error,"the point must dominate the reference point");
+	}
+	if (m_r_point.size() == 2) {
+		return;
+	}
+	for (id_type i = 0; i < m_points.size(); ++i) {
+		if (m_alive[i] && m_points[i] != point && (weakly_dominates(m_points[i],point) || weakly_dominates(point,m_points[i]))) {
+			pagmo_throw(value_error,"the points must be mutually non-dominated");
+		}
+	}
+}
+
+void hv_contribution_tracker::set_contribution(id_type id, double c)
+{
+	m_order.erase(std::make_pair(m_contributions[id],id));
+	m_contributions[id] = c;
+	m_order.insert(std::make_pair(c,id));
+}
+
+// In the 2-dimensional case the points are sorted by increasing first objective, and hence by decreasing second objective.
+// The contribution of each point is the rectangle delimited by its neighbours.
+void hv_contribution_tracker::insert_2d(id_type id)
+{
+	const fitness_vector &p = m_points[id];
+	const sweep_type::iterator it = m_sweep.insert(std::make_pair(p[0],id));
+	sweep_type::iterator prev = it, next = it;
+	++next;
+	const bool has_prev = (it != m_sweep.begin()), has_next = (next != m_sweep.end());
+	if (has_prev) {
+		--prev;
+	}
+	if ((has_prev && !ordered_2d(m_points[prev->second],p)) || (has_next && !ordered_2d(p,m_points[next->second]))) {
+		m_sweep.erase(it);
+		m_alive[id] = 0;
+		m_free.push_back(id);
+		pagmo_throw(value_error,"the points must be mutually non-dominated");
+	}
+	m_sweep_pos[id] = it;
+	m_contributions[id] = 0.;
+	m_order.insert(std::make_pair(0.,id));
+	update_2d(it);
+	if (has_prev) {
+		update_2d(prev);
+	}
+	if (has_next) {
+		update_2d(next);
+	}
+}
+
+// Check that two consecutive points of the sweep are not dominating each other: the first one must be above the second one,
+// unless they are equal. Distinct points with the same first objective always dominate each other.
+bool hv_contribution_tracker::ordered_2d(const fitness_vector &a, const fitness_vector &b)
+{
+	return a == b || (a[0] != b[0] && a[1] > b[1]);
+}
+
+void hv_contribution_tracker::check_sweep_2d() const
+{
+	sweep_type::const_iterator it = m_sweep.begin(), next = m_sweep.begin();
+	for (++next; next != m_sweep.end(); ++it, ++next) {
+		if (!ordered_2d(m_points[it->second],m_points[next->second])) {
+			pagmo_throw(value_error,"the points must be mutually non-dominated");
+		}
+	}
+}
+
+void hv_contribution_tracker::erase_2d(id_type id)
+{
+	sweep_type::iterator next = m_sweep_pos[id], prev = m_sweep_pos[id];
+	++next;
+	const bool has_prev = (prev != m_sweep.begin());
+	if (has_prev) {
+		--prev;
+	}
+	m_sweep.erase(m_sweep_pos[id]);
+	m_sweep_pos[id] = m_sweep.end();
+	if (has_prev) {
+		update_2d(prev);
+	}
+	if (next != m_sweep.end()) {
+		update_2d(next);
+	}
+}
+
+void hv_contribution_tracker::update_2d(sweep_type::iterator it)
+{
+	const fitness_vector &p = m_points[it->second];
+	sweep_type::iterator next = it;
+	++next;
+	const double x = (next == m_sweep.end()) ? m_r_point[0] : m_points[next->second][0];
+	double y = m_r_point[1];
+	if (it != m_sweep.begin()) {
+		sweep_type::iterator prev = it;
+		--prev;
+		y = m_points[prev->second][1];
+	}
+	set_contribution(it->second,(x - p[0]) * (y - p[1]));
+}
+
+// Recompute the contributions of the points affected by the insertion or removal of the point p, and return the
+// contribution of p with respect to the other points of the set. The contribution of a point q can change only if the
+// component-wise maximum of p and q is not weakly dominated by another point of the set, i.e., if it is a non-dominated point
+// of the set limited by p. These points are found while computing the contribution of p.
+double hv_contribution_tracker::update(id_type p)
+{
+	std::vector<id_type> affected;
+	const double retval = (m_r_point.size() == 3) ? exclusive_3d(p,&affected) : exclusive_nd(p,&affected);
+	for (std::vector<id_type>::size_type i = 0; i < affected.size(); ++i) {
+		set_contribution(affected[i],(m_r_point.size() == 3) ? exclusive_3d(affected[i]) : exclusive_nd(affected[i]));
+	}
+	return retval;
+}
+
+namespace {
+
+// Point of the set limited by another point, projected on the plane of the first two objectives.
+struct limited_point
+{
+	double			x;
+	double			y;
+	std::size_t		id;
+	bool operator<(const limited_point &other) const
+	{
+		return (x < other.x) || (x == other.x && y < other.y);
+	}
+};
+
+// Staircase of the non-dominated points in the plane, with the area they dominate with respect to the reference point.
+class staircase
+{
+	public:
+		staircase(double rx, double ry):m_rx(rx),m_ry(ry),m_area(0) {}
+		// Insert point, unless it is weakly dominated by a point of the staircase. Return true if the point was inserted.
+		bool insert(double x, double y)
+		{
+			std::map<double,double>::iterator it = m_points.upper_bound(x);
+			if (it != m_points.begin()) {
+				std::map<double,double>::iterator prev = it;
+				--prev;
+				if (prev->second <= y) {
+					return false;
+				}
+			}
+			// Remove the points dominated by the new one, accumulating the area gained.
+			it = m_points.lower_bound(x);
+			double top = m_ry;
+			if (it != m_points.begin()) {
+				std::map<double,double>::iterator prev = it;
+				--prev;
+				top = prev->second;
+			}
+			double cur = x;
+			while (it != m_points.end() && it->second >= y) {
+				m_area += (it->first - cur) * (top - y);
+				cur = it->first;
+				top = it->second;
+				m_points.erase(it++);
+			}
+			m_area += (((it == m_points.end()) ? m_rx : it->first) - cur) * (top - y);
+			m_points.insert(it,std::make_pair(x,y));
+			return true;
+		}
+		double area() const
+		{
+			return m_area;
+		}
+	private:
+		const double			m_rx;
+		const double			m_ry;
+		double				m_area;
+		std::map<double,double>		m_points;
+};
+
+}
+
+// Exclusive contribution of a point in 3 dimensions, as the volume of its box minus the hypervolume of the set limited by the point
+// (see update() for the meaning of affected). The limited set is swept along the third objective, as in hv_algorithm::hv3d::compute(),
+// using the points of the set kept sorted along the third objective:
+// - all the points below p along the third objective are limited to the same level, and are inserted at once, sorted in the plane. Among them,
+//   the points to the left of p collapse to the one with the lowest second objective, and those below p to the one with the lowest first objective;
+// - the sweep stops at the first point above p which is to the left of and below p in the plane, since it covers the whole box of p.
+double hv_contribution_tracker::exclusive_3d(id_type id, std::vector<id_type> *affected) const
+{
+	const fitness_vector &p = m_points[id];
+	const double box = hv_algorithm::base::volume_between(p,m_r_point);
+	staircase front(m_r_point[0],m_r_point[1]);
+	const sweep_type::const_iterator level_end = m_sweep.upper_bound(p[2]);
+	std::vector<limited_point> level;
+	limited_point left, bottom;
+	left.y = bottom.x = 0;
+	left.id = bottom.id = m_points.size();
+	for (sweep_type::const_iterator it = m_sweep.begin(); it != level_end; ++it) {
+		if (it->second == id) {
+			continue;
+		}
+		const fitness_vector &q = m_points[it->second];
+		if (q[0] <= p[0] && (left.id == m_points.size() || q[1] < left.y)) {
+			left.y = q[1];
+			left.id = it->second;
+		}
+		if (q[1] <= p[1] && (bottom.id == m_points.size() || q[0] < bottom.x)) {
+			bottom.x = q[0];
+			bottom.id = it->second;
+		}
+		if (q[0] > p[0] && q[1] > p[1]) {
+			limited_point l;
+			l.x = q[0];
+			l.y = q[1];
+			l.id = it->second;
+			level.push_back(l);
+		}
+	}
+	// Keep only the points not dominated by the collapsed ones.
+	std::vector<limited_point>::size_type n = 0;
+	for (std::vector<limited_point>::size_type i = 0; i < level.size(); ++i) {
+		if ((left.id == m_points.size() || level[i].y < left.y) && (bottom.id == m_points.size() || level[i].x < bottom.x)) {
+			level[n++] = level[i];
+		}
+	}
+	level.resize(n);
+	if (left.id != m_points.size()) {
+		left.x = p[0];
+		level.push_back(left);
+	}
+	if (bottom.id != m_points.size()) {
+		bottom.y = p[1];
+		level.push_back(bottom);
+	}
+	std::sort(level.begin(),level.end());
+	for (std::vector<limited_point>::size_type i = 0; i < level.size(); ++i) {
+		if (front.insert(level[i].x,level[i].y) && affected) {
+			affected->push_back(level[i].id);
+		}
+	}
+	double volume = 0, z = p[2];
+	for (sweep_type::const_iterator it = level_end; it != m_sweep.end(); ++it) {
+		const fitness_vector &q = m_points[it->second];
+		const double area = front.area();
+		if (front.insert(std::max(p[0],q[0]),std::max(p[1],q[1]))) {
+			volume += area * (q[2] - z);
+			z = q[2];
+			if (affected) {
+				affected->push_back(it->second);
+			}
+			if (q[0] <= p[0] && q[1] <= p[1]) {
+				break;
+			}
+		}
+	}
+	volume += front.area() * (m_r_point[2] - z);
+	return std::max(0.,box - volume);
+}
+
+// Exclusive contribution of a point in more than 3 dimensions, as the volume of its box minus the hypervolume of the set limited by the point,
+// computed with HV4D or WFG (see update() for the meaning of affected).
+double hv_contribution_tracker::exclusive_nd(id_type id, std::vector<id_type> *affected) const
+{
+	const fitness_vector &p = m_points[id];
+	std::vector<fitness_vector> limited;
+	for (id_type i = 0; i < m_points.size(); ++i) {
+		if (!m_alive[i] || i == id) {
+			continue;
+		}
+		fitness_vector q(p.size());
+		for (fitness_vector::size_type j = 0; j < p.size(); ++j) {
+			q[j] = std::max(p[j],m_points[i][j]);
+		}
+		limited.push_back(q);
+		if (!affected) {
+			continue;
+		}
+		bool covered = false;
+		for (id_type s = 0; s < m_points.size() && !covered; ++s) {
+			covered = (m_alive[s] && s != i && s != id && weakly_dominates(m_points[s],q));
+		}
+		if (!covered) {
+			affected->push_back(i);
+		}
+	}
+	const double box = hv_algorithm::base::volume_between(p,m_r_point);
+	if (limited.empty()) {
+		return box;
+	}
+	return std::max(0.,box - m_hv_algorithm->compute(limited,m_r_point));
+}
+
+}}
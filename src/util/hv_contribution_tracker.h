@@ -0,0 +1,109 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#ifndef PAGMO_UTIL_HV_CONTRIBUTION_TRACKER_H
+#define PAGMO_UTIL_HV_CONTRIBUTION_TRACKER_H
+
+#include <cstddef>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "../config.h"
+#include "../types.h"
+#include "hv_algorithm/base.h"
+
+namespace pagmo { namespace util {
+
+/// Incremental tracker of exclusive hypervolume contributions.
+/**
+ * This class keeps the exclusive hypervolume contributions of a set of mutually non-dominated points (e.g., a Pareto front)
+ * with respect to a fixed reference point, and updates them as points are inserted into and removed from the set. It is meant for
+ * steady-state algorithms (e.g., SMS-EMOA) which add and remove one point at a time and need the least contributor
+ * after each change: instead of recomputing all the contributions, only those of the points affected by the change are updated.
+ *
+ * Each point is identified by the id returned by insert(). Ids of removed points are reused by subsequent insertions.
+ * Contributions are kept in an ordered index, so that the least and greatest contributors are found in logarithmic time.
+ *
+ * The update strategy depends on the dimension:
+ * - in 2 dimensions the points are kept sorted along the first objective, and insertions and removals update
+ *   the contributions of the two neighbours of the point in logarithmic time;
+ * - in higher dimensions, the contribution of a point q changes only when the region dominated by both q and the inserted
+ *   (or removed) point p is not entirely dominated by the rest of the set, i.e., when the component-wise maximum of p and q is not
+ *   weakly dominated by any other point. The contributions of such points are recomputed exactly, as the volume of the box of q minus the hypervolume
+ *   of the set limited by q. In 3 dimensions the limited set is swept along the third objective directly over the points of the set, which are kept
+ *   sorted along that objective (the same sweep as hv_algorithm::hv3d, without copying and sorting the limited set for each point);
+ *   hv_algorithm::hv4d is used in 4 dimensions and hv_algorithm::wfg otherwise.
+ *
+ * Duplicate points are allowed (they contribute no exclusive volume).
+ */
+class __PAGMO_VISIBLE hv_contribution_tracker
+{
+	public:
+		/// Id type.
+		typedef std::size_t id_type;
+		/// Size type.
+		typedef std::size_t size_type;
+		explicit hv_contribution_tracker(const fitness_vector &);
+		hv_contribution_tracker(const std::vector<fitness_vector> &, const fitness_vector &);
+		id_type insert(const fitness_vector &);
+		void erase(id_type);
+		size_type size() const;
+		bool empty() const;
+		const fitness_vector &get_reference_point() const;
+		const fitness_vector &get_point(id_type) const;
+		double contribution(id_type) const;
+		id_type least_contributor() const;
+		id_type greatest_contributor() const;
+	private:
+		typedef std::multimap<double,id_type> sweep_type;
+		typedef std::set<std::pair<double,id_type> > order_type;
+		void check_id(id_type) const;
+		void check_point(const fitness_vector &) const;
+		void set_contribution(id_type, double);
+		static bool ordered_2d(const fitness_vector &, const fitness_vector &);
+		void check_sweep_2d() const;
+		void insert_2d(id_type);
+		void erase_2d(id_type);
+		void update_2d(sweep_type::iterator);
+		double update(id_type);
+		double exclusive_3d(id_type, std::vector<id_type> * = 0) const;
+		double exclusive_nd(id_type, std::vector<id_type> * = 0) const;
+	private:
+		fitness_vector			m_r_point;
+		hv_algorithm::base_ptr		m_hv_algorithm;
+		std::vector<fitness_vector>	m_points;
+		std::vector<double>		m_contributions;
+		std::vector<char>		m_alive;
+		std::vector<id_type>		m_free;
+		order_type			m_order;
+		// Points sorted along the first objective in 2 dimensions, along the third one in 3 dimensions.
+		sweep_type			m_sweep;
+		std::vector<sweep_type::iterator>	m_sweep_pos;
+};
+
+}}
+
+#endif
@@ -22,10 +22,36 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
 #include "hypervolume.h"
 
 namespace pagmo { namespace util {
 
+namespace {
+
+// Calibration table shared by all the hypervolume objects (null if no table is installed). A published table is never modified:
+// set_calibration() and reset_calibration() replace the pointer, which is loaded and stored atomically, so that the selection
+// of the algorithm reads an immutable snapshot without locking any mutex.
+// A function-local static avoids depending on the initialisation order of the translation units.
+typedef boost::shared_ptr<const hv_calibration> calibration_ptr;
+
+calibration_ptr &calibration_table()
+{
+	static calibration_ptr table;
+	return table;
+}
+
+std::string calibrated_algorithm(const hv_calibration::method_type method, const unsigned int f_dim, const unsigned int n)
+{
+	const calibration_ptr table = boost::atomic_load(&calibration_table());
+	return table ? table->select(method, f_dim, n) : std::string();
+}
+
+}
+
 /// Constructor from population
 /**
  * Constructs a hypervolume object, where points are elicited from the referenced population object.
@@ -33,13 +59,8 @@ namespace pagmo { namespace util {
  * @param[in] pop reference to population object from which Pareto front is computed
  * @param[in] verify flag stating whether the points should be verified after the construction. This turns off the validation for the further computation as well, use 'set_verify' flag to alter it later.
  */
-hypervolume::hypervolume(boost::shared_ptr<population> pop, const bool verify) : m_copy_points(true), m_verify(verify)
-	{
-	m_points.resize(pop->size());
-	for (population::size_type idx = 0 ; idx < pop->size() ; ++idx) {
-		m_points[idx] = fitness_vector(pop->get_individual(idx).cur_f);
-	}
-
+hypervolume::hypervolume(boost::shared_ptr<population> pop, const bool verify) : m_points(*pop), m_copy_points(true), m_verify(verify)
+{
 	if (m_verify) {
 		verify_after_construct();
 	}
@@ -59,6 +80,21 @@ hypervolume::hypervolume(const std::vector<fitness_vector> &points, const bool v
 	}
 }
 
+/// Constructor from a point matrix
+/**
+ * Constructs a hypervolume object from a provided matrix of points.
+ * If the matrix is a view, the points are copied, as the hypervolume object keeps its own set of points.
+ *
+ * @param[in] points matrix of points for which the hypervolume is computed
+ * @param[in] verify flag stating whether the points should be verified after the construction. This turns off the validation for the further computation as well, use 'set_verify' flag to alter it later.
+ */
+hypervolume::hypervolume(const point_matrix &points, const bool verify) : m_points(points), m_copy_points(true), m_verify(verify)
+{
+	if (m_verify) {
+		verify_after_construct();
+	}
+}
+
 /// Copy constructor.
 /**
  * Will perform a deep copy of hypervolume object
@@ -72,10 +108,7 @@ hypervolume::hypervolume(const hypervolume &hv): m_points(hv.m_points), m_copy_p
  * Initiates hypervolume with empty set of points.
  * Used for serialization purposes.
  */
-hypervolume::hypervolume() : m_copy_points(true), m_verify(true)
-{
-	m_points.resize(0);
-}
+hypervolume::hypervolume() : m_points(), m_copy_points(true), m_verify(true) { }
 
 /// Setter for 'copy_points' flag
 /**
@@ -127,18 +160,12 @@ bool hypervolume::get_verify()
  */
 void hypervolume::verify_after_construct() const
 {
-	if ( m_points.size() == 0 ) {
+	if ( m_points.rows() == 0 ) {
 		pagmo_throw(value_error, "Point set cannot be empty.");
 	}
-	fitness_vector::size_type f_dim = m_points[0].size();
-	if (f_dim <= 1) {
+	if (m_points.cols() <= 1) {
 		pagmo_throw(value_error, "Points of dimension > 1 required.");
 	}
-	for (std::vector<fitness_vector>::size_type idx = 1 ; idx < m_points.size() ; ++idx) {
-		if ( m_points[idx].size() != f_dim ) {
-			pagmo_throw(value_error, "All point set dimensions must be equal.");
-		}
-	}
 }
 
 /// Verify before compute method
@@ -151,7 +178,7 @@ void hypervolume::verify_after_construct() const
  */
 void hypervolume::verify_before_compute(const fitness_vector &r_point, hv_algorithm::base_ptr hv_algorithm) const
 {
-	if ( m_points[0].size() != r_point.size() ) {
+	if ( m_points.cols() != r_point.size() ) {
 		pagmo_throw(value_error, "Point set dimensions and reference point dimension must be equal.");
 	}
 	hv_algorithm->verify_before_compute(m_points, r_point);
@@ -160,12 +187,17 @@ void hypervolume::verify_before_compute(const fitness_vector &r_point, hv_algori
 /// Choose the best hypervolume algorithm for given task
 /**
  * Returns the best method for given hypervolume computation problem.
- * As of yet, only the dimension size is taken into account.
+ * The calibration table (see hypervolume::set_calibration) is looked up first. If it has no entry for the dimension and
+ * the number of points of the problem, the algorithm is chosen with fixed thresholds on the dimension and the number of points.
  */
 hv_algorithm::base_ptr hypervolume::get_best_compute(const fitness_vector &r_point) const
 {
 	unsigned int fdim = r_point.size();
-	unsigned int n = m_points.size();
+	unsigned int n = m_points.rows();
+	const std::string calibrated = calibrated_algorithm(hv_calibration::COMPUTE, fdim, n);
+	if (!calibrated.empty()) {
+		return hv_calibration::make_algorithm(calibrated);
+	}
 	if (fdim == 2) {
 		return hv_algorithm::hv2d().clone();
 	} else if (fdim == 3) {
@@ -189,10 +221,16 @@ hv_algorithm::base_ptr hypervolume::get_best_exclusive(const unsigned int p_idx,
 hv_algorithm::base_ptr hypervolume::get_best_contributions(const fitness_vector &r_point) const
 {
 	unsigned int fdim = r_point.size();
+	const std::string calibrated = calibrated_algorithm(hv_calibration::CONTRIBUTIONS, fdim, m_points.rows());
+	if (!calibrated.empty()) {
+		return hv_calibration::make_algorithm(calibrated);
+	}
 	if (fdim == 2) {
 		return hv_algorithm::hv2d().clone();
 	} else if (fdim == 3) {
 		return hv_algorithm::hv3d().clone();
+	} else if (fdim == 4) {
+		return hv_algorithm::hv4d().clone();
 	} else {
 		return hv_algorithm::wfg().clone();
 	}
@@ -215,10 +253,10 @@ double hypervolume::compute(const fitness_vector &r_point, hv_algorithm::base_pt
 
 	// copy the initial set of points, as the algorithm may alter its contents
 	if (m_copy_points) {
-		std::vector<fitness_vector> points_cpy(m_points.begin(), m_points.end());
+		point_matrix points_cpy(m_points);
 		return hv_algorithm->compute(points_cpy, r_point);
 	} else {
-		return hv_algorithm->compute(const_cast<std::vector<fitness_vector> &>(m_points), r_point);
+		return hv_algorithm->compute(const_cast<point_matrix &>(m_points), r_point);
 	}
 }
 
@@ -252,17 +290,17 @@ double hypervolume::exclusive(const unsigned int p_idx, const fitness_vector &r_
 		verify_before_compute(r_point, hv_algorithm);
 	}
 
-	if (p_idx >= m_points.size()) {
+	if (p_idx >= m_points.rows()) {
 		pagmo_throw(value_error, "Index of the individual is out of bounds.");
 
 	}
 
 	// copy the initial set of points, as the algorithm may alter its contents
 	if (m_copy_points) {
-		std::vector<fitness_vector> points_cpy(m_points.begin(), m_points.end());
+		point_matrix points_cpy(m_points);
 		return hv_algorithm->exclusive(p_idx, points_cpy, r_point);
 	} else {
-		return hv_algorithm->exclusive(p_idx, const_cast<std::vector<fitness_vector> &>(m_points), r_point);
+		return hv_algorithm->exclusive(p_idx, const_cast<point_matrix &>(m_points), r_point);
 	}
 }
 
@@ -297,16 +335,16 @@ unsigned int hypervolume::least_contributor(const fitness_vector &r_point, hv_al
 	}
 
 	// Trivial case
-	if (m_points.size() == 1) {
+	if (m_points.rows() == 1) {
 		return 0;
 	}
 
 	// copy the initial set of points, as the algorithm may alter its contents
 	if (m_copy_points) {
-		std::vector<fitness_vector> points_cpy(m_points.begin(), m_points.end());
+		point_matrix points_cpy(m_points);
 		return hv_algorithm->least_contributor(points_cpy, r_point);
 	} else {
-		return hv_algorithm->least_contributor(const_cast<std::vector<fitness_vector> &>(m_points), r_point);
+		return hv_algorithm->least_contributor(const_cast<point_matrix &>(m_points), r_point);
 	}
 }
 
@@ -341,10 +379,10 @@ unsigned int hypervolume::greatest_contributor(const fitness_vector &r_point, hv
 
 	// copy the initial set of points, as the algorithm may alter its contents
 	if (m_copy_points) {
-		std::vector<fitness_vector> points_cpy(m_points.begin(), m_points.end());
+		point_matrix points_cpy(m_points);
 		return hv_algorithm->greatest_contributor(points_cpy, r_point);
 	} else {
-		return hv_algorithm->greatest_contributor(const_cast<std::vector<fitness_vector> &>(m_points), r_point);
+		return hv_algorithm->greatest_contributor(const_cast<point_matrix &>(m_points), r_point);
 	}
 }
 
@@ -378,18 +416,18 @@ std::vector<double> hypervolume::contributions(const fitness_vector &r_point, co
 	}
 
 	// Trivial case
-	if (m_points.size() == 1) {
+	if (m_points.rows() == 1) {
 		std::vector<double> c;
-		c.push_back(hv_algorithm::base::volume_between(m_points[0], r_point));
+		c.push_back(hv_algorithm::base::volume_between(m_points.get_row(0), r_point));
 		return c;
 	}
 
 	// copy the initial set of points, as the algorithm may alter its contents
 	if (m_copy_points) {
-		std::vector<fitness_vector> points_cpy(m_points.begin(), m_points.end());
+		point_matrix points_cpy(m_points);
 		return hv_algorithm->contributions(points_cpy, r_point);
 	} else {
-		return hv_algorithm->contributions(const_cast<std::vector<fitness_vector> &>(m_points), r_point);
+		return hv_algorithm->contributions(const_cast<point_matrix &>(m_points), r_point);
 	}
 }
 
@@ -438,11 +476,14 @@ double hypervolume::get_expected_operations(const unsigned int n, const unsigned
  */
 fitness_vector hypervolume::get_nadir_point(const double epsilon) const
 {
-	fitness_vector nadir_point(m_points[0].begin(), m_points[0].end());
-	for (std::vector<fitness_vector>::size_type idx = 1 ; idx < m_points.size() ; ++ idx){
-		for (fitness_vector::size_type f_idx = 0 ; f_idx < m_points[0].size() ; ++f_idx){
+	fitness_vector nadir_point = m_points.get_row(0);
+	double *nadir = &nadir_point[0];
+	const point_matrix::size_type f_dim = m_points.cols();
+	for (point_matrix::size_type idx = 1 ; idx < m_points.rows() ; ++ idx){
+		const double *p = m_points[idx];
+		for (point_matrix::size_type f_idx = 0 ; f_idx < f_dim ; ++f_idx){
 			// assuming minimization problem, thus maximum value by each dimension is taken
-			nadir_point[f_idx] = std::max(nadir_point[f_idx], m_points[idx][f_idx]);
+			nadir[f_idx] = (p[f_idx] > nadir[f_idx]) ? p[f_idx] : nadir[f_idx];
 		}
 	}
 	for (fitness_vector::size_type f_idx = 0 ; f_idx < nadir_point.size() ; ++f_idx) {
@@ -459,6 +500,15 @@ fitness_vector hypervolume::get_nadir_point(const double epsilon) const
  * @return const reference to the vector containing the fitness_vectors representing the points in the hyperspace.
  */
 const std::vector<fitness_vector> hypervolume::get_points() const
+{
+	return m_points.to_vectors();
+}
+
+/// Get the point matrix
+/**
+ * @return const reference to the matrix of the points in the hyperspace.
+ */
+const point_matrix &hypervolume::get_point_matrix() const
 {
 	return m_points;
 }
@@ -474,4 +524,36 @@ hypervolume_ptr hypervolume::clone() const
 	return hypervolume_ptr(new hypervolume(*this));
 }
 
+/// Set the calibration table
+/**
+ * Sets the table used to choose the algorithm when none is provided to the methods of the hypervolume objects, in place of the
+ * fixed thresholds. The table is shared by all the hypervolume objects, and it can be set while other threads are computing hypervolumes.
+ * Problems not covered by the table are still solved with the algorithm chosen by the fixed thresholds.
+ *
+ * @param[in] table calibration table, e.g., loaded from the file written by the hypervolume_benchmark program
+ */
+void hypervolume::set_calibration(const hv_calibration &table)
+{
+	boost::atomic_store(&calibration_table(), table.empty() ? calibration_ptr() : calibration_ptr(new hv_calibration(table)));
+}
+
+/// Get the calibration table
+/**
+ * @return copy of the calibration table currently in use
+ */
+hv_calibration hypervolume::get_calibration()
+{
+	const calibration_ptr table = boost::atomic_load(&calibration_table());
+	return table ? *table : hv_calibration();
+}
+
+/// Reset the calibration table
+/**
+ * Empties the calibration table, so that the algorithms are chosen with the fixed thresholds.
+ */
+void hypervolume::reset_calibration()
+{
+	boost::atomic_store(&calibration_table(), calibration_ptr());
+}
+
 }}
@@ -29,6 +29,8 @@
 #include <vector>
 #include <cmath>
 #include "../population.h"
+#include "point_matrix.h"
+#include "hv_calibration.h"
 #include "hv_algorithm/base.h"
 #include "hv_algorithm/hv2d.h"
 #include "hv_algorithm/hv3d.h"
@@ -60,6 +62,7 @@ public:
 	hypervolume(const hypervolume &);
 	hypervolume(const boost::shared_ptr<population>, const bool verify = true);
 	hypervolume(const std::vector<fitness_vector> &, const bool verify = true);
+	hypervolume(const point_matrix &, const bool verify = true);
 
 	double compute(const fitness_vector &, const hv_algorithm::base_ptr) const;
 	double compute(const fitness_vector &) const;
@@ -87,6 +90,11 @@ public:
 
 	hypervolume_ptr clone() const;
 	const std::vector<fitness_vector> get_points() const;
+	const point_matrix &get_point_matrix() const;
+
+	static void set_calibration(const hv_calibration &);
+	static hv_calibration get_calibration();
+	static void reset_calibration();
 
 private:
 	hv_algorithm::base_ptr get_best_compute(const fitness_vector &) const;
@@ -95,23 +103,38 @@ private:
 	void verify_after_construct() const;
 	void verify_before_compute(const fitness_vector &, const hv_algorithm::base_ptr) const;
 
-	std::vector<fitness_vector> m_points;
+	point_matrix m_points;
 	bool m_copy_points;
 	bool m_verify;
 
 
 	friend class boost::serialization::access;
 	template <class Archive>
-	void serialize(Archive &ar, const unsigned int)
+	void save(Archive &ar, const unsigned int) const
+	{
+		ar << m_points;
+		ar << m_copy_points;
+		ar << m_verify;
+	}
+	template <class Archive>
+	void load(Archive &ar, const unsigned int version)
 	{
-		ar & m_points;
-		ar & m_copy_points;
-		ar & m_verify;
+		if (version == 0) {
+			std::vector<fitness_vector> points;
+			ar >> points;
+			m_points = point_matrix(points);
+		} else {
+			ar >> m_points;
+		}
+		ar >> m_copy_points;
+		ar >> m_verify;
 	}
+	BOOST_SERIALIZATION_SPLIT_MEMBER()
 };
 
 }}
 
 BOOST_CLASS_EXPORT_KEY(pagmo::util::hypervolume)
+BOOST_CLASS_VERSION(pagmo::util::hypervolume,1)
 
 #endif
@@ -0,0 +1,218 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "../exceptions.h"
+#include "../population.h"
+#include "../types.h"
+#include "point_matrix.h"
+
+namespace pagmo { namespace util {
+
+const point_matrix::size_type point_matrix::alignment;
+
+/// Default constructor.
+/**
+ * Builds an empty matrix.
+ */
+point_matrix::point_matrix():m_storage(),m_data(0),m_rows(0),m_cols(0),m_view(false) {}
+
+/// Constructor from size.
+/**
+ * @param[in] rows number of points.
+ * @param[in] cols dimension of the points.
+ * @param[in] value value of all the coordinates.
+ */
+point_matrix::point_matrix(const size_type rows, const size_type cols, const double value):m_storage(),m_data(0),m_rows(0),m_cols(0),m_view(false)
+{
+	allocate(rows,cols);
+	std::fill(m_data,m_data + rows * cols,value);
+}
+
+/// View constructor.
+/**
+ * Builds a matrix which refers to an existing row-major block of rows x cols doubles. No memory is allocated and no data is copied:
+ * modifications of the matrix affect the block, which must outlive the view.
+ *
+ * @param[in] data pointer to the first coordinate of the first point.
+ * @param[in] rows number of points.
+ * @param[in] cols dimension of the points.
+ *
+ * @throws value_error if data is null and the block is not empty.
+ */
+point_matrix::point_matrix(double *data, const size_type rows, const size_type cols):m_storage(),m_data(data),m_rows(rows),m_cols(cols),m_view(true)
+{
+	if (!data && rows != 0 && cols != 0) {
+		pagmo_throw(value_error,"cannot build a point matrix view of a null pointer");
+	}
+}
+
+/// Constructor from a vector of points.
+/**
+ * @param[in] points vector of points, which must all have the same dimension.
+ *
+ * @throws value_error if the dimensions of the points differ.
+ */
+point_matrix::point_matrix(const std::vector<fitness_vector> &points):m_storage(),m_data(0),m_rows(0),m_cols(0),m_view(false)
+{
+	allocate(points.size(),points.size() ? points[0].size() : 0);
+	for (size_type i = 0; i < m_rows; ++i) {
+		set_row(i,points[i]);
+	}
+}
+
+/// Constructor from population.
+/**
+ * Packs the current fitness vectors of the individuals of the population into a single block, in a single pass.
+ *
+ * @param[in] pop population.
+ */
+point_matrix::point_matrix(const population &pop):m_storage(),m_data(0),m_rows(0),m_cols(0),m_view(false)
+{
+	allocate(pop.size(),pop.problem().get_f_dimension());
+	for (size_type i = 0; i < m_rows; ++i) {
+		set_row(i,pop.get_individual(i).cur_f);
+	}
+}
+
+/// Copy constructor.
+/**
+ * The copy always owns its data, even if the original matrix is a view.
+ *
+ * @param[in] other matrix to be copied.
+ */
+point_matrix::point_matrix(const point_matrix &other):m_storage(),m_data(0),m_rows(0),m_cols(0),m_view(false)
+{
+	allocate(other.m_rows,other.m_cols);
+	std::copy(other.m_data,other.m_data + m_rows * m_cols,m_data);
+}
+
+/// Assignment operator.
+/**
+ * After the assignment the matrix owns its data, even if it was a view or other is a view.
+ *
+ * @param[in] other matrix to be copied.
+ *
+ * @return reference to this.
+ */
+point_matrix &point_matrix::operator=(const point_matrix &other)
+{
+	if (this != &other) {
+		allocate(other.m_rows,other.m_cols);
+		std::copy(other.m_data,other.m_data + m_rows * m_cols,m_data);
+	}
+	return *this;
+}
+
+/// Check whether the matrix is a view.
+/**
+ * @return true if the matrix refers to an externally owned block of memory.
+ */
+bool point_matrix::is_view() const
+{
+	return m_view;
+}
+
+/// Get a point.
+/**
+ * @param[in] i index of the point.
+ *
+ * @return copy of the i-th point.
+ *
+ * @throws index_error if i is out of range.
+ */
+fitness_vector point_matrix::get_row(const size_type i) const
+{
+	if (i >= m_rows) {
+		pagmo_throw(index_error,"point index out of range");
+	}
+	return fitness_vector((*this)[i],(*this)[i] + m_cols);
+}
+
+/// Set a point.
+/**
+ * @param[in] i index of the point.
+ * @param[in] f new coordinates of the point.
+ *
+ * @throws index_error if i is out of range.
+ * @throws value_error if the dimension of f is not the dimension of the matrix.
+ */
+void point_matrix::set_row(const size_type i, const fitness_vector &f)
+{
+	if (i >= m_rows) {
+		pagmo_throw(index_error,"point index out of range");
+	}
+	if (f.size() != m_cols) {
+		pagmo_throw(value_error,"all the points in a point matrix must have the same dimension");
+	}
+	std::copy(f.begin(),f.end(),(*this)[i]);
+}
+
+/// Remove a point.
+/**
+ * The following points are shifted one row up. The order of the remaining points is preserved.
+ *
+ * @param[in] i index of the point.
+ *
+ * @throws index_error if i is out of range.
+ */
+void point_matrix::erase_row(const size_type i)
+{
+	if (i >= m_rows) {
+		pagmo_throw(index_error,"point index out of range");
+	}
+	std::copy((*this)[i + 1],m_data + m_rows * m_cols,(*this)[i]);
+	--m_rows;
+}
+
+/// Convert to a vector of points.
+/**
+ * @return vector containing a copy of each point.
+ */
+std::vector<fitness_vector> point_matrix::to_vectors() const
+{
+	std::vector<fitness_vector> retval;
+	retval.reserve(m_rows);
+	for (size_type i = 0; i < m_rows; ++i) {
+		retval.push_back(fitness_vector((*this)[i],(*this)[i] + m_cols));
+	}
+	return retval;
+}
+
+// Allocate an owned, aligned and uninitialised block for rows x cols doubles.
+void point_matrix::allocate(const size_type rows, const size_type cols)
+{
+	const size_type pad = alignment / sizeof(double);
+	m_storage.resize(rows * cols + pad);
+	const std::size_t addr = reinterpret_cast<std::size_t>(&m_storage[0]);
+	m_data = &m_storage[0] + ((alignment - addr % alignment) % alignment) / sizeof(double);
+	m_rows = rows;
+	m_cols = cols;
+	m_view = false;
+}
+
+}}
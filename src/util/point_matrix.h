@@ -0,0 +1,144 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#ifndef PAGMO_UTIL_POINT_MATRIX_H
+#define PAGMO_UTIL_POINT_MATRIX_H
+
+#include <cstddef>
+#include <vector>
+
+#include "../config.h"
+#include "../serialization.h"
+#include "../types.h"
+
+namespace pagmo {
+
+class population;
+
+namespace util {
+
+/// Dense matrix of points.
+/**
+ * This class stores a set of N points of dimension M as a single, row-major N x M block of doubles, so that the i-th point
+ * is the contiguous range [(*this)[i], (*this)[i] + M). It is the point set representation used throughout the hypervolume subsystem:
+ * compared to a std::vector of fitness_vectors it requires a single allocation, it can be copied with a single memory copy,
+ * and the loops running over the coordinates of the points (dominance checks, bounding boxes, volumes) can be vectorised by the compiler.
+ *
+ * The first element of an owned block is aligned to point_matrix::alignment bytes. A point_matrix can also be a view of an
+ * externally owned row-major block (see the point_matrix(double *, size_type, size_type) constructor), in which case no memory is allocated
+ * and the caller must keep the block alive for the lifetime of the view. Copies of a view are always owning deep copies.
+ */
+class __PAGMO_VISIBLE point_matrix
+{
+	public:
+		/// Size type.
+		typedef std::vector<double>::size_type size_type;
+		/// Alignment, in bytes, of the owned blocks.
+		static const size_type alignment = 32;
+
+		point_matrix();
+		point_matrix(const size_type, const size_type, const double = 0.);
+		point_matrix(double *, const size_type, const size_type);
+		explicit point_matrix(const std::vector<fitness_vector> &);
+		explicit point_matrix(const population &);
+		point_matrix(const point_matrix &);
+		point_matrix &operator=(const point_matrix &);
+
+		/// Number of points.
+		size_type rows() const
+		{
+			return m_rows;
+		}
+		/// Dimension of the points.
+		size_type cols() const
+		{
+			return m_cols;
+		}
+		/// Check whether the matrix contains no points.
+		bool empty() const
+		{
+			return m_rows == 0;
+		}
+		/// Pointer to the first coordinate of the i-th point.
+		double *operator[](const size_type i)
+		{
+			return m_data + i * m_cols;
+		}
+		/// Const pointer to the first coordinate of the i-th point.
+		const double *operator[](const size_type i) const
+		{
+			return m_data + i * m_cols;
+		}
+		/// Pointer to the beginning of the block.
+		double *data()
+		{
+			return m_data;
+		}
+		/// Const pointer to the beginning of the block.
+		const double *data() const
+		{
+			return m_data;
+		}
+		bool is_view() const;
+		fitness_vector get_row(const size_type) const;
+		std::vector<fitness_vector> to_vectors() const;
+		void set_row(const size_type, const fitness_vector &);
+		void erase_row(const size_type);
+
+	private:
+		void allocate(const size_type, const size_type);
+
+		std::vector<double>	m_storage;
+		double			*m_data;
+		size_type		m_rows;
+		size_type		m_cols;
+		bool			m_view;
+
+		friend class boost::serialization::access;
+		template <class Archive>
+		void save(Archive &ar, const unsigned int) const
+		{
+			ar << m_rows;
+			ar << m_cols;
+			for (size_type i = 0; i < m_rows * m_cols; ++i) {
+				ar << m_data[i];
+			}
+		}
+		template <class Archive>
+		void load(Archive &ar, const unsigned int)
+		{
+			size_type rows, cols;
+			ar >> rows;
+			ar >> cols;
+			allocate(rows, cols);
+			for (size_type i = 0; i < m_rows * m_cols; ++i) {
+				ar >> m_data[i];
+			}
+		}
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
+};
+
+}}
+
+#endif
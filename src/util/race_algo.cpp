@@ -1,8 +1,10 @@
 #include "race_algo.h" 
 #include "race_pop.h"
 #include "../problem/base_stochastic.h"
+#include "../rng.h"
 
 #include <algorithm>
+#include <cstddef>
 
 namespace pagmo { namespace util { namespace racing {
 
@@ -47,6 +49,12 @@ static problem::base::c_size_type get_max_ic_dimension(const std::vector<problem
  *
  * Currently supports box constrained and equality / inequality constrained
  * single-objective problems
+ *
+ * The evolutions required by a batch evaluation (one per algorithm) are
+ * independent, and they run concurrently if a thread pool was set via
+ * set_thread_pool(). Each evolution is performed by a copy of the algorithm
+ * whose rngs are reset to the current seed, so that the result does not
+ * depend on the number of threads nor on the order of the evaluations.
  */
 class standard : public problem::base_stochastic
 {
@@ -59,8 +67,12 @@ class standard : public problem::base_stochastic
 		problem::base_ptr clone() const;
 		void objfun_impl(fitness_vector &, const decision_vector &) const;
 		void compute_constraints_impl(constraint_vector &, const decision_vector &) const;
+		void objfun_batch_impl(std::vector<fitness_vector> &, const std::vector<decision_vector> &) const;
+		void compute_constraints_batch_impl(std::vector<constraint_vector> &, const std::vector<decision_vector> &) const;
 	
 	private:
+		struct evolve_task;
+		friend struct evolve_task;
 
 		friend class boost::serialization::access;
 		template <class Archive>
@@ -75,7 +87,8 @@ class standard : public problem::base_stochastic
 		void setup(const std::vector<problem::base_ptr> &probs, const std::vector<algorithm::base_ptr> &algos);
 		constraint_vector zero_pad_constraint(const constraint_vector&, problem::base::c_size_type) const;	
 		
-		void evaluate_algorithm(unsigned int) const;
+		void evaluate_algorithms(const std::vector<unsigned int> &) const;
+		void run_algorithm(unsigned int, fitness_vector &, constraint_vector &) const;
 
 		std::vector<algorithm::base_ptr> m_algos;
 		std::vector<problem::base_ptr> m_probs;
@@ -170,7 +183,7 @@ problem::base_ptr standard::clone() const
  */
 void standard::objfun_impl(fitness_vector &f, const decision_vector &x) const
 {
-	evaluate_algorithm(x[0]);
+	evaluate_algorithms(std::vector<unsigned int>(1, x[0]));
 	f = m_database_f[x[0]];
 }
 
@@ -181,10 +194,47 @@ void standard::objfun_impl(fitness_vector &f, const decision_vector &x) const
  */
 void standard::compute_constraints_impl(constraint_vector &c, const decision_vector &x) const
 {
-	evaluate_algorithm(x[0]);
+	evaluate_algorithms(std::vector<unsigned int>(1, x[0]));
 	c = m_database_c[x[0]];
 }
 
+// Extract the indices of the algorithms from a batch of decision vectors
+static std::vector<unsigned int> get_algo_indices(const std::vector<decision_vector> &x)
+{
+	std::vector<unsigned int> algo_idx(x.size());
+	for(std::vector<decision_vector>::size_type i = 0; i < x.size(); i++){
+		algo_idx[i] = x[i][0];
+	}
+	return algo_idx;
+}
+
+/// The performance of a set of algorithms encoded in the fitness function
+/**
+ * Same as objfun_impl(), but the evolutions of all the algorithms in the
+ * batch are performed at once, concurrently if a thread pool is set.
+ */
+void standard::objfun_batch_impl(std::vector<fitness_vector> &f, const std::vector<decision_vector> &x) const
+{
+	evaluate_algorithms(get_algo_indices(x));
+	for(std::vector<decision_vector>::size_type i = 0; i < x.size(); i++){
+		f[i] = m_database_f[x[i][0]];
+	}
+}
+
+/// The performance of a set of algorithms in terms of constraint vectors
+/**
+ * Same as compute_constraints_impl(), but the evolutions of all the
+ * algorithms in the batch are performed at once, concurrently if a thread
+ * pool is set.
+ */
+void standard::compute_constraints_batch_impl(std::vector<constraint_vector> &c, const std::vector<decision_vector> &x) const
+{
+	evaluate_algorithms(get_algo_indices(x));
+	for(std::vector<decision_vector>::size_type i = 0; i < x.size(); i++){
+		c[i] = m_database_c[x[i][0]];
+	}
+}
+
 /// Pad constraint vector with non-violating values (i.e. 0)
 /**
  * This is necessary when the underlying problems have different dimension. The
@@ -206,7 +256,23 @@ constraint_vector standard::zero_pad_constraint(const constraint_vector& c,  pro
 	return c_padded;
 }
 
-/// Evaluate the target algorithm and stores the evaluation results
+// Thread pool job running a set of algorithms under the current seed. Each
+// invocation writes only to its own output slots.
+struct standard::evolve_task: util::thread_pool::task
+{
+	evolve_task(const standard &metrics, const std::vector<unsigned int> &algo_idx, std::vector<fitness_vector> &f, std::vector<constraint_vector> &c):
+		m_metrics(metrics),m_algo_idx(algo_idx),m_f(f),m_c(c) {}
+	void operator()(unsigned int, std::size_t i)
+	{
+		m_metrics.run_algorithm(m_algo_idx[i], m_f[i], m_c[i]);
+	}
+	const standard				&m_metrics;
+	const std::vector<unsigned int>		&m_algo_idx;
+	std::vector<fitness_vector>		&m_f;
+	std::vector<constraint_vector>		&m_c;
+};
+
+/// Evaluate the target algorithms and stores the evaluation results
 /**
  * If objfun_impl() and compute_constraints_impl() are decoupled, this
  * meta-problem needs to evolve an identical population twice to get
@@ -214,23 +280,58 @@ constraint_vector standard::zero_pad_constraint(const constraint_vector& c,  pro
  * function serves as a proxy to the actual evaluation job, and it will take
  * care of skipping unnecessary evolution of population.
  *
+ * The algorithms which still need to be run under the current seed are run
+ * concurrently on the thread pool of the problem, if any.
  */
-void standard::evaluate_algorithm(unsigned int algo_idx) const
+void standard::evaluate_algorithms(const std::vector<unsigned int> &algo_idx) const
 {
-	if(algo_idx >= m_algos.size()){
-		pagmo_throw(value_error, "Out of bound algorithm index");
+	std::vector<unsigned int> to_run;
+	for(std::vector<unsigned int>::size_type i = 0; i < algo_idx.size(); i++){
+		if(algo_idx[i] >= m_algos.size()){
+			pagmo_throw(value_error, "Out of bound algorithm index");
+		}
+		// The requested data is ready, nothing to do
+		if(!m_is_first_evaluation[algo_idx[i]] && m_database_seed[algo_idx[i]] == m_seed){
+			continue;
+		}
+		if(std::find(to_run.begin(), to_run.end(), algo_idx[i]) == to_run.end()){
+			to_run.push_back(algo_idx[i]);
+		}
 	}
 
-	// The requested data is ready, nothing to do
-	if(!m_is_first_evaluation[algo_idx] && m_database_seed[algo_idx] == m_seed){
-		return;
+	std::vector<fitness_vector> f(to_run.size());
+	std::vector<constraint_vector> c(to_run.size());
+	if(get_thread_pool() && to_run.size() > 1){
+		evolve_task task(*this, to_run, f, c);
+		get_thread_pool()->run(task, to_run.size());
+	}
+	else{
+		for(std::vector<unsigned int>::size_type i = 0; i < to_run.size(); i++){
+			run_algorithm(to_run[i], f[i], c[i]);
+		}
 	}
 
-	// Seeding control
-	for(unsigned int i = 0; i < m_algos.size(); i++){
-		m_algos[i]->reset_rngs(m_seed);
+	// Store the data, to be retrieved by objfun_impl() or compute_constraints_impl()
+	for(std::vector<unsigned int>::size_type i = 0; i < to_run.size(); i++){
+		m_is_first_evaluation[to_run[i]] = false;
+		m_database_seed[to_run[i]] = m_seed;
+		m_database_f[to_run[i]].swap(f[i]);
+		m_database_c[to_run[i]].swap(c[i]);
 	}
-	m_drng.seed(m_seed);
+}
+
+/// Evolve a population with the target algorithm under the current seed
+/**
+ * The evolution is performed by a copy of the algorithm and it does not
+ * modify the state of this problem, so that several algorithms can be run
+ * concurrently.
+ */
+void standard::run_algorithm(unsigned int algo_idx, fitness_vector &f, constraint_vector &c) const
+{
+	// Seeding control
+	algorithm::base_ptr algo = m_algos[algo_idx]->clone();
+	algo->reset_rngs(m_seed);
+	rng_double drng(m_seed);
 
 	// Randomly sample a problem if required
 	unsigned int prob_idx;
@@ -238,19 +339,16 @@ void standard::evaluate_algorithm(unsigned int algo_idx) const
 		prob_idx = 0;
 	}
 	else{
-		prob_idx = (unsigned int)(m_drng() * 100000) % m_probs.size();
+		prob_idx = (unsigned int)(drng() * 100000) % m_probs.size();
 	}
 
 	// Fitness defined as the quality of the champion in the evolved
 	// population, evolved by the selected algorithm
 	population pop(*m_probs[prob_idx], m_pop_size, m_seed);
-	m_algos[algo_idx]->evolve(pop);
+	algo->evolve(pop);
 
-	// Store the data, to be retrieved by objfun_impl() or compute_constraints_impl()
-	m_is_first_evaluation[algo_idx] = false;
-	m_database_seed[algo_idx] = m_seed;
-	m_database_f[algo_idx] = pop.champion().f;
-	m_database_c[algo_idx] = zero_pad_constraint(pop.champion().c, m_probs[prob_idx]->get_ic_dimension());
+	f = pop.champion().f;
+	c = zero_pad_constraint(pop.champion().c, m_probs[prob_idx]->get_ic_dimension());
 }
 
 
@@ -293,6 +391,30 @@ race_algo::race_algo(const std::vector<algorithm::base_ptr> &algos, const std::v
 	}
 }
 
+/// Set the thread pool used to run the algorithms.
+/**
+ * In each racing iteration, the algorithms still in the race evolve their
+ * populations concurrently on the worker threads of pool. Each run uses a
+ * copy of its algorithm seeded from the seed of the iteration, hence the
+ * outcome of the race does not depend on the number of threads. Passing a
+ * null pointer restores the serial runs.
+ *
+ * @param[in] pool thread pool to be used for the algorithm runs.
+ */
+void race_algo::set_thread_pool(const util::thread_pool_ptr &pool)
+{
+	m_thread_pool = pool;
+}
+
+/// Get the thread pool used to run the algorithms.
+/**
+ * @return const reference to the thread pool (null if the algorithms are run serially).
+ */
+const util::thread_pool_ptr &race_algo::get_thread_pool() const
+{
+	return m_thread_pool;
+}
+
 /// Juice of racing mechanisms for algorithms
 /**
  * The interface of race_algo mirrors race_pop.
@@ -306,6 +428,7 @@ race_algo::race_algo(const std::vector<algorithm::base_ptr> &algos, const std::v
  * @param[in] screen_output Whether to log racing status on the console output.
  *
  * @see Refer to util::racing::race_pop for the details of the racing mechanisms.
+ * @see set_thread_pool() to run the algorithms of each racing iteration concurrently.
  */
 std::pair<std::vector<unsigned int>, unsigned int> race_algo::run(
 	const unsigned int n_final,
@@ -331,12 +454,15 @@ std::pair<std::vector<unsigned int>, unsigned int> race_algo::run(
 	// Construct an internal population, such that the winners of the race in
 	// this population corresponds to the winning algorithm
 	metrics_algos::standard metrics(m_probs, m_algos, m_seed, m_pop_size);
-	population algos_pop(metrics);
+	metrics.set_thread_pool(m_thread_pool);
+	// The seeds of the racing iterations are drawn from the population, which
+	// is seeded as well so that the whole race is reproducible
+	population algos_pop(metrics, 0, m_seed);
+	std::vector<decision_vector> algo_idx(m_algos.size(), decision_vector(1));
 	for(unsigned int i = 0; i < m_algos.size(); i++){
-		decision_vector algo_idx(1);
-		algo_idx[0] = i;
-		algos_pop.push_back(algo_idx);
+		algo_idx[i][0] = i;
 	}
+	algos_pop.push_back_batch(algo_idx);
 
 	// Conversion to types that pop_race is familiar with
 	std::vector<population::size_type> pop_race_active_set(active_set.size());
@@ -34,6 +34,7 @@
 #include "../problem/base.h"
 #include "../problem/ackley.h"
 #include "../algorithm/base.h"
+#include "thread_pool.h"
 
 namespace pagmo { namespace util { namespace racing {
 
@@ -42,6 +43,10 @@ namespace pagmo { namespace util { namespace racing {
  * This class allows the racing of a set of algorithms on a problem or a set of
  * problems. It supports the racing over single objective box-constrained and
  * equality / inequality constrained problems.
+ *
+ * The algorithm runs of a racing iteration are independent of each other, and
+ * they can be performed concurrently by setting a thread pool with
+ * set_thread_pool().
  */
 class __PAGMO_VISIBLE race_algo
 {
@@ -60,12 +65,16 @@ class __PAGMO_VISIBLE race_algo
 			const bool screen_output
 		);
 
+		void set_thread_pool(const util::thread_pool_ptr &);
+		const util::thread_pool_ptr &get_thread_pool() const;
+
 	private:
 
 		std::vector<algorithm::base_ptr> m_algos;
 		std::vector<problem::base_ptr> m_probs;
 		unsigned int m_pop_size;
 		unsigned int m_seed;
+		util::thread_pool_ptr m_thread_pool;
 };
 
 }}}
@@ -162,8 +162,8 @@ std::vector<population::size_type> race_pop::construct_output_list(
 // @return The number of objective function calls made
 unsigned int race_pop::prepare_population_friedman(const std::vector<population::size_type>& in_race, unsigned int count_iter)
 {
-	unsigned int count_nfes = 0;
-	// Perform re-evaluation on necessary individuals under current seed
+	// Racers which cannot reuse previous data and need to be re-evaluated under current seed
+	std::vector<population::size_type> to_eval;
 	for(std::vector<population::size_type>::const_iterator it = in_race.begin(); it != in_race.end(); ++it) {
 		// Case 1: Current racer has previous data that can be reused, no
 		// need to be evaluated with this seed
@@ -171,19 +171,21 @@ unsigned int race_pop::prepare_population_friedman(const std::vector<population:
 			const eval_data& cached_data = cache_get_entry(*it, count_iter-1);
 			m_pop.set_fc(*it, cached_data.f, cached_data.c);
 		}
-		// Case 2: No previous data can be reused, perform actual
-		// re-evaluation and update the cache
+		// Case 2: No previous data can be reused, actual re-evaluation is needed
 		else{
-			count_nfes++;
-			const population::individual_type &ind = m_pop.get_individual(*it);
-			fitness_vector f_vec = m_pop.problem().objfun(ind.cur_x);
-			constraint_vector c_vec = m_pop.problem().compute_constraints(ind.cur_x);
-			m_pop.set_fc(*it, f_vec, c_vec);
-			if(m_use_caching)
-				cache_insert_data(*it, f_vec, c_vec);
+			to_eval.push_back(*it);
 		}
 	}
-	return count_nfes;
+	// Perform the re-evaluations in one go and update the cache
+	std::vector<fitness_vector> f_vecs;
+	std::vector<constraint_vector> c_vecs;
+	evaluate_racers(to_eval, f_vecs, c_vecs);
+	for(unsigned int i = 0; i < to_eval.size(); i++){
+		m_pop.set_fc(to_eval[i], f_vecs[i], c_vecs[i]);
+		if(m_use_caching)
+			cache_insert_data(to_eval[i], f_vecs[i], c_vecs[i]);
+	}
+	return to_eval.size();
 }
 
 /// Update m_pop_wilcoxon to contain evaluation data required for Wilcoxon test
@@ -194,7 +196,6 @@ unsigned int race_pop::prepare_population_friedman(const std::vector<population:
  **/
 unsigned int race_pop::prepare_population_wilcoxon(const std::vector<population::size_type>& in_race, unsigned int count_iter)
 {
-	unsigned int count_nfes = 0;
 	if(in_race.size() != 2){
 		pagmo_throw(value_error, "Wilcoxon rank sum test is only applicable when there are two active individuals");
 	}	
@@ -211,31 +212,57 @@ unsigned int race_pop::prepare_population_wilcoxon(const std::vector<population:
 	else{
 		start_count_iter = count_iter;
 	}
+	// Slots of m_pop_wilcoxon (and the corresponding racers) that need actual re-evaluation
+	std::vector<population::size_type> to_eval;
+	std::vector<population::size_type> to_eval_slots;
 	for(std::vector<population::size_type>::const_iterator it = in_race.begin(); it != in_race.end(); ++it) {
 		decision_vector dummy_x;
 		for(unsigned int i = start_count_iter; i <= count_iter; i++){
+			m_pop_wilcoxon.push_back_noeval(dummy_x);
 			// Case 1: Current racer has previous data that can be reused, no
 			// need to be evaluated with this seed
 			if(m_use_caching && cache_data_exist(*it, i-1)){
-				m_pop_wilcoxon.push_back_noeval(dummy_x);
 				const eval_data& cached_data = cache_get_entry(*it, i-1);
 				m_pop_wilcoxon.set_fc(m_pop_wilcoxon.size()-1, cached_data.f, cached_data.c);
 			}
-			// Case 2: No previous data can be reused, perform actual
-			// re-evaluation and update the cache
+			// Case 2: No previous data can be reused, actual re-evaluation is
+			// needed. As the cache of a racer only grows at its end, all the
+			// following data points of this racer will be missing as well.
 			else{
-				count_nfes++;
-				const population::individual_type &ind = m_pop.get_individual(*it);
-				fitness_vector f_vec = m_pop.problem().objfun(ind.cur_x);
-				constraint_vector c_vec = m_pop.problem().compute_constraints(ind.cur_x);
-				m_pop_wilcoxon.push_back_noeval(dummy_x);
-				m_pop_wilcoxon.set_fc(m_pop_wilcoxon.size()-1, f_vec, c_vec);
-				if(m_use_caching)
-					cache_insert_data(*it, f_vec, c_vec);
+				to_eval.push_back(*it);
+				to_eval_slots.push_back(m_pop_wilcoxon.size()-1);
 			}
 		}
 	}
-	return count_nfes;
+	// Perform the re-evaluations in one go and update the cache
+	std::vector<fitness_vector> f_vecs;
+	std::vector<constraint_vector> c_vecs;
+	evaluate_racers(to_eval, f_vecs, c_vecs);
+	for(unsigned int i = 0; i < to_eval.size(); i++){
+		m_pop_wilcoxon.set_fc(to_eval_slots[i], f_vecs[i], c_vecs[i]);
+		if(m_use_caching)
+			cache_insert_data(to_eval[i], f_vecs[i], c_vecs[i]);
+	}
+	return to_eval.size();
+}
+
+// Evaluates the fitness and constraint vectors of some individuals of m_pop
+// under the current seed of the problem.
+//
+// The evaluations are independent of each other and go through the batch
+// interface of the problem. Hence, if a thread pool was set on the problem
+// (see problem::base::set_thread_pool()), they are dispatched in parallel,
+// each worker thread using its own copy of the problem cloned after the seed
+// was set. The cache is left untouched, and it is up to the caller to update
+// it afterwards from the calling thread.
+void race_pop::evaluate_racers(const std::vector<population::size_type> &idx, std::vector<fitness_vector> &f_vecs, std::vector<constraint_vector> &c_vecs) const
+{
+	std::vector<decision_vector> x(idx.size());
+	for(unsigned int i = 0; i < idx.size(); i++){
+		x[i] = m_pop.get_individual(idx[i]).cur_x;
+	}
+	m_pop.problem().objfun_batch(f_vecs, x);
+	m_pop.problem().compute_constraints_batch(c_vecs, x);
 }
 
 /// Computes the required number of actual fevals to complete the current iteration
@@ -56,6 +56,12 @@ namespace racing{
  * Currently the racing is implemented based on F-Race, which invokes Friedman
  * test iteratively during each race.
  *
+ * In each racing iteration, the individuals still in the race are re-evaluated
+ * under a common seed through the batch evaluation methods of the problem. If
+ * the problem has a thread pool (see problem::base::set_thread_pool()), these
+ * evaluations run in parallel on per-thread copies of the problem, and the
+ * result of the race does not depend on the number of threads.
+ *
  */
 class __PAGMO_VISIBLE race_pop
 {
@@ -99,6 +105,8 @@ private:
 	unsigned int prepare_population_friedman(const std::vector<population::size_type> &in_race, unsigned int count_iter);
 	unsigned int prepare_population_wilcoxon(const std::vector<population::size_type> &in_race, unsigned int count_iter);
 
+	void evaluate_racers(const std::vector<population::size_type> &, std::vector<fitness_vector> &, std::vector<constraint_vector> &) const;
+
 	unsigned int compute_required_fevals(const std::vector<population::size_type>& in_race, unsigned int num_iter) const;
 
 	// Atoms of the cache
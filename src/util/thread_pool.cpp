@@ -0,0 +1,271 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#include <algorithm>
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstddef>
+#include <stdexcept>
+
+#include "../exceptions.h"
+#include "thread_pool.h"
+
+namespace pagmo { namespace util {
+
+/// Destructor.
+thread_pool::task::~task() {}
+
+// Entry point of the worker threads.
+struct thread_pool::worker
+{
+	worker(thread_pool *p, unsigned int idx):m_p(p),m_idx(idx) {}
+	void operator()() const
+	{
+		m_p->worker_loop(m_idx);
+	}
+	thread_pool	*m_p;
+	unsigned int	m_idx;
+};
+
+/// Constructor.
+/**
+ * Will launch the worker threads, which will sleep until a job is submitted via run().
+ *
+ * @param[in] n_threads number of worker threads. If zero, the number of hardware threads available on the system will be used.
+ * @param[in] schedule scheduling policy.
+ *
+ * @throws value_error if schedule is not a valid scheduling policy.
+ * @throws std::runtime_error if the worker threads could not be launched.
+ */
+thread_pool::thread_pool(unsigned int n_threads, schedule_type schedule):m_schedule(schedule),m_task(0),m_generation(0),m_busy(0),m_stop(false)
+{
+	if (schedule != STATIC && schedule != WORK_STEALING) {
+		pagmo_throw(value_error,"invalid scheduling policy");
+	}
+	if (!n_threads) {
+		n_threads = std::max<unsigned int>(boost::thread::hardware_concurrency(),1u);
+	}
+	for (unsigned int i = 0; i < n_threads; ++i) {
+		m_ranges.push_back(boost::shared_ptr<range>(new range()));
+	}
+	try {
+		for (unsigned int i = 0; i < n_threads; ++i) {
+			m_threads.push_back(boost::shared_ptr<boost::thread>(new boost::thread(worker(this,i))));
+		}
+	} catch (...) {
+		{
+			boost::lock_guard<boost::mutex> lock(m_mutex);
+			m_stop = true;
+		}
+		m_start_cond.notify_all();
+		for (std::vector<boost::shared_ptr<boost::thread> >::size_type i = 0; i < m_threads.size(); ++i) {
+			m_threads[i]->join();
+		}
+		pagmo_throw(std::runtime_error,"failed to launch the thread");
+	}
+}
+
+/// Destructor.
+/**
+ * Will stop and join all the worker threads. Must not be called while a job is running.
+ */
+thread_pool::~thread_pool()
+{
+	{
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_start_cond.notify_all();
+	for (std::vector<boost::shared_ptr<boost::thread> >::size_type i = 0; i < m_threads.size(); ++i) {
+		m_threads[i]->join();
+	}
+}
+
+/// Get the number of worker threads.
+/**
+ * @return the number of worker threads in the pool.
+ */
+unsigned int thread_pool::get_n_threads() const
+{
+	return static_cast<unsigned int>(m_threads.size());
+}
+
+/// Get the scheduling policy.
+/**
+ * @return the scheduling policy of the pool.
+ */
+thread_pool::schedule_type thread_pool::get_schedule() const
+{
+	return m_schedule;
+}
+
+/// Run a job.
+/**
+ * Will invoke t(thread_idx,i) for each i in [0,n), distributing the calls among the worker threads according to the scheduling policy,
+ * and return when all the calls have completed. If one or more calls throw, the remaining indices are abandoned and the first exception
+ * thrown is re-thrown in the calling thread once all the workers have stopped.
+ *
+ * If invoked from one of the worker threads of this pool, the job will be run serially in the calling thread.
+ *
+ * @param[in] t job to be run.
+ * @param[in] n number of indices.
+ */
+void thread_pool::run(task &t, std::size_t n)
+{
+	if (!n) {
+		return;
+	}
+	unsigned int idx;
+	if (worker_index(idx)) {
+		for (std::size_t i = 0; i < n; ++i) {
+			t(idx,i);
+		}
+		return;
+	}
+	boost::lock_guard<boost::mutex> run_lock(m_run_mutex);
+	// Initial partitioning of [0,n) into contiguous blocks.
+	const std::size_t n_ranges = m_ranges.size(), block = n / n_ranges, rem = n % n_ranges;
+	for (std::size_t k = 0; k < n_ranges; ++k) {
+		boost::lock_guard<boost::mutex> lock(m_ranges[k]->m_mutex);
+		m_ranges[k]->m_begin = k * block + std::min(k,rem);
+		m_ranges[k]->m_end = m_ranges[k]->m_begin + block + (k < rem ? 1u : 0u);
+	}
+	boost::exception_ptr exc;
+	{
+		boost::unique_lock<boost::mutex> lock(m_mutex);
+		m_task = &t;
+		m_exception = boost::exception_ptr();
+		m_busy = get_n_threads();
+		++m_generation;
+		m_start_cond.notify_all();
+		while (m_busy) {
+			m_done_cond.wait(lock);
+		}
+		m_task = 0;
+		exc = m_exception;
+		m_exception = boost::exception_ptr();
+	}
+	if (exc) {
+		boost::rethrow_exception(exc);
+	}
+}
+
+// Main loop of the idx-th worker thread.
+void thread_pool::worker_loop(unsigned int idx)
+{
+	unsigned long generation = 0;
+	while (true) {
+		task *t;
+		{
+			boost::unique_lock<boost::mutex> lock(m_mutex);
+			while (!m_stop && m_generation == generation) {
+				m_start_cond.wait(lock);
+			}
+			if (m_stop) {
+				return;
+			}
+			generation = m_generation;
+			t = m_task;
+		}
+		try {
+			std::size_t i;
+			while (next_index(idx,i)) {
+				(*t)(idx,i);
+			}
+		} catch (...) {
+			{
+				boost::lock_guard<boost::mutex> lock(m_mutex);
+				if (!m_exception) {
+					m_exception = boost::current_exception();
+				}
+			}
+			// Abandon all the remaining work.
+			for (std::vector<boost::shared_ptr<range> >::size_type k = 0; k < m_ranges.size(); ++k) {
+				boost::lock_guard<boost::mutex> lock(m_ranges[k]->m_mutex);
+				m_ranges[k]->m_begin = m_ranges[k]->m_end;
+			}
+		}
+		boost::lock_guard<boost::mutex> lock(m_mutex);
+		pagmo_assert(m_busy);
+		if (!--m_busy) {
+			m_done_cond.notify_all();
+		}
+	}
+}
+
+// Fetch the next index to be processed by the idx-th worker. Return false if no work is left.
+bool thread_pool::next_index(unsigned int idx, std::size_t &i)
+{
+	range &own = *m_ranges[idx];
+	{
+		boost::lock_guard<boost::mutex> lock(own.m_mutex);
+		if (own.m_begin < own.m_end) {
+			i = own.m_begin++;
+			return true;
+		}
+	}
+	if (m_schedule == STATIC) {
+		return false;
+	}
+	// Steal the upper half of the remaining indices of the first non-empty victim.
+	const std::size_t n_ranges = m_ranges.size();
+	for (std::size_t k = 1; k < n_ranges; ++k) {
+		range &victim = *m_ranges[(idx + k) % n_ranges];
+		std::size_t begin, end;
+		{
+			boost::lock_guard<boost::mutex> lock(victim.m_mutex);
+			if (victim.m_begin >= victim.m_end) {
+				continue;
+			}
+			begin = victim.m_begin + (victim.m_end - victim.m_begin) / 2u;
+			end = victim.m_end;
+			victim.m_end = begin;
+		}
+		i = begin;
+		boost::lock_guard<boost::mutex> lock(own.m_mutex);
+		own.m_begin = begin + 1u;
+		own.m_end = end;
+		return true;
+	}
+	return false;
+}
+
+// Determine if the calling thread is a worker of this pool, and in that case store its index in idx.
+bool thread_pool::worker_index(unsigned int &idx) const
+{
+	const boost::thread::id id = boost::this_thread::get_id();
+	for (std::vector<boost::shared_ptr<boost::thread> >::size_type k = 0; k < m_threads.size(); ++k) {
+		if (m_threads[k]->get_id() == id) {
+			idx = static_cast<unsigned int>(k);
+			return true;
+		}
+	}
+	return false;
+}
+
+}}
@@ -0,0 +1,127 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+#ifndef PAGMO_UTIL_THREAD_POOL_H
+#define PAGMO_UTIL_THREAD_POOL_H
+
+#include <boost/exception_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/utility.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "../config.h"
+
+namespace pagmo { namespace util {
+
+class thread_pool;
+
+/// Shared pointer to a thread pool.
+typedef boost::shared_ptr<thread_pool> thread_pool_ptr;
+
+/// Pool of persistent worker threads.
+/**
+ * This class owns a fixed number of worker threads which are created at construction time and joined at destruction time.
+ * The pool executes data-parallel jobs: a job is a functor derived from thread_pool::task which is invoked once for each
+ * index in the range [0,n). Each invocation receives also the index of the worker thread executing it, so that tasks
+ * can keep per-thread state (e.g., a private copy of a problem) without any locking.
+ *
+ * Two scheduling policies are available:
+ * - thread_pool::STATIC: the index range is split into contiguous blocks of (almost) equal size, one per worker. This has
+ *   the lowest overhead and it is the best choice when all the invocations have similar cost;
+ * - thread_pool::WORK_STEALING: the index range is split as in the static policy, but a worker which runs out of work steals
+ *   half of the remaining indices of another worker. This is the best choice when the cost of the invocations varies
+ *   (e.g., trajectory problems whose evaluation time depends on the decision vector).
+ *
+ * Only one job at a time is run by the pool: concurrent calls to run() from different threads are serialised. A call to run()
+ * issued from within one of the workers of the same pool (i.e., a nested job) is executed serially in the calling thread.
+ */
+class __PAGMO_VISIBLE thread_pool: private boost::noncopyable
+{
+	public:
+		/// Scheduling policy.
+		enum schedule_type {
+			/// Contiguous blocks, one per worker.
+			STATIC = 0,
+			/// Contiguous blocks with work stealing.
+			WORK_STEALING = 1
+		};
+		/// Job to be run by the pool.
+		/**
+		 * Derived classes must implement the call operator, which will be invoked concurrently by the workers of the pool.
+		 */
+		class __PAGMO_VISIBLE task
+		{
+			public:
+				virtual ~task();
+				/// Execute the job for the i-th index.
+				/**
+				 * @param[in] thread_idx index of the worker thread, in the range [0,thread_pool::get_n_threads()).
+				 * @param[in] i index of the element to be processed.
+				 */
+				virtual void operator()(unsigned int thread_idx, std::size_t i) = 0;
+		};
+		explicit thread_pool(unsigned int n_threads = 0, schedule_type schedule = WORK_STEALING);
+		~thread_pool();
+		unsigned int get_n_threads() const;
+		schedule_type get_schedule() const;
+		void run(task &, std::size_t);
+	private:
+		// Range of indices assigned to a worker. It is protected by its own mutex so that
+		// other workers can steal from it.
+		struct range
+		{
+			range():m_begin(0),m_end(0) {}
+			boost::mutex	m_mutex;
+			std::size_t	m_begin;
+			std::size_t	m_end;
+		};
+		struct worker;
+		friend struct worker;
+		void worker_loop(unsigned int);
+		bool next_index(unsigned int, std::size_t &);
+		bool worker_index(unsigned int &) const;
+	private:
+		const schedule_type				m_schedule;
+		std::vector<boost::shared_ptr<boost::thread> >	m_threads;
+		std::vector<boost::shared_ptr<range> >		m_ranges;
+		// Serialises concurrent invocations of run().
+		boost::mutex					m_run_mutex;
+		// Protects the state below.
+		boost::mutex					m_mutex;
+		boost::condition_variable			m_start_cond;
+		boost::condition_variable			m_done_cond;
+		task						*m_task;
+		unsigned long					m_generation;
+		unsigned int					m_busy;
+		bool						m_stop;
+		boost::exception_ptr				m_exception;
+};
+
+}}
+
+#endif
@@ -0,0 +1,298 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Benchmark of the hypervolume algorithms.
+//
+// Times the hypervolume algorithms on generated fronts of several shapes, dimensions and sizes, and writes the results
+// as CSV (one line per measurement). Optionally derives from the results a calibration table for the algorithm selection
+// of pagmo::util::hypervolume, which can be loaded with pagmo::util::hv_calibration::load and installed with
+// pagmo::util::hypervolume::set_calibration.
+//
+// Usage: hypervolume_benchmark [--quick] [--csv FILE] [--calibration FILE] [--budget SECONDS] [--seed N]
+//
+//   --quick          smaller grid of dimensions and sizes
+//   --csv            file receiving the results (default: standard output)
+//   --calibration    file receiving the calibration table (default: none)
+//   --budget         an algorithm whose single run takes longer than this is not run on larger fronts (default: 1)
+//   --seed           seed of the generated fronts (default: 0)
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/math/constants/constants.hpp>
+#include "../src/rng.h"
+#include "../src/util/hypervolume.h"
+#include "../src/util/hv_calibration.h"
+
+using namespace pagmo;
+
+namespace {
+
+const double ref_coord = 1.1;
+const double min_time = 0.05;
+const unsigned int max_repetitions = 1000;
+
+/// Algorithm under test.
+struct algorithm_entry
+{
+	std::string name;
+	util::hv_algorithm::base_ptr algo;
+	util::hv_calibration::method_type method;
+	// approximate algorithms are timed but never selected by the calibration
+	bool exact;
+	// dimension handled by the algorithm, zero for any
+	unsigned int f_dim;
+};
+
+algorithm_entry make_entry(const std::string &name, const util::hv_algorithm::base_ptr algo, const util::hv_calibration::method_type method, const bool exact, const unsigned int f_dim)
+{
+	algorithm_entry e;
+	e.name = name;
+	e.algo = algo;
+	e.method = method;
+	e.exact = exact;
+	e.f_dim = f_dim;
+	return e;
+}
+
+/// Generate a front of n mutually non-dominated points of dimension d in [0,1]^d.
+std::vector<fitness_vector> make_front(const std::string &shape, const unsigned int n, const unsigned int d, rng_double &drng)
+{
+	std::vector<fitness_vector> points(n, fitness_vector(d));
+	for (unsigned int i = 0; i < n; ++i) {
+		fitness_vector &p = points[i];
+		if (shape == "linear") {
+			// uniform on the simplex
+			double sum = 0.;
+			for (unsigned int k = 0; k < d; ++k) {
+				p[k] = -std::log(1. - drng());
+				sum += p[k];
+			}
+			for (unsigned int k = 0; k < d; ++k) {
+				p[k] /= sum;
+			}
+		} else if (shape == "concave" || shape == "convex") {
+			// uniform on the positive orthant of the unit sphere, mirrored for the convex front
+			double norm = 0.;
+			for (unsigned int k = 0; k < d; ++k) {
+				const double u1 = 1. - drng(), u2 = drng();
+				p[k] = std::fabs(std::sqrt(-2. * std::log(u1)) * std::cos(2. * boost::math::constants::pi<double>() * u2)) + 1e-12;
+				norm += p[k] * p[k];
+			}
+			norm = std::sqrt(norm);
+			for (unsigned int k = 0; k < d; ++k) {
+				p[k] = (shape == "concave") ? p[k] / norm : 1. - p[k] / norm;
+			}
+		} else {
+			// degenerate front: a curve in the d-dimensional space
+			const double t = drng();
+			p[0] = t;
+			for (unsigned int k = 1; k < d; ++k) {
+				p[k] = std::pow(1. - t, static_cast<double>(k));
+			}
+		}
+	}
+	return points;
+}
+
+/// Run a single computation, returning its result.
+double run_once(const util::hypervolume &hv, const algorithm_entry &e, const fitness_vector &r_point)
+{
+	if (e.method == util::hv_calibration::COMPUTE) {
+		return hv.compute(r_point, e.algo);
+	}
+	return hv.least_contributor(r_point, e.algo);
+}
+
+/// Key of a calibration cell: method, dimension and number of points.
+typedef std::pair<std::pair<int, unsigned int>, unsigned int> cell_key;
+/// Total time and number of fronts measured for each algorithm in a cell.
+typedef std::map<std::string, std::pair<double, unsigned int> > cell_times;
+
+util::hv_calibration make_calibration(const std::map<cell_key, cell_times> &cells, const unsigned int n_fronts)
+{
+	util::hv_calibration table;
+	// method and dimension of the previous cell, algorithm selected up to it and its number of points
+	std::pair<int, unsigned int> current(-1, 0);
+	std::string winner;
+	unsigned int last_n = 0;
+	for (std::map<cell_key, cell_times>::const_iterator it = cells.begin(); it != cells.end(); ++it) {
+		std::string best;
+		double best_time = 0.;
+		for (cell_times::const_iterator a = it->second.begin(); a != it->second.end(); ++a) {
+			// only the algorithms measured on all the fronts compete
+			if (a->second.second == n_fronts && (best.empty() || a->second.first < best_time)) {
+				best = a->first;
+				best_time = a->second.first;
+			}
+		}
+		if (best.empty()) {
+			continue;
+		}
+		if (it->first.first != current) {
+			if (!winner.empty()) {
+				table.add(static_cast<util::hv_calibration::method_type>(current.first), current.second, 0, winner);
+			}
+			current = it->first.first;
+			winner = best;
+		} else if (best != winner) {
+			table.add(static_cast<util::hv_calibration::method_type>(current.first), current.second, last_n, winner);
+			winner = best;
+		}
+		last_n = it->first.second;
+	}
+	if (!winner.empty()) {
+		table.add(static_cast<util::hv_calibration::method_type>(current.first), current.second, 0, winner);
+	}
+	return table;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+	bool quick = false;
+	std::string csv_file, calibration_file;
+	double budget = 1.;
+	unsigned int seed = 0;
+	for (int i = 1; i < argc; ++i) {
+		const std::string arg(argv[i]);
+		if (arg == "--quick") {
+			quick = true;
+		} else if (arg == "--csv" && i + 1 < argc) {
+			csv_file = argv[++i];
+		} else if (arg == "--calibration" && i + 1 < argc) {
+			calibration_file = argv[++i];
+		} else if (arg == "--budget" && i + 1 < argc) {
+			budget = std::atof(argv[++i]);
+		} else if (arg == "--seed" && i + 1 < argc) {
+			seed = static_cast<unsigned int>(std::atol(argv[++i]));
+		} else {
+			std::cerr << "Usage: " << argv[0] << " [--quick] [--csv FILE] [--calibration FILE] [--budget SECONDS] [--seed N]" << std::endl;
+			return 1;
+		}
+	}
+
+	std::vector<unsigned int> dims, sizes;
+	const unsigned int max_dim = quick ? 5 : 8;
+	for (unsigned int d = 2; d <= max_dim; ++d) {
+		dims.push_back(d);
+	}
+	const unsigned int quick_sizes[] = {10, 50, 100};
+	const unsigned int full_sizes[] = {10, 20, 50, 100, 200, 500};
+	if (quick) {
+		sizes.assign(quick_sizes, quick_sizes + sizeof(quick_sizes) / sizeof(unsigned int));
+	} else {
+		sizes.assign(full_sizes, full_sizes + sizeof(full_sizes) / sizeof(unsigned int));
+	}
+	std::vector<std::string> shapes;
+	shapes.push_back("linear");
+	shapes.push_back("concave");
+	shapes.push_back("convex");
+	shapes.push_back("degenerate");
+
+	std::vector<algorithm_entry> algos;
+	const util::hv_calibration::method_type methods[] = {util::hv_calibration::COMPUTE, util::hv_calibration::CONTRIBUTIONS};
+	for (unsigned int m = 0; m < 2; ++m) {
+		algos.push_back(make_entry("hv2d", util::hv_algorithm::hv2d().clone(), methods[m], true, 2));
+		algos.push_back(make_entry("hv3d", util::hv_algorithm::hv3d().clone(), methods[m], true, 3));
+		algos.push_back(make_entry("hv4d", util::hv_algorithm::hv4d().clone(), methods[m], true, 4));
+		algos.push_back(make_entry("fpl", util::hv_algorithm::fpl().clone(), methods[m], true, 0));
+		algos.push_back(make_entry("wfg", util::hv_algorithm::wfg().clone(), methods[m], true, 0));
+		algos.push_back(make_entry("hoy", util::hv_algorithm::hoy().clone(), methods[m], true, 0));
+	}
+	algos.push_back(make_entry("bf_fpras", util::hv_algorithm::bf_fpras().clone(), util::hv_calibration::COMPUTE, false, 0));
+	algos.push_back(make_entry("bf_approx", util::hv_algorithm::bf_approx().clone(), util::hv_calibration::CONTRIBUTIONS, false, 0));
+
+	std::ofstream csv_ofs;
+	if (!csv_file.empty()) {
+		csv_ofs.open(csv_file.c_str());
+		if (!csv_ofs) {
+			std::cerr << "Cannot write " << csv_file << std::endl;
+			return 1;
+		}
+	}
+	std::ostream &csv = csv_file.empty() ? std::cout : csv_ofs;
+	csv.precision(15);
+	csv << "method,algorithm,exact,front,f_dim,n,seconds,repetitions,value\n";
+
+	rng_double drng(seed);
+	std::map<cell_key, cell_times> cells;
+	for (unsigned int s = 0; s < shapes.size(); ++s) {
+		for (unsigned int di = 0; di < dims.size(); ++di) {
+			const unsigned int d = dims[di];
+			const fitness_vector r_point(d, ref_coord);
+			// algorithms which exceeded the budget on a smaller front
+			std::vector<bool> too_slow(algos.size(), false);
+			for (unsigned int ni = 0; ni < sizes.size(); ++ni) {
+				const unsigned int n = sizes[ni];
+				const util::hypervolume hv(make_front(shapes[s], n, d, drng), false);
+				std::cerr << shapes[s] << " front, f_dim = " << d << ", n = " << n << std::endl;
+				for (unsigned int a = 0; a < algos.size(); ++a) {
+					const algorithm_entry &e = algos[a];
+					if (too_slow[a] || (e.f_dim != 0 && e.f_dim != d)) {
+						continue;
+					}
+					unsigned int reps = 0;
+					double value = 0., elapsed = 0.;
+					const boost::posix_time::ptime start = boost::posix_time::microsec_clock::local_time();
+					do {
+						value = run_once(hv, e, r_point);
+						++reps;
+						elapsed = (boost::posix_time::microsec_clock::local_time() - start).total_microseconds() * 1e-6;
+					} while (elapsed < min_time && reps < max_repetitions);
+					const double seconds = elapsed / reps;
+					if (seconds > budget) {
+						too_slow[a] = true;
+					}
+					csv << util::hv_calibration::method_name(e.method) << ',' << e.name << ',' << (e.exact ? 1 : 0) << ','
+						<< shapes[s] << ',' << d << ',' << n << ',' << seconds << ',' << reps << ',' << value << '\n';
+					if (e.exact) {
+						std::pair<double, unsigned int> &t = cells[cell_key(std::make_pair(static_cast<int>(e.method), d), n)][e.name];
+						t.first += seconds;
+						++t.second;
+					}
+				}
+			}
+		}
+	}
+	csv.flush();
+
+	if (!calibration_file.empty()) {
+		try {
+			make_calibration(cells, shapes.size()).save(calibration_file);
+		} catch (const std::exception &ex) {
+			std::cerr << ex.what() << std::endl;
+			return 1;
+		}
+		std::cerr << "Calibration table written to " << calibration_file << std::endl;
+	}
+	return 0;
+}
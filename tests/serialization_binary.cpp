@@ -0,0 +1,135 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the binary serialization of vectors of doubles and populations
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Bitwise comparison of vectors of doubles.
+static bool bit_equal(const std::vector<double> &v1, const std::vector<double> &v2)
+{
+	return v1.size() == v2.size() && (v1.empty() || std::memcmp(&v1[0],&v2[0],v1.size() * sizeof(double)) == 0);
+}
+
+// Round-trip of a vector of doubles through an archive, using the given class version.
+template <class OArchive, class IArchive>
+static std::vector<double> round_trip(const std::vector<double> &v, unsigned int version)
+{
+	std::stringstream ss;
+	{
+		OArchive oa(ss);
+		custom_vector_double_save(oa,v,version);
+	}
+	std::vector<double> retval;
+	{
+		IArchive ia(ss);
+		custom_vector_double_load(ia,retval,version);
+	}
+	return retval;
+}
+
+int test_vector_double()
+{
+	std::cout << "Testing serialization of vectors of doubles... ";
+	std::vector<double> v;
+	v.push_back(0.1);
+	v.push_back(-0.);
+	v.push_back(std::numeric_limits<double>::denorm_min());
+	v.push_back(std::numeric_limits<double>::max());
+	v.push_back(std::numeric_limits<double>::infinity());
+	v.push_back(-std::numeric_limits<double>::infinity());
+	v.push_back(std::numeric_limits<double>::quiet_NaN());
+	// The binary representation must be bit-exact.
+	if (!bit_equal(v,round_trip<boost::archive::binary_oarchive,boost::archive::binary_iarchive>(v,binary_vector_double_version))) {
+		std::cout << "binary representation is not exact!" << std::endl;
+		return 1;
+	}
+	// The textual representation, used by text archives and by old binary archives, must preserve non-finite values.
+	// Denormalised numbers are not supported by the textual representation.
+	v[2] = 1E-300;
+	const std::vector<double> v_text = round_trip<boost::archive::text_oarchive,boost::archive::text_iarchive>(v,binary_vector_double_version),
+		v_old = round_trip<boost::archive::binary_oarchive,boost::archive::binary_iarchive>(v,0);
+	// NOTE: compare the bit patterns, as comparisons involving non-finite values are not reliable under -ffast-math.
+	if (!bit_equal(v,v_text) || !bit_equal(v,v_old)) {
+		std::cout << "textual representation is not exact!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Round-trip of a population through an archive.
+template <class OArchive, class IArchive>
+int test_population(const problem::base &prob)
+{
+	std::cout << "Testing serialization of population on " << prob.get_name() << "... ";
+	const population pop(prob,20,123);
+	std::stringstream ss;
+	{
+		OArchive oa(ss);
+		oa << pop;
+	}
+	population pop_new(problem::ackley(1),0);
+	{
+		IArchive ia(ss);
+		ia >> pop_new;
+	}
+	if (pop_new.size() != pop.size() || pop_new.problem().get_name() != prob.get_name()) {
+		std::cout << "wrong population!" << std::endl;
+		return 1;
+	}
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		const population::individual_type &ind1 = pop.get_individual(i), &ind2 = pop_new.get_individual(i);
+		if (!bit_equal(ind1.cur_x,ind2.cur_x) || !bit_equal(ind1.cur_v,ind2.cur_v) || !bit_equal(ind1.cur_f,ind2.cur_f) ||
+			!bit_equal(ind1.cur_c,ind2.cur_c) || !bit_equal(ind1.best_x,ind2.best_x) || !bit_equal(ind1.best_f,ind2.best_f) ||
+			!bit_equal(ind1.best_c,ind2.best_c) || pop.get_domination_count(i) != pop_new.get_domination_count(i))
+		{
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	int retval = test_vector_double();
+	retval += test_population<boost::archive::binary_oarchive,boost::archive::binary_iarchive>(problem::zdt(1,10));
+	retval += test_population<boost::archive::binary_oarchive,boost::archive::binary_iarchive>(problem::cec2006(4));
+	retval += test_population<boost::archive::text_oarchive,boost::archive::text_iarchive>(problem::zdt(1,10));
+	return retval;
+}
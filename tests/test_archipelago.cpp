@@ -22,11 +22,12 @@
  *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
  *****************************************************************************/
 
-// Test for getters and setters
+// Test for getters and setters, for the evolution on a pool of threads, for migration and for telemetry
 
 #include <iostream>
 #include <algorithm>
 #include <cmath>
+#include <string>
 #include <vector>
 #include <cassert>
 #include "../src/pagmo.h"
@@ -50,6 +51,114 @@ int test_distribution_type() {
 	return 0;
 }
 
+// Evolve an archipelago with a pool of threads smaller than the number of islands.
+int test_pool() {
+	archipelago a(algorithm::de(10),problem::rosenbrock(10),12,20,topology::ring());
+	a.set_pool_size(3);
+	if (a.get_pool_size() != 3) {
+		return 1;
+	}
+	const double before = a.get_island(0)->get_population().champion().f[0];
+	a.evolve(5);
+	a.join();
+	if (a.busy() || a.get_island(0)->get_population().champion().f[0] > before) {
+		return 1;
+	}
+	// Timed evolution and interruption.
+	a.evolve_t(50);
+	a.join();
+	a.evolve(1000000);
+	a.interrupt();
+	if (a.busy()) {
+		return 1;
+	}
+	// Interruption of idle workers waiting for an island to evolve.
+	for (int i = 0; i < 10; ++i) {
+		archipelago c(algorithm::de(10),problem::rosenbrock(10),2,20,topology::ring());
+		c.set_pool_size(4);
+		c.evolve(1000000);
+		c.interrupt();
+		if (c.busy()) {
+			return 1;
+		}
+	}
+	// The pool size must survive copies.
+	archipelago b(a);
+	if (b.get_pool_size() != 3) {
+		return 1;
+	}
+	return 0;
+}
+
+// Check that migration takes place for all combinations of migration attributes, and that pending
+// migrants and history survive copies.
+int test_migration() {
+	const archipelago::distribution_type types[] = {archipelago::point_to_point, archipelago::broadcast};
+	const archipelago::migration_direction dirs[] = {archipelago::source, archipelago::destination};
+	for (int i = 0; i < 2; ++i) {
+		for (int j = 0; j < 2; ++j) {
+			archipelago a(algorithm::de(5),problem::rosenbrock(10),8,20,topology::ring(),types[i],dirs[j]);
+			a.set_pool_size(i + 1);
+			a.evolve(20);
+			a.join();
+			const std::string hist = a.dump_migr_history();
+			if (hist.empty()) {
+				return 1;
+			}
+			archipelago b(a);
+			if (b.dump_migr_history() != hist) {
+				return 1;
+			}
+			b.evolve(5);
+			b.join();
+			a.clear_migr_history();
+			if (!a.dump_migr_history().empty() || b.dump_migr_history().size() <= hist.size()) {
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+// Check the telemetry collected by the islands, both with one thread per island and with a pool of threads.
+int test_telemetry() {
+	problem::rosenbrock prob(10);
+	prob.set_objfun_timing(true);
+	// Without the cache every evaluation requested by the algorithm is counted.
+	prob.set_cache_capacity(0);
+	for (unsigned pool = 0; pool < 2; ++pool) {
+		archipelago a(algorithm::de(5),prob,4,20,topology::unconnected());
+		a.set_pool_size(pool);
+		a.evolve(3);
+		a.join();
+		for (archipelago::size_type i = 0; i < a.get_size(); ++i) {
+			const base_island::telemetry_type t = a.get_island(i)->get_telemetry();
+			if (t.n_evolutions != 3 || t.fevals != 5 * 20 * 3 || t.min_evo_time > t.max_evo_time || t.evo_time < t.objfun_time) {
+				return 1;
+			}
+		}
+		// Header plus one line per island.
+		const std::string csv = a.dump_telemetry(archipelago::csv);
+		if (std::count(csv.begin(),csv.end(),'\n') != 5 || csv.find("Differential Evolution") == std::string::npos) {
+			return 1;
+		}
+		const std::string json = a.dump_telemetry(archipelago::json);
+		if (json[0] != '[' || std::count(json.begin(),json.end(),'{') != 4) {
+			return 1;
+		}
+		// Telemetry survives copies and can be reset.
+		archipelago b(a);
+		if (b.dump_telemetry() != csv) {
+			return 1;
+		}
+		a.reset_telemetry();
+		if (a.get_island(0)->get_telemetry().n_evolutions != 0 || b.get_island(0)->get_telemetry().n_evolutions != 3) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
 int main() {
-	return test_distribution_type();
+	return test_distribution_type() + test_pool() + test_migration() + test_telemetry();
 }
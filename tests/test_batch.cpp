@@ -0,0 +1,218 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the batch evaluation of problems and populations
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+#include "../src/pagmo.h"
+#include "../src/util/thread_pool.h"
+
+using namespace pagmo;
+
+// Check that objfun_batch() and compute_constraints_batch() give the same results as
+// objfun() and compute_constraints(), and that the evaluation counters are updated accordingly.
+int test_problem_batch(const problem::base &prob)
+{
+	std::cout << "Testing batch evaluation of " << prob.get_name() << "... ";
+	population pop(prob,20,123);
+	std::vector<decision_vector> x;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		x.push_back(pop.get_individual(i).cur_x);
+	}
+	problem::base_ptr prob_batch = prob.clone(), prob_single = prob.clone();
+	std::vector<fitness_vector> f;
+	std::vector<constraint_vector> c;
+	prob_batch->objfun_batch(f,x);
+	prob_batch->compute_constraints_batch(c,x);
+	if (f.size() != x.size() || c.size() != x.size()) {
+		std::cout << "wrong output size!" << std::endl;
+		return 1;
+	}
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		if (f[i] != prob_single->objfun(x[i]) || c[i] != prob_single->compute_constraints(x[i])) {
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	if (prob_batch->get_fevals() != prob_single->get_fevals() || prob_batch->get_cevals() != prob_single->get_cevals()) {
+		std::cout << "wrong evaluation counters!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that population::push_back_batch() and population::set_x_batch() give the same individuals as
+// the corresponding one-at-a-time methods.
+int test_population_batch(const problem::base &prob)
+{
+	std::cout << "Testing population batch methods on " << prob.get_name() << "... ";
+	population source(prob,20,123);
+	std::vector<decision_vector> x;
+	std::vector<population::size_type> idx;
+	for (population::size_type i = 0; i < source.size(); ++i) {
+		x.push_back(source.get_individual(i).cur_x);
+		idx.push_back(source.size() - i - 1);
+	}
+	population pop_batch(prob,0,456), pop_single(prob,0,456);
+	pop_batch.push_back_batch(x);
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		pop_single.push_back(x[i]);
+	}
+	pop_batch.set_x_batch(idx,x);
+	for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+		pop_single.set_x(idx[i],x[i]);
+	}
+	for (population::size_type i = 0; i < pop_batch.size(); ++i) {
+		const population::individual_type &ind1 = pop_batch.get_individual(i), &ind2 = pop_single.get_individual(i);
+		if (ind1.cur_x != ind2.cur_x || ind1.cur_v != ind2.cur_v || ind1.cur_f != ind2.cur_f || ind1.cur_c != ind2.cur_c ||
+			ind1.best_x != ind2.best_x || ind1.best_f != ind2.best_f || ind1.best_c != ind2.best_c ||
+			pop_batch.get_domination_count(i) != pop_single.get_domination_count(i))
+		{
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	if (pop_batch.champion().x != pop_single.champion().x) {
+		std::cout << "champion mismatch!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that batch evaluations on thread pools with different sizes and scheduling policies give the same results
+// as the serial evaluation.
+int test_parallel_batch(const problem::base &prob)
+{
+	std::cout << "Testing parallel batch evaluation of " << prob.get_name() << "... ";
+	population pop(prob,50,123);
+	std::vector<decision_vector> x;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		x.push_back(pop.get_individual(i).cur_x);
+	}
+	std::vector<fitness_vector> f_serial, f;
+	std::vector<constraint_vector> c_serial, c;
+	prob.clone()->objfun_batch(f_serial,x);
+	prob.clone()->compute_constraints_batch(c_serial,x);
+	const util::thread_pool::schedule_type schedules[] = {util::thread_pool::STATIC, util::thread_pool::WORK_STEALING};
+	const unsigned int n_threads[] = {1u, 3u, 8u};
+	for (int i = 0; i < 2; ++i) {
+		for (int j = 0; j < 3; ++j) {
+			problem::base_ptr prob_par = prob.clone();
+			prob_par->set_thread_pool(util::thread_pool_ptr(new util::thread_pool(n_threads[j],schedules[i])));
+			// NOTE: some problems perform evaluations upon construction.
+			const unsigned int fevals = prob_par->get_fevals(), cevals = prob_par->get_cevals();
+			prob_par->objfun_batch(f,x);
+			prob_par->compute_constraints_batch(c,x);
+			if (f != f_serial || c != c_serial) {
+				std::cout << "mismatch with " << n_threads[j] << " threads!" << std::endl;
+				return 1;
+			}
+			if (prob_par->get_fevals() - fevals != x.size() || (prob_par->get_c_dimension() && prob_par->get_cevals() - cevals != x.size())) {
+				std::cout << "wrong evaluation counters!" << std::endl;
+				return 1;
+			}
+		}
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that population::get_matrix() copies the members of the individuals in row-major order.
+int test_population_matrix(const problem::base &prob)
+{
+	std::cout << "Testing population matrices on " << prob.get_name() << "... ";
+	population pop(prob,20,123);
+	std::vector<double> x, f, c;
+	pop.get_matrix(x,population::CUR_X);
+	pop.get_matrix(f,population::BEST_F);
+	pop.get_matrix(c,population::CUR_C);
+	const problem::base::size_type n = prob.get_dimension();
+	const problem::base::f_size_type nf = prob.get_f_dimension();
+	const problem::base::c_size_type nc = prob.get_c_dimension();
+	if (x.size() != pop.size() * n || f.size() != pop.size() * nf || c.size() != pop.size() * nc) {
+		std::cout << "wrong matrix size!" << std::endl;
+		return 1;
+	}
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		const population::individual_type &ind = pop.get_individual(i);
+		if (!std::equal(ind.cur_x.begin(),ind.cur_x.end(),x.begin() + i * n) || !std::equal(ind.best_f.begin(),ind.best_f.end(),f.begin() + i * nf) ||
+			!std::equal(ind.cur_c.begin(),ind.cur_c.end(),c.begin() + i * nc))
+		{
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Job throwing on a given index.
+struct throwing_task: util::thread_pool::task
+{
+	void operator()(unsigned int, std::size_t i)
+	{
+		if (i == 7u) {
+			pagmo_throw(value_error,"test exception");
+		}
+	}
+};
+
+// Check that exceptions thrown by the jobs are propagated to the caller, and that the pool is still usable afterwards.
+int test_thread_pool_exception()
+{
+	std::cout << "Testing exception propagation in thread pool... ";
+	util::thread_pool pool(4);
+	throwing_task t;
+	for (int k = 0; k < 2; ++k) {
+		try {
+			pool.run(t,100);
+			std::cout << "exception was not propagated!" << std::endl;
+			return 1;
+		} catch (const value_error &) {}
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	std::vector<problem::base_ptr> probs;
+	probs.push_back(problem::ackley(10).clone());
+	probs.push_back(problem::zdt(1,10).clone());
+	probs.push_back(problem::luksan_vlcek_1(5).clone());
+	probs.push_back(problem::cec2006(4).clone());
+	int retval = 0;
+	for (std::vector<problem::base_ptr>::size_type i = 0; i < probs.size(); ++i) {
+		retval += test_problem_batch(*probs[i]);
+		retval += test_population_batch(*probs[i]);
+		retval += test_parallel_batch(*probs[i]);
+		retval += test_population_matrix(*probs[i]);
+	}
+	retval += test_thread_pool_exception();
+	return retval;
+}
@@ -0,0 +1,118 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the fitness/constraint cache of problems
+
+#include <iostream>
+#include <vector>
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Check hits, misses and least-recently-used eviction.
+int test_lru()
+{
+	std::cout << "Testing LRU eviction... ";
+	problem::cec2006 prob(4);
+	prob.set_cache_capacity(3);
+	population pop(prob,5,123);
+	std::vector<decision_vector> x;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		x.push_back(pop.get_individual(i).cur_x);
+	}
+	prob.reset_caches();
+	const unsigned int fevals = prob.get_fevals();
+	const unsigned long hits = prob.get_cache_hits(), misses = prob.get_cache_misses();
+	// Fill the cache with x0, x1, x2, then touch x0 so that x1 becomes the least recently used.
+	prob.objfun(x[0]);
+	prob.objfun(x[1]);
+	prob.objfun(x[2]);
+	prob.objfun(x[0]);
+	// Inserting x3 evicts x1.
+	prob.objfun(x[3]);
+	prob.objfun(x[0]);
+	prob.objfun(x[2]);
+	if (prob.get_fevals() - fevals != 4u || prob.get_cache_hits() - hits != 3u || prob.get_cache_misses() - misses != 4u) {
+		std::cout << "wrong counters before eviction check!" << std::endl;
+		return 1;
+	}
+	prob.objfun(x[1]);
+	if (prob.get_fevals() - fevals != 5u) {
+		std::cout << "least recently used entry was not evicted!" << std::endl;
+		return 1;
+	}
+	// Constraints share the entries of the fitnesses, but are computed separately.
+	const unsigned int cevals = prob.get_cevals();
+	prob.compute_constraints(x[1]);
+	prob.compute_constraints(x[1]);
+	if (prob.get_cevals() - cevals != 1u) {
+		std::cout << "constraints were not cached!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that a null capacity disables the cache, and that cached values are correct.
+int test_capacity()
+{
+	std::cout << "Testing cache capacity... ";
+	problem::zdt prob(1,10);
+	population pop(prob,50,456);
+	std::vector<decision_vector> x;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		x.push_back(pop.get_individual(i).cur_x);
+	}
+	problem::base_ptr no_cache = prob.clone(), big_cache = prob.clone();
+	no_cache->set_cache_capacity(0);
+	big_cache->set_cache_capacity(100);
+	for (int k = 0; k < 2; ++k) {
+		for (std::vector<decision_vector>::size_type i = 0; i < x.size(); ++i) {
+			if (no_cache->objfun(x[i]) != big_cache->objfun(x[i])) {
+				std::cout << "mismatch at index " << i << "!" << std::endl;
+				return 1;
+			}
+		}
+	}
+	if (no_cache->get_fevals() != 2u * x.size() || big_cache->get_fevals() != x.size() || big_cache->get_cache_hits() != x.size()) {
+		std::cout << "wrong evaluation counters!" << std::endl;
+		return 1;
+	}
+	// Batch evaluation must not re-evaluate cached decision vectors.
+	std::vector<fitness_vector> f;
+	x.push_back(pop.get_individual(0).best_x);
+	x.back()[0] = 0.5;
+	big_cache->objfun_batch(f,x);
+	if (big_cache->get_fevals() != x.size() || f.back() != no_cache->objfun(x.back())) {
+		std::cout << "wrong batch evaluation!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	return test_lru() + test_capacity();
+}
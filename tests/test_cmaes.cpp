@@ -0,0 +1,170 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the CMA-ES algorithm
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <cmath>
+
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/serialization/split_member.hpp>
+
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Champion of a seeded run of two evolve() calls of 16 generations on a 10-dimensional Rosenbrock,
+// as computed by the implementation which sampled each offspring as mean + sigma * B * D * z and
+// accumulated the rank-mu update of the covariance matrix one elite at a time.
+const double reference_f = 187.80114898502282;
+const double reference_x[] = {0.048674500494456541, 0.25122241016315716, 0.07859095681537405, 0.76944373038010105, 0.68355525676667617,
+	0.44159097297145983, 1.0206526524780732, 1.5698575731261091, 2.3470206518219348, 5.0605827815725499};
+const double REL_TOL = 1e-6;
+
+bool is_close(double a, double b)
+{
+	return std::fabs(a - b) <= REL_TOL * std::max(1.0, std::fabs(b));
+}
+
+// Stand-in for the version 0 layout of cmaes, in which the offspring were archived as a vector of columns.
+// It loads the current layout, and saves the old one.
+class cmaes_v0: public algorithm::base
+{
+	public:
+		void evolve(population &) const {}
+		algorithm::base_ptr clone() const
+		{
+			return algorithm::base_ptr(new cmaes_v0(*this));
+		}
+	private:
+		friend class boost::serialization::access;
+		template <class Archive>
+		void save(Archive &ar, const unsigned int) const
+		{
+			ar << boost::serialization::base_object<algorithm::base>(*this);
+			ar << m_gen << m_cc << m_cs << m_c1 << m_cmu << m_sigma << m_xtol << m_ftol << m_memory << m_mean << m_variation;
+			std::vector<Eigen::VectorXd> newpop;
+			for (int i = 0; i < m_newpop.cols(); ++i) {
+				newpop.push_back(m_newpop.col(i));
+			}
+			ar << newpop;
+			ar << m_B << m_D << m_C << m_invsqrtC << m_pc << m_ps << m_counteval << m_eigeneval;
+		}
+		template <class Archive>
+		void load(Archive &ar, const unsigned int)
+		{
+			ar >> boost::serialization::base_object<algorithm::base>(*this);
+			ar >> m_gen >> m_cc >> m_cs >> m_c1 >> m_cmu >> m_sigma >> m_xtol >> m_ftol >> m_memory >> m_mean >> m_variation;
+			ar >> m_newpop;
+			ar >> m_B >> m_D >> m_C >> m_invsqrtC >> m_pc >> m_ps >> m_counteval >> m_eigeneval;
+		}
+		BOOST_SERIALIZATION_SPLIT_MEMBER()
+		std::size_t m_gen;
+		double m_cc, m_cs, m_c1, m_cmu, m_sigma, m_ftol, m_xtol;
+		bool m_memory;
+		Eigen::VectorXd m_mean, m_variation;
+		Eigen::MatrixXd m_newpop, m_B, m_D, m_C, m_invsqrtC;
+		Eigen::VectorXd m_pc, m_ps;
+		int m_counteval, m_eigeneval;
+};
+
+// A seeded run must reproduce the results of the previous sampling and covariance update, up to rounding.
+int test_cmaes_regression()
+{
+	problem::rosenbrock prob(10);
+	rng_generator::set_seed(42);
+	population pop(prob,20);
+	algorithm::cmaes algo(16);
+	algo.reset_rngs(123);
+	algo.evolve(pop);
+	algo.evolve(pop);
+	if (!is_close(pop.champion().f[0],reference_f)) {
+		std::cout << "champion fitness " << std::setprecision(17) << pop.champion().f[0] << ", expected " << reference_f << std::endl;
+		return 1;
+	}
+	for (problem::base::size_type i = 0; i < prob.get_dimension(); ++i) {
+		if (!is_close(pop.champion().x[i],reference_x[i])) {
+			std::cout << "champion x[" << i << "] " << std::setprecision(17) << pop.champion().x[i] << ", expected " << reference_x[i] << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// An archive written before the offspring were stored as a matrix must restore the memory of the algorithm:
+// the restored algorithm continues the evolution exactly as the original one.
+int test_cmaes_version_0()
+{
+	problem::rosenbrock prob(10);
+	rng_generator::set_seed(42);
+	population pop(prob,20);
+	algorithm::cmaes algo(10);
+	algo.reset_rngs(123);
+	algo.evolve(pop);
+
+	// Current archive -> stand-in -> version 0 archive -> cmaes
+	std::stringstream ss_current, ss_v0;
+	{
+		boost::archive::text_oarchive oa(ss_current);
+		oa << algo;
+	}
+	cmaes_v0 v0;
+	{
+		boost::archive::text_iarchive ia(ss_current);
+		ia >> v0;
+	}
+	{
+		boost::archive::text_oarchive oa(ss_v0);
+		oa << v0;
+	}
+	algorithm::cmaes restored(1);
+	{
+		boost::archive::text_iarchive ia(ss_v0);
+		ia >> restored;
+	}
+
+	population pop_restored(pop);
+	algo.evolve(pop);
+	restored.evolve(pop_restored);
+	if (pop.champion().f != pop_restored.champion().f || pop.champion().x != pop_restored.champion().x) {
+		std::cout << "the algorithm restored from a version 0 archive evolved differently" << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	std::cout << "Testing CMA-ES against the previous update: ";
+	if (test_cmaes_regression()) return 1;
+	std::cout << "SUCCESS" << std::endl;
+	std::cout << "Testing CMA-ES version 0 archives: ";
+	if (test_cmaes_version_0()) return 1;
+	std::cout << "SUCCESS" << std::endl;
+	return 0;
+}
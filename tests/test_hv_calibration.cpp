@@ -0,0 +1,121 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test for the calibration table of the hypervolume algorithm selection.
+
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/pagmo.h"
+#include "../src/util/hypervolume.h"
+#include "../src/util/hv_calibration.h"
+
+using namespace pagmo;
+using namespace pagmo::util;
+
+static int test_table()
+{
+	std::istringstream is(
+		"# method f_dim n_max algorithm\n"
+		"compute 5 0 wfg\n"
+		"\n"
+		"compute 5 80 fpl\n"
+		"contributions 4 20 hoy\n"
+		"compute 5 10 hoy\n");
+	hv_calibration table;
+	table.load(is);
+	if (table.get_entries().size() != 4 || table.select(hv_calibration::COMPUTE, 5, 5) != "hoy" ||
+		table.select(hv_calibration::COMPUTE, 5, 11) != "fpl" || table.select(hv_calibration::COMPUTE, 5, 80) != "fpl" ||
+		table.select(hv_calibration::COMPUTE, 5, 81) != "wfg" || table.select(hv_calibration::CONTRIBUTIONS, 4, 20) != "hoy" ||
+		table.select(hv_calibration::CONTRIBUTIONS, 4, 21) != "" || table.select(hv_calibration::COMPUTE, 6, 5) != "")
+	{
+		std::cout << "wrong selection\n";
+		return 1;
+	}
+	// Saving and loading gives back the same table.
+	std::stringstream ss;
+	table.save(ss);
+	hv_calibration loaded;
+	loaded.load(ss);
+	std::ostringstream os1, os2;
+	table.save(os1);
+	loaded.save(os2);
+	if (os1.str() != os2.str()) {
+		std::cout << "wrong save/load round trip\n";
+		return 1;
+	}
+	// Invalid tables are rejected, and leave the table untouched.
+	const char *invalid[] = {"compute 5 0\n", "compute 5 0 wfg extra\n", "exclusive 5 0 wfg\n", "compute 3 0 hv2d\n", "compute 5 0 bf_fpras\n", "compute 1 0 wfg\n"};
+	for (unsigned int i = 0; i < sizeof(invalid) / sizeof(const char *); ++i) {
+		std::istringstream bad(invalid[i]);
+		try {
+			loaded.load(bad);
+			std::cout << "invalid table accepted: " << invalid[i];
+			return 1;
+		} catch (const value_error &) {}
+	}
+	std::ostringstream os3;
+	loaded.save(os3);
+	if (os3.str() != os1.str()) {
+		std::cout << "table altered by an invalid input\n";
+		return 1;
+	}
+	return 0;
+}
+
+static int test_selection()
+{
+	population pop(problem::dtlz(2,10,5),30);
+	hypervolume hv(boost::shared_ptr<population>(new population(pop)));
+	const fitness_vector r = hv.get_nadir_point(1.);
+	const double expected = hv.compute(r,hv_algorithm::wfg().clone());
+
+	hv_calibration table;
+	table.add(hv_calibration::COMPUTE, 5, 0, "hoy");
+	table.add(hv_calibration::CONTRIBUTIONS, 5, 0, "hoy");
+	hypervolume::set_calibration(table);
+	if (hypervolume::get_calibration().select(hv_calibration::COMPUTE, 5, 30) != "hoy") {
+		std::cout << "calibration not installed\n";
+		return 1;
+	}
+	const double calibrated = hv.compute(r);
+	const unsigned int lc = hv.least_contributor(r);
+	hypervolume::reset_calibration();
+	if (!hypervolume::get_calibration().empty()) {
+		std::cout << "calibration not reset\n";
+		return 1;
+	}
+	if (std::fabs(calibrated - expected) > 1e-10 * expected || lc != hv.least_contributor(r,hv_algorithm::hoy().clone())) {
+		std::cout << "wrong result with the calibrated selection\n";
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	return test_table() + test_selection();
+}
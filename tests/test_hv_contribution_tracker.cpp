@@ -0,0 +1,148 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test for the incremental tracking of hypervolume contributions: after random sequences of insertions and removals
+// the tracked contributions must match the ones computed from scratch.
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "../src/exceptions.h"
+#include "../src/util/hypervolume.h"
+#include "../src/util/hv_contribution_tracker.h"
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+typedef util::hv_contribution_tracker::id_type id_type;
+
+// Random point on the positive orthant of the unit sphere. Such points are mutually non-dominated.
+static fitness_vector random_point(boost::variate_generator<boost::mt19937 &, boost::uniform_real<double> > &drng, unsigned dim)
+{
+	fitness_vector p(dim);
+	double norm = 0;
+	for (unsigned i = 0; i < dim; ++i) {
+		p[i] = drng() + 1e-3;
+		norm += p[i] * p[i];
+	}
+	for (unsigned i = 0; i < dim; ++i) {
+		p[i] /= std::sqrt(norm);
+	}
+	return p;
+}
+
+// Compare the tracked contributions with those computed from scratch.
+static int check(const util::hv_contribution_tracker &t, const std::vector<id_type> &ids)
+{
+	std::vector<fitness_vector> points;
+	for (std::vector<id_type>::size_type i = 0; i < ids.size(); ++i) {
+		points.push_back(t.get_point(ids[i]));
+	}
+	if (t.size() != ids.size()) {
+		return 1;
+	}
+	if (points.empty()) {
+		return 0;
+	}
+	// WFG is the reference, as the tracker and the automatic choice of the algorithm share HV4D in 4 dimensions.
+	const std::vector<double> c = util::hypervolume(points).contributions(t.get_reference_point(),util::hv_algorithm::wfg().clone());
+	double least = c[0];
+	for (std::vector<id_type>::size_type i = 0; i < ids.size(); ++i) {
+		if (std::abs(t.contribution(ids[i]) - c[i]) > 1e-9) {
+			std::cout << "wrong contribution in dimension " << t.get_reference_point().size() << ": " << t.contribution(ids[i]) << " vs " << c[i] << '\n';
+			return 1;
+		}
+		least = std::min(least,c[i]);
+	}
+	return std::abs(t.contribution(t.least_contributor()) - least) > 1e-9;
+}
+
+static int test_random(unsigned dim)
+{
+	boost::mt19937 rng(dim);
+	boost::variate_generator<boost::mt19937 &, boost::uniform_real<double> > drng(rng,boost::uniform_real<double>(0,1));
+	const fitness_vector r(dim,1.1);
+	std::vector<fitness_vector> initial;
+	for (int i = 0; i < 20; ++i) {
+		initial.push_back(random_point(drng,dim));
+	}
+	// Include a duplicate point.
+	initial.push_back(initial[3]);
+	util::hv_contribution_tracker t(initial,r);
+	std::vector<id_type> ids;
+	for (id_type i = 0; i < initial.size(); ++i) {
+		ids.push_back(i);
+	}
+	if (check(t,ids)) {
+		return 1;
+	}
+	for (int i = 0; i < 60; ++i) {
+		if (drng() < 0.5 || ids.empty()) {
+			ids.push_back(t.insert(random_point(drng,dim)));
+		} else if (drng() < 0.5) {
+			// Remove the least contributor, as in SMS-EMOA.
+			const id_type id = t.least_contributor();
+			t.erase(id);
+			ids.erase(std::find(ids.begin(),ids.end(),id));
+		} else {
+			const std::vector<id_type>::size_type idx = static_cast<std::vector<id_type>::size_type>(drng() * ids.size()) % ids.size();
+			t.erase(ids[idx]);
+			ids.erase(ids.begin() + idx);
+		}
+		if (check(t,ids)) {
+			return 1;
+		}
+	}
+	// Dominated points and points outside the reference box are rejected.
+	fitness_vector dominated(t.get_point(ids[0]));
+	dominated[0] += 1e-3;
+	fitness_vector outside(dim,0.5);
+	outside[0] = 2;
+	try {
+		t.insert(dominated);
+		return 1;
+	} catch (const value_error &) {}
+	try {
+		t.insert(outside);
+		return 1;
+	} catch (const value_error &) {}
+	return check(t,ids);
+}
+
+// Run SMS-EMOA on a 3-objective problem, where the tracker is used whenever the population is non-dominated.
+static int test_sms_emoa()
+{
+	population pop(problem::dtlz(2,10,3),50,0);
+	algorithm::sms_emoa(2000).evolve(pop);
+	return pop.size() != 50;
+}
+
+int main()
+{
+	return test_random(2) + test_random(3) + test_random(4) + test_random(5) + test_sms_emoa();
+}
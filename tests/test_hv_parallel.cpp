@@ -0,0 +1,145 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test for the multithreaded hypervolume algorithms: results must not depend on the number of threads.
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "../src/util/hypervolume.h"
+
+using namespace pagmo;
+using namespace pagmo::util;
+
+// Random points on the positive orthant of the unit sphere.
+static std::vector<fitness_vector> random_front(unsigned n, unsigned dim)
+{
+	boost::mt19937 rng(n * dim);
+	boost::variate_generator<boost::mt19937 &, boost::uniform_real<double> > drng(rng,boost::uniform_real<double>(0,1));
+	std::vector<fitness_vector> retval(n,fitness_vector(dim));
+	for (unsigned i = 0; i < n; ++i) {
+		double norm = 0;
+		for (unsigned j = 0; j < dim; ++j) {
+			retval[i][j] = drng();
+			norm += retval[i][j] * retval[i][j];
+		}
+		for (unsigned j = 0; j < dim; ++j) {
+			retval[i][j] /= std::sqrt(norm);
+		}
+	}
+	return retval;
+}
+
+static bool close(double a, double b)
+{
+	return std::abs(a - b) <= 1e-10 * std::abs(b);
+}
+
+static int test_front(unsigned n, unsigned dim)
+{
+	const hypervolume hv(random_front(n,dim));
+	const fitness_vector r(dim,1.1);
+	const double serial = hv.compute(r,hv_algorithm::wfg().clone());
+	const std::vector<double> c_serial = hv.contributions(r,hv_algorithm::wfg().clone());
+	const double hoy_serial = hv.compute(r,hv_algorithm::hoy().clone());
+	if (!close(hoy_serial,serial)) {
+		std::cout << "hoy and wfg differ: " << hoy_serial << " vs " << serial << '\n';
+		return 1;
+	}
+	const unsigned threads[] = {2, 3, 8};
+	for (unsigned t = 0; t < 3; ++t) {
+		if (!close(hv.compute(r,hv_algorithm::wfg(2,threads[t]).clone()),serial) ||
+			!close(hv.compute(r,hv_algorithm::hoy(threads[t]).clone()),hoy_serial))
+		{
+			std::cout << "parallel computation differs with " << threads[t] << " threads\n";
+			return 1;
+		}
+		const std::vector<double> c = hv.contributions(r,hv_algorithm::wfg(2,threads[t]).clone());
+		for (std::vector<double>::size_type i = 0; i < c.size(); ++i) {
+			if (std::abs(c[i] - c_serial[i]) > 1e-12) {
+				std::cout << "parallel contributions differ with " << threads[t] << " threads\n";
+				return 1;
+			}
+		}
+	}
+	// Serial algorithms running on a shared pool.
+	const thread_pool_ptr pool(new thread_pool(3));
+	const hv_algorithm::base_ptr wfg_shared = hv_algorithm::wfg().clone(), hoy_shared = hv_algorithm::hoy().clone();
+	wfg_shared->set_thread_pool(pool);
+	hoy_shared->set_thread_pool(pool);
+	if (!close(hv.compute(r,wfg_shared),serial) || !close(hv.compute(r,hoy_shared),hoy_serial) ||
+		std::abs(hv.contributions(r,wfg_shared).back() - c_serial.back()) > 1e-12)
+	{
+		std::cout << "computation on a shared pool differs\n";
+		return 1;
+	}
+	return 0;
+}
+
+// The Monte Carlo algorithms draw a seed from their own generator, hence freshly built instances must give the same result for any number of threads.
+static int test_approx(unsigned n, unsigned dim)
+{
+	const hypervolume hv(random_front(n,dim));
+	const fitness_vector r(dim,1.1);
+	const double exact = hv.compute(r,hv_algorithm::wfg().clone());
+	const double serial = hv.compute(r,hv_algorithm::bf_fpras(0.05,0.01).clone());
+	if (std::abs(serial - exact) > 0.05 * exact) {
+		std::cout << "bf_fpras is not accurate: " << serial << " vs " << exact << '\n';
+		return 1;
+	}
+	const std::vector<double> c = hv.contributions(r,hv_algorithm::wfg().clone());
+	const unsigned lc_serial = hv.least_contributor(r,hv_algorithm::bf_approx(false).clone());
+	if (c[lc_serial] > 1.05 * *std::min_element(c.begin(),c.end())) {
+		std::cout << "bf_approx is not accurate\n";
+		return 1;
+	}
+	const unsigned threads[] = {2, 5};
+	for (unsigned t = 0; t < 2; ++t) {
+		if (hv.compute(r,hv_algorithm::bf_fpras(0.05,0.01,threads[t]).clone()) != serial ||
+			hv.least_contributor(r,hv_algorithm::bf_approx(false,1,1e-2,1e-6,0.775,0.2,0.1,0.25,threads[t]).clone()) != lc_serial)
+		{
+			std::cout << "parallel sampling differs with " << threads[t] << " threads\n";
+			return 1;
+		}
+	}
+	// Serial algorithms running on a shared pool.
+	const thread_pool_ptr pool(new thread_pool(3));
+	const hv_algorithm::base_ptr fpras_shared = hv_algorithm::bf_fpras(0.05,0.01).clone(), approx_shared = hv_algorithm::bf_approx(false).clone();
+	fpras_shared->set_thread_pool(pool);
+	approx_shared->set_thread_pool(pool);
+	if (hv.compute(r,fpras_shared) != serial || hv.least_contributor(r,approx_shared) != lc_serial) {
+		std::cout << "sampling on a shared pool differs\n";
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	return test_front(2,5) + test_front(50,4) + test_front(60,5) + test_front(40,7) + test_approx(30,6) + test_approx(20,9);
+}
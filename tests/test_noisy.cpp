@@ -30,6 +30,7 @@
 #include <vector>
 #include <cassert>
 #include "../src/pagmo.h"
+#include "../src/util/thread_pool.h"
 
 using namespace pagmo;
 
@@ -205,6 +206,45 @@ int test_noisy_uniform(const std::vector<problem::base_ptr> & probs, double nois
 	return 0;
 }
 
+// Check that the batch evaluation of a noisy problem with many trials gives
+// the same fitness and constraint vectors as the evaluation one by one, with
+// or without a thread pool.
+int test_noisy_batch(const problem::base &prob, unsigned int trials, double tol)
+{
+	std::cout << "Testing batch evaluation of " << prob.get_name() << " with " << trials << " trials." << std::endl;
+
+	problem::noisy prob_noisy(prob, trials, 0.1, 0.5, problem::noisy::NORMAL, 42);
+	population pop(prob, 50, 42);
+	std::vector<decision_vector> x;
+	for(population::size_type i = 0; i < pop.size(); i++){
+		x.push_back(pop.get_individual(i).cur_x);
+	}
+
+	problem::noisy prob_par(prob_noisy);
+	prob_par.set_thread_pool(util::thread_pool_ptr(new util::thread_pool(3)));
+
+	std::vector<fitness_vector> f_batch, f_par;
+	std::vector<constraint_vector> c_batch, c_par;
+	prob_noisy.objfun_batch(f_batch, x);
+	prob_noisy.compute_constraints_batch(c_batch, x);
+	prob_par.objfun_batch(f_par, x);
+	prob_par.compute_constraints_batch(c_par, x);
+	prob_noisy.reset_caches();
+
+	for(unsigned int i = 0; i < x.size(); i++){
+		fitness_vector f = prob_noisy.objfun(x[i]);
+		constraint_vector c = prob_noisy.compute_constraints(x[i]);
+		if(!is_eq(f, f_batch[i], tol) || !is_eq(f, f_par[i], tol) ||
+		   !is_eq(c, c_batch[i], tol) || !is_eq(c, c_par[i], tol)){
+			std::cout << "\tBatch evaluation differs from single evaluation!" << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << "\tpassed." << std::endl;
+	return 0;
+}
+
 int main()
 {	
 	int dimension = 10;
@@ -215,5 +255,7 @@ int main()
 	return test_noisy(probs, 0.0, 0.1, 5000, 0.01) ||
 		   test_noisy(probs, 3.14, 0.1, 5000, 0.01) ||
 		   test_noisy_uniform(probs, 0.0, 0.1, 5000, 0.01) ||
-		   test_noisy_uniform(probs, -0.2, 0.2, 5000, 0.01);
+		   test_noisy_uniform(probs, -0.2, 0.2, 5000, 0.01) ||
+		   test_noisy_batch(problem::zdt(1, dimension), 100, EPS) ||
+		   test_noisy_batch(problem::cec2006(5), 50, EPS);
 }
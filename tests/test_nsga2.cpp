@@ -0,0 +1,130 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the NSGA-II algorithm: elitism, preservation of the extreme points and evaluation count on ZDT1.
+
+#include <iostream>
+#include <vector>
+
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Number of individuals of pop whose decision vector is x.
+static population::size_type count_x(const population &pop, const decision_vector &x)
+{
+	population::size_type retval = 0;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		if (pop.get_individual(i).cur_x == x) {
+			++retval;
+		}
+	}
+	return retval;
+}
+
+// The survivors are selected front by front from the parents and the offspring: an individual of the parents which dominates
+// a survivor is ranked in an earlier front, hence it must have survived as well.
+static int check_elitism(const population &parents, const population &survivors)
+{
+	const problem::base &prob = survivors.problem();
+	for (population::size_type i = 0; i < survivors.size(); ++i) {
+		for (population::size_type j = 0; j < parents.size(); ++j) {
+			if (prob.compare_fitness(parents.get_individual(j).cur_f,survivors.get_individual(i).cur_f) &&
+				!count_x(survivors,parents.get_individual(j).cur_x))
+			{
+				std::cout << "a parent dominating a survivor was discarded" << std::endl;
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static double min_f(const population &pop, fitness_vector::size_type k)
+{
+	double retval = pop.get_individual(0).cur_f[k];
+	for (population::size_type i = 1; i < pop.size(); ++i) {
+		retval = std::min(retval,pop.get_individual(i).cur_f[k]);
+	}
+	return retval;
+}
+
+static int test_nsga2_zdt1()
+{
+	const population::size_type NP = 40;
+	const int n_steps = 60;
+	problem::zdt prob(1,30);
+	prob.set_cache_capacity(0);
+	population pop(prob,NP,123);
+	algorithm::nsga2 algo(1);
+	algo.reset_rngs(321);
+	for (int g = 0; g < n_steps; ++g) {
+		const population parents(pop);
+		algo.evolve(pop);
+		if (pop.size() != NP) {
+			std::cout << "wrong population size: " << pop.size() << std::endl;
+			return 1;
+		}
+		if (check_elitism(parents,pop)) {
+			return 1;
+		}
+		// The extreme points of the first front have infinite crowding distance, hence they are never discarded.
+		if (min_f(pop,0) > min_f(parents,0) || min_f(pop,1) > min_f(parents,1)) {
+			std::cout << "an extreme point of the first front was discarded" << std::endl;
+			return 1;
+		}
+	}
+	// One evaluation per offspring (the population was evaluated at construction).
+	if (pop.problem().get_fevals() != NP * (n_steps + 1)) {
+		std::cout << "wrong number of evaluations: " << pop.problem().get_fevals() << std::endl;
+		return 1;
+	}
+	// The domination information of the returned population is consistent with the fitnesses.
+	const std::vector<std::vector<population::size_type> > fronts = pop.compute_pareto_fronts();
+	population::size_type n_ranked = 0;
+	for (std::vector<std::vector<population::size_type> >::size_type k = 0; k < fronts.size(); ++k) {
+		for (std::vector<population::size_type>::size_type i = 0; i < fronts[k].size(); ++i) {
+			for (std::vector<population::size_type>::size_type j = 0; j < fronts[k].size(); ++j) {
+				if (pop.problem().compare_fitness(pop.get_individual(fronts[k][i]).cur_f,pop.get_individual(fronts[k][j]).cur_f)) {
+					std::cout << "front " << k << " is not mutually non-dominated" << std::endl;
+					return 1;
+				}
+			}
+		}
+		n_ranked += fronts[k].size();
+	}
+	if (n_ranked != NP) {
+		std::cout << "the fronts do not cover the population" << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	std::cout << "Testing NSGA-II on ZDT1: ";
+	if (test_nsga2_zdt1()) return 1;
+	std::cout << "SUCCESS" << std::endl;
+	return 0;
+}
@@ -0,0 +1,124 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test for the point matrix used by the hypervolume subsystem.
+
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "../src/pagmo.h"
+#include "../src/util/hypervolume.h"
+#include "../src/util/point_matrix.h"
+
+using namespace pagmo;
+using namespace pagmo::util;
+
+static int test_layout()
+{
+	std::vector<fitness_vector> points(3,fitness_vector(4));
+	for (unsigned i = 0; i < 3; ++i) {
+		for (unsigned j = 0; j < 4; ++j) {
+			points[i][j] = i * 4 + j;
+		}
+	}
+	point_matrix m(points);
+	if (m.rows() != 3 || m.cols() != 4 || m.is_view() || reinterpret_cast<std::size_t>(m.data()) % point_matrix::alignment) {
+		std::cout << "wrong matrix layout\n";
+		return 1;
+	}
+	for (unsigned i = 0; i < 12; ++i) {
+		if (m.data()[i] != i) {
+			std::cout << "matrix is not row-major\n";
+			return 1;
+		}
+	}
+	// A view refers to the original block, its copies own their data.
+	point_matrix v(m.data(),3,4);
+	v[1][2] = -1;
+	point_matrix c(v);
+	c[1][2] = -2;
+	if (!v.is_view() || c.is_view() || m[1][2] != -1 || c.to_vectors()[1][2] != -2) {
+		std::cout << "wrong view semantics\n";
+		return 1;
+	}
+	m.erase_row(0);
+	if (m.rows() != 2 || m[0][0] != 4 || m[0][2] != -1 || m[1][3] != 11) {
+		std::cout << "wrong row removal\n";
+		return 1;
+	}
+	return 0;
+}
+
+static int test_hypervolume()
+{
+	population pop(problem::dtlz(2,10,4),60);
+	std::vector<fitness_vector> points;
+	for (population::size_type i = 0; i < pop.size(); ++i) {
+		points.push_back(pop.get_individual(i).cur_f);
+	}
+	const point_matrix m(pop);
+	if (m.to_vectors() != points) {
+		std::cout << "wrong packing of the population\n";
+		return 1;
+	}
+	const hypervolume hv_v(points), hv_m(m), hv_p(boost::shared_ptr<population>(new population(pop)));
+	const fitness_vector r = hv_v.get_nadir_point(1.);
+	const double exact = hv_v.compute(r,hv_algorithm::wfg().clone());
+	if (hv_m.compute(r,hv_algorithm::wfg().clone()) != exact || hv_p.compute(r,hv_algorithm::wfg().clone()) != exact ||
+		std::abs(hv_m.compute(r) - exact) > 1e-10 * exact || hv_m.get_points() != points)
+	{
+		std::cout << "hypervolume from point matrix differs\n";
+		return 1;
+	}
+	if (hv_m.contributions(r,hv_algorithm::wfg().clone()) != hv_v.contributions(r,hv_algorithm::wfg().clone()) ||
+		hv_m.least_contributor(r) != hv_v.least_contributor(r))
+	{
+		std::cout << "contributions from point matrix differ\n";
+		return 1;
+	}
+	std::stringstream ss;
+	{
+		boost::archive::text_oarchive oa(ss);
+		oa << hv_m;
+	}
+	hypervolume hv_s;
+	{
+		boost::archive::text_iarchive ia(ss);
+		ia >> hv_s;
+	}
+	if (hv_s.get_points() != points) {
+		std::cout << "wrong serialization of the point matrix\n";
+		return 1;
+	}
+	return 0;
+}
+
+int main()
+{
+	return test_layout() + test_hypervolume();
+}
@@ -0,0 +1,190 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the lazy update of the domination information, for swapping of populations, for appending individuals with known fitness
+// and for the block representation of the individuals
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Check that eager and lazy populations have the same domination information after the same sequence of modifications.
+int test_lazy_dom(const problem::base &prob)
+{
+	std::cout << "Testing lazy domination update on " << prob.get_name() << "... ";
+	population eager(prob,40,123), lazy(prob,0,123);
+	lazy.set_dom_update(population::LAZY_DOM);
+	for (population::size_type i = 0; i < eager.size(); ++i) {
+		lazy.push_back(eager.get_individual(i).cur_x);
+	}
+	population source(prob,30,456);
+	for (population::size_type i = 0; i < 10; ++i) {
+		eager.set_x(3 * i,source.get_individual(i).cur_x);
+		lazy.set_x(3 * i,source.get_individual(i).cur_x);
+		eager.push_back(source.get_individual(10 + i).cur_x);
+		lazy.push_back(source.get_individual(10 + i).cur_x);
+		eager.erase(2 * i);
+		lazy.erase(2 * i);
+	}
+	eager.update_pareto_information();
+	lazy.update_pareto_information();
+	for (population::size_type i = 0; i < eager.size(); ++i) {
+		std::vector<population::size_type> l1 = eager.get_domination_list(i), l2 = lazy.get_domination_list(i);
+		std::sort(l1.begin(),l1.end());
+		std::sort(l2.begin(),l2.end());
+		if (l1 != l2 || eager.get_domination_count(i) != lazy.get_domination_count(i) ||
+			eager.get_pareto_rank(i) != lazy.get_pareto_rank(i) || eager.get_crowding_d(i) != lazy.get_crowding_d(i))
+		{
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	// Switching back to eager mode must leave up-to-date information.
+	lazy.set_x(0,source.get_individual(20).cur_x);
+	lazy.set_dom_update(population::EAGER_DOM);
+	eager.set_x(0,source.get_individual(20).cur_x);
+	for (population::size_type i = 0; i < eager.size(); ++i) {
+		if (eager.get_domination_count(i) != lazy.get_domination_count(i)) {
+			std::cout << "mismatch after switching to eager mode at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that swapping two populations is equivalent to exchanging them via copies.
+int test_swap()
+{
+	std::cout << "Testing population swap... ";
+	population p1(problem::zdt(1,10),20,123), p2(problem::dtlz(2,10,3),35,456);
+	p2.set_dom_update(population::LAZY_DOM);
+	const population c1(p1), c2(p2);
+	p1.swap(p2);
+	if (p1.human_readable() != c2.human_readable() || p2.human_readable() != c1.human_readable() ||
+		p1.get_dom_update() != population::LAZY_DOM || p2.get_dom_update() != population::EAGER_DOM)
+	{
+		std::cout << "failed!" << std::endl;
+		return 1;
+	}
+	// The swapped populations must keep on working normally.
+	p1.push_back(c2.get_individual(0).cur_x);
+	p2.set_x(0,c1.get_individual(1).cur_x);
+	if (p1.size() != 36 || p2.get_individual(0).cur_x != c1.get_individual(1).cur_x) {
+		std::cout << "failed!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that appending individuals with known fitness and constraints is equivalent to appending them with evaluation.
+int test_push_back_known(const problem::base &prob)
+{
+	std::cout << "Testing push_back with known fitness on " << prob.get_name() << "... ";
+	const population source(prob,20,123);
+	population evaluated(prob,0,456), known(prob,0,456);
+	for (population::size_type i = 0; i < source.size(); ++i) {
+		const population::individual_type &ind = source.get_individual(i);
+		evaluated.push_back(ind.cur_x);
+		known.push_back(ind.cur_x,ind.cur_f,ind.cur_c);
+	}
+	if (evaluated.human_readable() != known.human_readable()) {
+		std::cout << "failed!" << std::endl;
+		return 1;
+	}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+// Check that copying the individuals through a block is equivalent to copying the population.
+int test_block(const problem::base &prob)
+{
+	std::cout << "Testing block copy on " << prob.get_name() << "... ";
+	population source(prob,25,123);
+	// Make the current and best vectors differ.
+	const population other(prob,25,456);
+	for (population::size_type i = 0; i < source.size(); ++i) {
+		source.set_x(i,other.get_individual(i).cur_x);
+	}
+	population::block_type block;
+	source.get_block(block);
+	const population::block_type copy(block);
+	for (population::size_type i = 0; i < source.size(); ++i) {
+		const population::individual_type &ind = source.get_individual(i);
+		const population::block_type::individual_view view = copy[i];
+		if (!std::equal(ind.cur_x.begin(),ind.cur_x.end(),view.cur_x) || !std::equal(ind.cur_v.begin(),ind.cur_v.end(),view.cur_v) ||
+			!std::equal(ind.cur_c.begin(),ind.cur_c.end(),view.cur_c) || !std::equal(ind.cur_f.begin(),ind.cur_f.end(),view.cur_f) ||
+			!std::equal(ind.best_x.begin(),ind.best_x.end(),view.best_x) || !std::equal(ind.best_c.begin(),ind.best_c.end(),view.best_c) ||
+			!std::equal(ind.best_f.begin(),ind.best_f.end(),view.best_f) || ind.cur_x.size() != view.dimension ||
+			ind.cur_c.size() != view.c_dimension || ind.cur_f.size() != view.f_dimension)
+		{
+			std::cout << "wrong view at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	population eager(prob,10,789), lazy(prob,0,789);
+	lazy.set_dom_update(population::LAZY_DOM);
+	eager.set_block(copy);
+	lazy.set_block(copy);
+	if (eager.size() != source.size() || lazy.size() != source.size() || eager.champion().human_readable() != source.champion().human_readable() ||
+		lazy.champion().human_readable() != source.champion().human_readable())
+	{
+		std::cout << "wrong champion!" << std::endl;
+		return 1;
+	}
+	for (population::size_type i = 0; i < source.size(); ++i) {
+		const std::string ind = source.get_individual(i).human_readable();
+		std::vector<population::size_type> l = source.get_domination_list(i), l_eager = eager.get_domination_list(i), l_lazy = lazy.get_domination_list(i);
+		std::sort(l.begin(),l.end());
+		std::sort(l_eager.begin(),l_eager.end());
+		std::sort(l_lazy.begin(),l_lazy.end());
+		if (eager.get_individual(i).human_readable() != ind || lazy.get_individual(i).human_readable() != ind || l_eager != l || l_lazy != l) {
+			std::cout << "mismatch at index " << i << "!" << std::endl;
+			return 1;
+		}
+	}
+	// Blocks of other problems must be rejected.
+	population::block_type wrong;
+	population(problem::ackley(3),5).get_block(wrong);
+	try {
+		eager.set_block(wrong);
+		std::cout << "incompatible block accepted!" << std::endl;
+		return 1;
+	} catch (const value_error &) {}
+	std::cout << "passed." << std::endl;
+	return 0;
+}
+
+int main()
+{
+	return test_lazy_dom(problem::zdt(1,10)) + test_lazy_dom(problem::dtlz(2,10,3)) + test_lazy_dom(problem::cec2006(4)) +
+		test_lazy_dom(problem::cec2009(7,10,true)) + test_swap() +
+		test_push_back_known(problem::zdt(1,10)) + test_push_back_known(problem::cec2006(4)) +
+		test_block(problem::zdt(1,10)) + test_block(problem::cec2006(4));
+}
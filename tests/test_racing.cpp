@@ -33,6 +33,7 @@
 
 #include "../src/pagmo.h"
 #include "../src/util/race_pop.h"
+#include "../src/util/thread_pool.h"
 
 using namespace pagmo;
 using namespace util::racing;
@@ -414,6 +415,49 @@ int test_race_pop_constructor(const problem::base_ptr& prob)
 	return 0;
 }
 
+/// Check that racing with a thread pool set on the problem gives the same
+/// result as the serial race
+int test_racing_parallel(const problem::base_ptr& prob)
+{
+	std::cout << "Testing racing with parallel evaluations" << std::endl;
+
+	unsigned int seed = 123;
+	population pop(*prob, 20, seed);
+	problem::base_ptr prob_par = prob->clone();
+	prob_par->set_thread_pool(util::thread_pool_ptr(new util::thread_pool(4)));
+	population pop_par(*prob_par, 0, seed);
+	for(population::size_type i = 0; i < pop.size(); i++){
+		pop_par.push_back(pop.get_individual(i).cur_x);
+	}
+
+	util::racing::race_pop race_pop_ser(pop, seed);
+	util::racing::race_pop race_pop_par(pop_par, seed);
+	std::vector<population::size_type> active_set;
+	for(population::size_type i = 0; i < 20; i++){
+		active_set.push_back(i);
+	}
+	std::pair<std::vector<population::size_type>, unsigned int> res_ser = race_pop_ser.run(1, 5, 2000, 0.05, active_set, race_pop::MAX_BUDGET, true, false);
+	std::pair<std::vector<population::size_type>, unsigned int> res_par = race_pop_par.run(1, 5, 2000, 0.05, active_set, race_pop::MAX_BUDGET, true, false);
+
+	std::cout << "\tSerial winners: " << res_ser.first << ", fevals: " << res_ser.second << std::endl;
+	std::cout << "\tParallel winners: " << res_par.first << ", fevals: " << res_par.second << std::endl;
+
+	if(res_ser != res_par){
+		std::cout << "\tFAILED: Parallel race differs from serial race" << std::endl;
+		return 1;
+	}
+	std::vector<fitness_vector> mean_ser = race_pop_ser.get_mean_fitness(res_ser.first);
+	std::vector<fitness_vector> mean_par = race_pop_par.get_mean_fitness(res_par.first);
+	for(unsigned int i = 0; i < mean_ser.size(); i++){
+		if(!is_eq(mean_ser[i], mean_par[i], EPS)){
+			std::cout << "\tFAILED: Parallel race mean fitness differs from serial race" << std::endl;
+			return 1;
+		}
+	}
+
+	std::cout << "\tPASSED racing with parallel evaluations." << std::endl;
+	return 0;
+}
 
 int main()
 {
@@ -421,6 +465,8 @@ int main()
 	problem::base_ptr prob_ackley(new problem::ackley(dimension));
 	problem::base_ptr prob_cec2006(new problem::cec2006(5));
 	problem::base_ptr prob_zdt1(new problem::zdt(1, dimension));
+	problem::base_ptr prob_noisy_ackley(new problem::noisy(problem::ackley(dimension), 1, 0, 0.5, problem::noisy::NORMAL, 123));
+	problem::base_ptr prob_inventory(new problem::inventory(4, 10, 123));
 	
 	return test_racing(prob_ackley, 10, 2) ||
 		   test_racing(prob_ackley, 20, 2) ||
@@ -454,5 +500,8 @@ int main()
 
 		   test_racing_get_mean_fitness(prob_ackley) ||
 
-		   test_race_pop_constructor(prob_ackley);
+		   test_race_pop_constructor(prob_ackley) ||
+
+		   test_racing_parallel(prob_noisy_ackley) ||
+		   test_racing_parallel(prob_inventory);
 }
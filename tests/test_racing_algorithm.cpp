@@ -31,6 +31,7 @@
 #include <cassert>
 #include "../src/pagmo.h"
 #include "../src/util/race_algo.h"
+#include "../src/util/thread_pool.h"
 
 using namespace pagmo;
 
@@ -215,6 +216,42 @@ int test_heterogeneous_constraints()
 	return 0;
 }
 
+// Test that running the algorithms of each racing iteration concurrently gives
+// the same race as running them serially.
+int test_parallel_race()
+{
+	std::vector<problem::base_ptr> probs;
+	probs.push_back(problem::cec2006(1).clone());
+	probs.push_back(problem::cec2006(2).clone());
+	probs.push_back(problem::ackley(10).clone());
+
+	std::vector<algorithm::base_ptr> algos;
+	for(unsigned int i = 1; i <= 6; i++){
+		algos.push_back(algorithm::ihs(i * 20).clone());
+	}
+
+	unsigned int pop_size = 20;
+
+	util::racing::race_algo race_ser(algos, probs, pop_size, 123);
+	util::racing::race_algo race_par(algos, probs, pop_size, 123);
+	race_par.set_thread_pool(util::thread_pool_ptr(new util::thread_pool(4)));
+
+	std::pair<std::vector<unsigned int>, unsigned int> res_ser = race_ser.run(2, 1, 200, 0.05, std::vector<unsigned int>(), true, false);
+	std::pair<std::vector<unsigned int>, unsigned int> res_par = race_par.run(2, 1, 200, 0.05, std::vector<unsigned int>(), true, false);
+
+	std::cout << "Serial race: winners " << res_ser.first << ", evaluations " << res_ser.second << std::endl;
+	std::cout << "Parallel race: winners " << res_par.first << ", evaluations " << res_par.second << std::endl;
+
+	if(res_ser != res_par){
+		std::cout << "\tParallel race differs from the serial race!" << std::endl;
+		return 1;
+	}
+
+	std::cout << "Test passed [parallel race]" << std::endl;
+
+	return 0;
+}
+
 /*
 // TODO: Find out offline which variant works best and verify in this test?
 int varied_pso_variant(const problem::base_ptr& prob)
@@ -245,5 +282,6 @@ int main()
 		varied_n_gen(prob, 2) ||
 		varied_n_gen(prob_list, 1) ||
 		varied_n_gen(prob_list, 2) ||
-		test_heterogeneous_constraints();
+		test_heterogeneous_constraints() ||
+		test_parallel_race();
 }
@@ -0,0 +1,149 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test for the generator of pseudo-random number generators and the serialization of the generators.
+
+#include <algorithm>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/thread/thread.hpp>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "../src/rng.h"
+
+using namespace pagmo;
+
+static int test_sequence()
+{
+	rng_generator::set_seed(42);
+	std::vector<boost::uint32_t> first;
+	for (int i = 0; i < 1000; ++i) {
+		first.push_back(rng_generator::get<rng_uint32>()());
+	}
+	// The sequence is reproducible, and explicit streams do not consume it.
+	rng_generator::set_seed(42);
+	const boost::uint32_t stream_value = rng_generator::get<rng_uint32>(7)();
+	for (int i = 0; i < 1000; ++i) {
+		if (rng_generator::get<rng_uint32>()() != first[i]) {
+			std::cout << "sequence of generators is not reproducible\n";
+			return 1;
+		}
+	}
+	if (rng_generator::get<rng_uint32>(7)() != stream_value || rng_generator::get<rng_uint32>(8)() == stream_value) {
+		std::cout << "wrong explicit streams\n";
+		return 1;
+	}
+	// Jumping ahead skips the seeds.
+	rng_generator::set_seed(42);
+	rng_generator::discard(500);
+	if (rng_generator::get<rng_uint32>()() != first[500]) {
+		std::cout << "wrong jump ahead\n";
+		return 1;
+	}
+	std::sort(first.begin(), first.end());
+	if (std::adjacent_find(first.begin(), first.end()) != first.end()) {
+		std::cout << "generators are not independent\n";
+		return 1;
+	}
+	return 0;
+}
+
+struct draw_seeds
+{
+	draw_seeds(std::vector<boost::uint32_t> &out):m_out(out) {}
+	void operator()()
+	{
+		for (std::vector<boost::uint32_t>::size_type i = 0; i < m_out.size(); ++i) {
+			m_out[i] = rng_generator::get<rng_uint32>()();
+		}
+	}
+	std::vector<boost::uint32_t> &m_out;
+};
+
+static int test_threads()
+{
+	// Generators requested concurrently are the same, up to their order, as those requested by a single thread.
+	const unsigned n_threads = 4, n = 2000;
+	rng_generator::set_seed(1);
+	std::vector<boost::uint32_t> serial(n_threads * n);
+	for (unsigned i = 0; i < serial.size(); ++i) {
+		serial[i] = rng_generator::get<rng_uint32>()();
+	}
+	rng_generator::set_seed(1);
+	std::vector<std::vector<boost::uint32_t> > out(n_threads, std::vector<boost::uint32_t>(n));
+	boost::thread_group threads;
+	for (unsigned t = 0; t < n_threads; ++t) {
+		threads.create_thread(draw_seeds(out[t]));
+	}
+	threads.join_all();
+	std::vector<boost::uint32_t> parallel;
+	for (unsigned t = 0; t < n_threads; ++t) {
+		parallel.insert(parallel.end(), out[t].begin(), out[t].end());
+	}
+	std::sort(serial.begin(), serial.end());
+	std::sort(parallel.begin(), parallel.end());
+	if (serial != parallel) {
+		std::cout << "generators handed out concurrently differ\n";
+		return 1;
+	}
+	return 0;
+}
+
+template <class Rng, class OArchive, class IArchive>
+static int test_serialization(const char *name)
+{
+	Rng rng(123);
+	for (int i = 0; i < 1000; ++i) {
+		rng();
+	}
+	std::stringstream ss;
+	{
+		OArchive oa(ss);
+		oa << rng;
+	}
+	Rng loaded;
+	{
+		IArchive ia(ss);
+		ia >> loaded;
+	}
+	for (int i = 0; i < 2000; ++i) {
+		if (rng() != loaded()) {
+			std::cout << "wrong serialization of " << name << '\n';
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int main()
+{
+	return test_sequence() + test_threads() +
+		test_serialization<rng_uint32, boost::archive::text_oarchive, boost::archive::text_iarchive>("rng_uint32 (text)") +
+		test_serialization<rng_uint32, boost::archive::binary_oarchive, boost::archive::binary_iarchive>("rng_uint32 (binary)") +
+		test_serialization<rng_double, boost::archive::text_oarchive, boost::archive::text_iarchive>("rng_double (text)") +
+		test_serialization<rng_double, boost::archive::binary_oarchive, boost::archive::binary_iarchive>("rng_double (binary)");
+}
@@ -0,0 +1,122 @@
+/*****************************************************************************
+ *   Copyright (C) 2004-2013 The PaGMO development team,                     *
+ *   Advanced Concepts Team (ACT), European Space Agency (ESA)               *
+ *   http://apps.sourceforge.net/mediawiki/pagmo                             *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Developers  *
+ *   http://apps.sourceforge.net/mediawiki/pagmo/index.php?title=Credits     *
+ *   act@esa.int                                                             *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.               *
+ *****************************************************************************/
+
+// Test code for the SPEA2 truncation operator: the retained individuals are checked against a brute force implementation
+// of the operator on small, fixed sets of points.
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/pagmo.h"
+
+using namespace pagmo;
+
+// Orders the individuals so that the maximum is the one to be removed: a is "less" than b if the distances of b to the
+// other alive individuals, in ascending order, are lexicographically smaller than those of a.
+struct removal_comp {
+	removal_comp(const std::vector<std::vector<double> > &dist):m_dist(dist) {}
+	bool operator()(const population::size_type &a, const population::size_type &b) const
+	{
+		return std::lexicographical_compare(m_dist[b].begin(),m_dist[b].end(),m_dist[a].begin(),m_dist[a].end());
+	}
+	const std::vector<std::vector<double> > &m_dist;
+};
+
+// Brute force truncation: the sorted distances among the alive individuals are recomputed after each removal.
+static std::vector<population::size_type> brute_force_truncate(const std::vector<fitness_vector> &fit, const population::size_type archive_size)
+{
+	std::vector<population::size_type> alive;
+	for (population::size_type i = 0; i < fit.size(); ++i) {
+		alive.push_back(i);
+	}
+	while (alive.size() > archive_size) {
+		std::vector<std::vector<double> > dist(fit.size());
+		for (population::size_type i = 0; i < alive.size(); ++i) {
+			for (population::size_type j = 0; j < alive.size(); ++j) {
+				if (i != j) {
+					dist[alive[i]].push_back(util::neighbourhood::euclidian::distance(fit[alive[i]],fit[alive[j]]));
+				}
+			}
+			std::sort(dist[alive[i]].begin(),dist[alive[i]].end());
+		}
+		// std::max_element returns the first individual in case of ties.
+		alive.erase(std::max_element(alive.begin(),alive.end(),removal_comp(dist)));
+	}
+	return alive;
+}
+
+// Checks the truncation to every archive size, which amounts to checking the order in which the individuals are removed.
+static int check_truncation(const std::vector<fitness_vector> &fit)
+{
+	const algorithm::spea2 algo;
+	for (population::size_type archive_size = fit.size(); archive_size > 0; --archive_size) {
+		if (algo.truncate(fit,archive_size - 1) != brute_force_truncate(fit,archive_size - 1)) {
+			std::cout << "wrong individuals retained for an archive of size " << archive_size - 1 << std::endl;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Points on a front with several equal distances and a duplicate, so that the ties are decided by the farther neighbours
+// or by the position of the individuals.
+static int test_truncation_ties()
+{
+	const double points[][2] = {{0,10},{1,9},{2,8},{3,7},{3,7},{5,5},{6,4},{7,3},{8,2},{10,0},{4,6},{9,1}};
+	std::vector<fitness_vector> fit;
+	for (unsigned int i = 0; i < sizeof(points) / sizeof(points[0]); ++i) {
+		fit.push_back(fitness_vector(points[i],points[i] + 2));
+	}
+	return check_truncation(fit);
+}
+
+// Points on the front of a three objectives problem, scattered with a fixed seed.
+static int test_truncation_scattered()
+{
+	const double half_pi = 2 * std::atan(1.);
+	rng_double drng(42);
+	std::vector<fitness_vector> fit;
+	for (int i = 0; i < 30; ++i) {
+		const double a = drng() * half_pi, b = drng() * half_pi;
+		fitness_vector f(3);
+		f[0] = std::cos(a) * std::cos(b);
+		f[1] = std::cos(a) * std::sin(b);
+		f[2] = std::sin(a);
+		fit.push_back(f);
+	}
+	return check_truncation(fit);
+}
+
+int main()
+{
+	std::cout << "Testing SPEA2 truncation with ties: ";
+	if (test_truncation_ties()) return 1;
+	std::cout << "SUCCESS" << std::endl;
+	std::cout << "Testing SPEA2 truncation on scattered points: ";
+	if (test_truncation_scattered()) return 1;
+	std::cout << "SUCCESS" << std::endl;
+	return 0;
+}
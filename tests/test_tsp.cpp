@@ -23,11 +23,13 @@
  *****************************************************************************/
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include "boost/random.hpp"
 #include "boost/generator_iterator.hpp"
 
 #include "../src/problem/tsp.h"
 #include "../src/population.h"
+#include "../src/serialization.h"
 
 using namespace pagmo;
 
@@ -133,6 +135,44 @@ bool test_encoding_transformations(int repeat, boost::lagged_fibonacci607 rng)
     return false;
 }
 
+/*
+ * This test checks that the copies of a tsp problem share its weight matrix
+ * and that serialization restores an equivalent problem.
+ */
+bool test_shared_weights(boost::lagged_fibonacci607 rng)
+{
+    std::vector<std::vector<double> > weights( generate_random_matrix(30,rng) );
+    pagmo::problem::tsp prob(weights, pagmo::problem::tsp::RANDOMKEYS);
+    pagmo::problem::base_ptr prob_clone = prob.clone();
+    const pagmo::problem::tsp &tsp_clone = dynamic_cast<const pagmo::problem::tsp &>(*prob_clone);
+    if (&tsp_clone.get_weights() != &prob.get_weights()) {
+        std::cout << "weight matrix is copied by clone()\n";
+        return true;
+    }
+
+    std::stringstream ss;
+    {
+        boost::archive::text_oarchive oa(ss);
+        oa << prob_clone;
+    }
+    pagmo::problem::base_ptr prob_loaded;
+    {
+        boost::archive::text_iarchive ia(ss);
+        ia >> prob_loaded;
+    }
+    const pagmo::problem::tsp &tsp_loaded = dynamic_cast<const pagmo::problem::tsp &>(*prob_loaded);
+    if (tsp_loaded.get_weights() != weights) {
+        std::cout << "weight matrix is not restored by serialization\n";
+        return true;
+    }
+    pagmo::decision_vector tour_rk = population(prob,1).get_individual(0).cur_x;
+    if (prob.objfun(tour_rk) != prob_loaded->objfun(tour_rk)) {
+        std::cout << "fitness differs after serialization\n";
+        return true;
+    }
+    return false;
+}
+
 int main()
 {
     boost::lagged_fibonacci607 rng;
@@ -142,6 +182,9 @@ int main()
     std::cout << "Testing Encoding Transformations: ";
     if (test_encoding_transformations(100,rng)) return 1;
     std::cout << "SUCCESS" << std::endl;
+    std::cout << "Testing Shared Weights: ";
+    if (test_shared_weights(rng)) return 1;
+    std::cout << "SUCCESS" << std::endl;
     
     // all iz well
     return 0;